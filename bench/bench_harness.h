@@ -0,0 +1,174 @@
+#pragma once
+// Minimal microbenchmark runner in the spirit of Google Benchmark: each
+// benchmark is calibrated to a minimum run time, repeated, and reported as
+// the median time per iteration. Results can be written as JSON in Google
+// Benchmark's layout so existing comparison tooling can diff two runs.
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace bench {
+
+// Keep a computed value alive so the optimizer cannot drop the work behind it
+template <typename T>
+inline void DoNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+// A benchmark body runs its operation the given number of times
+typedef std::function<void(size_t iterations)> BodyFn;
+
+struct Benchmark {
+    std::string name;
+    BodyFn body;
+};
+
+struct Result {
+    std::string name;
+    size_t iterations;
+    double realNs;  // Median wall time per iteration
+    double cpuNs;   // Process CPU time per iteration for the median run
+    double minNs;
+    double maxNs;
+};
+
+struct Options {
+    double minTime{0.1};  // Seconds each repetition should run for
+    int repetitions{5};
+    std::string filter;  // Substring a benchmark name must contain
+    std::string jsonPath;
+};
+
+inline bool ParseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        if (std::strncmp(arg, "--min-time=", 11) == 0) {
+            options.minTime = std::atof(arg + 11);
+        } else if (std::strncmp(arg, "--repetitions=", 14) == 0) {
+            options.repetitions = std::max(1, std::atoi(arg + 14));
+        } else if (std::strncmp(arg, "--filter=", 9) == 0) {
+            options.filter = arg + 9;
+        } else if (std::strncmp(arg, "--json=", 7) == 0) {
+            options.jsonPath = arg + 7;
+        } else {
+            std::fprintf(stderr, "Usage: %s [--filter=substr] [--min-time=seconds] [--repetitions=n] [--json=path]\n", argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+inline Result Measure(const Benchmark& benchmark, const Options& options) {
+    typedef std::chrono::steady_clock Clock;
+    auto timeRun = [&](size_t iterations, double& cpuSeconds) {
+        std::clock_t cpuStart = std::clock();
+        Clock::time_point start = Clock::now();
+        benchmark.body(iterations);
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        cpuSeconds     = static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+        return seconds;
+    };
+
+    // Grow the iteration count until one run takes a measurable slice of
+    // minTime, then scale it to fill minTime
+    double cpuSeconds = 0.0;
+    size_t iterations = 1;
+    double seconds    = timeRun(iterations, cpuSeconds);
+    while (seconds < options.minTime / 10 && iterations < (static_cast<size_t>(1) << 40)) {
+        iterations *= 10;
+        seconds = timeRun(iterations, cpuSeconds);
+    }
+    iterations = std::max<size_t>(1, static_cast<size_t>(iterations * options.minTime / std::max(seconds, 1e-9)));
+
+    std::vector<std::pair<double, double>> runs;  // (real, cpu) ns per iteration
+    for (int r = 0; r < options.repetitions; ++r) {
+        double real = timeRun(iterations, cpuSeconds);
+        runs.push_back(std::make_pair(real * 1e9 / iterations, cpuSeconds * 1e9 / iterations));
+    }
+    std::sort(runs.begin(), runs.end());
+
+    Result result;
+    result.name       = benchmark.name;
+    result.iterations = iterations;
+    result.realNs     = runs[runs.size() / 2].first;
+    result.cpuNs      = runs[runs.size() / 2].second;
+    result.minNs      = runs.front().first;
+    result.maxNs      = runs.back().first;
+    return result;
+}
+
+inline std::string JsonEscape(const std::string& text) {
+    std::string out;
+    for (char c : text) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+inline bool WriteJson(const std::string& path, const std::vector<Result>& results, const Options& options) {
+    FILE* file = path == "-" ? stdout : std::fopen(path.c_str(), "w");
+    if (file == nullptr) return false;
+
+    char date[64];
+    std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+    std::fprintf(file, "{\n  \"context\": {\n");
+    std::fprintf(file, "    \"date\": \"%s\",\n", date);
+    std::fprintf(file, "    \"num_cpus\": %u,\n", std::thread::hardware_concurrency());
+#ifdef NDEBUG
+    std::fprintf(file, "    \"library_build_type\": \"release\",\n");
+#else
+    std::fprintf(file, "    \"library_build_type\": \"debug\",\n");
+#endif
+    std::fprintf(file, "    \"min_time\": %g,\n    \"repetitions\": %d\n  },\n", options.minTime, options.repetitions);
+    std::fprintf(file, "  \"benchmarks\": [\n");
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        std::fprintf(file,
+                     "    {\"name\": \"%s\", \"run_name\": \"%s\", \"run_type\": \"iteration\", \"iterations\": %zu, "
+                     "\"real_time\": %.3f, \"cpu_time\": %.3f, \"real_time_min\": %.3f, \"real_time_max\": %.3f, \"time_unit\": \"ns\"}%s\n",
+                     JsonEscape(r.name).c_str(), JsonEscape(r.name).c_str(), r.iterations, r.realNs, r.cpuNs, r.minNs, r.maxNs,
+                     i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(file, "  ]\n}\n");
+    return file == stdout || std::fclose(file) == 0;
+}
+
+// Run every benchmark whose name matches the filter, print a table and
+// optionally write JSON; returns the process exit status
+inline int RunAll(const std::vector<Benchmark>& benchmarks, int argc, char** argv) {
+    Options options;
+    if (!ParseOptions(argc, argv, options)) return 2;
+
+    std::vector<Result> results;
+    FILE* table = options.jsonPath == "-" ? stderr : stdout;  // Keep stdout clean for JSON
+    std::fprintf(table, "%-44s %14s %14s %14s\n", "benchmark", "time/op (ns)", "cpu/op (ns)", "iterations");
+    for (const Benchmark& benchmark : benchmarks) {
+        if (!options.filter.empty() && benchmark.name.find(options.filter) == std::string::npos) continue;
+        Result result = Measure(benchmark, options);
+        std::fprintf(table, "%-44s %14.1f %14.1f %14zu\n", result.name.c_str(), result.realNs, result.cpuNs, result.iterations);
+        results.push_back(result);
+    }
+
+    if (!options.jsonPath.empty() && !WriteJson(options.jsonPath, results, options)) {
+        std::fprintf(stderr, "cannot write %s\n", options.jsonPath.c_str());
+        return 1;
+    }
+    return 0;
+}
+
+}  // namespace bench
@@ -0,0 +1,207 @@
+// Microbenchmarks for the per-keystroke and per-evaluation hot paths: the
+// parser stages, number formatting, calculator key handling and display text
+// truncation. Run with --json=path and compare two runs to spot regressions.
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "../includes/calculator.h"
+#include "../includes/expression_cache.h"
+#include "../includes/incremental_parser.h"
+#include "../includes/parser.h"
+#include "bench_harness.h"
+
+#ifdef CALC_BENCH_TEXT
+#include "../includes/text_layout.h"
+
+// The generated font header relies on raylib types being declared already
+#include "../includes/font_ubuntu.h"
+#endif
+
+using bench::Benchmark;
+using bench::DoNotOptimize;
+
+struct CorpusEntry {
+    const char* name;
+    std::string expression;
+};
+
+// Short: a typical button-entered expression. Long: a ~200 term flat sum of
+// products. Nested: 64 levels of parentheses around function calls
+static std::vector<CorpusEntry> BuildCorpus() {
+    std::string longExpr;
+    for (int i = 0; i < 200; ++i) {
+        if (i > 0) longExpr += (i % 3 == 0) ? "-" : "+";
+        longExpr += std::to_string(i % 97 + 1) + ".25*" + std::to_string(i % 13 + 2);
+    }
+
+    std::string nested;
+    const int depth = 64;
+    for (int i = 0; i < depth; ++i) nested += (i % 2 == 0) ? "sqrt(1+" : "(2*";
+    nested += "3";
+    for (int i = 0; i < depth; ++i) nested += ")";
+
+    std::vector<CorpusEntry> corpus;
+    corpus.push_back(CorpusEntry{"short", "12.5*(3+4)-sin(30)"});
+    corpus.push_back(CorpusEntry{"long", longExpr});
+    corpus.push_back(CorpusEntry{"nested", nested});
+    return corpus;
+}
+
+static void AddParserBenchmarks(std::vector<Benchmark>& benchmarks) {
+    for (const CorpusEntry& entry : BuildCorpus()) {
+        const std::string expr = entry.expression;
+        const std::string tag  = entry.name;
+
+        benchmarks.push_back(Benchmark{"parser/tokenize/" + tag, [expr](size_t iterations) {
+                                           MathParser parser;
+                                           for (size_t i = 0; i < iterations; ++i) {
+                                               EvalResult result = parser.tokenize(expr);
+                                               DoNotOptimize(result);
+                                           }
+                                       }});
+        // toRPN is private; compile without optimization is tokenize + toRPN + assemble
+        benchmarks.push_back(Benchmark{"parser/compile_noopt/" + tag, [expr](size_t iterations) {
+                                           MathParser parser;
+                                           for (size_t i = 0; i < iterations; ++i) {
+                                               CompiledExpression compiled = parser.compile(expr, false);
+                                               DoNotOptimize(compiled);
+                                           }
+                                       }});
+        benchmarks.push_back(Benchmark{"parser/compile/" + tag, [expr](size_t iterations) {
+                                           MathParser parser;
+                                           for (size_t i = 0; i < iterations; ++i) {
+                                               CompiledExpression compiled = parser.compile(expr);
+                                               DoNotOptimize(compiled);
+                                           }
+                                       }});
+        // Running the postfix program alone, the equivalent of computing the RPN
+        benchmarks.push_back(Benchmark{"parser/run_compiled/" + tag, [expr](size_t iterations) {
+                                           MathParser parser;
+                                           CompiledExpression compiled = parser.compile(expr, false);
+                                           for (size_t i = 0; i < iterations; ++i) {
+                                               EvalResult result = compiled.evaluate();
+                                               DoNotOptimize(result);
+                                           }
+                                       }});
+        benchmarks.push_back(Benchmark{"parser/evaluate/" + tag, [expr](size_t iterations) {
+                                           MathParser parser;
+                                           for (size_t i = 0; i < iterations; ++i) {
+                                               EvalResult result = parser.evaluate(expr);
+                                               DoNotOptimize(result);
+                                           }
+                                       }});
+        benchmarks.push_back(Benchmark{"parser/cache_hit/" + tag, [expr](size_t iterations) {
+                                           ExpressionCache cache;
+                                           for (size_t i = 0; i < iterations; ++i) {
+                                               EvalResult result = cache.evaluate(expr);
+                                               DoNotOptimize(result);
+                                           }
+                                       }});
+        // Typing the whole expression one character at a time
+        benchmarks.push_back(Benchmark{"parser/incremental_type/" + tag, [expr](size_t iterations) {
+                                           IncrementalParser input;
+                                           std::string ch(1, ' ');
+                                           for (size_t i = 0; i < iterations; ++i) {
+                                               input.clear();
+                                               for (char c : expr) {
+                                                   ch[0] = c;
+                                                   input.append(ch);
+                                               }
+                                               DoNotOptimize(input.previewResult());
+                                           }
+                                       }});
+    }
+}
+
+static void AddFormatBenchmarks(std::vector<Benchmark>& benchmarks) {
+    struct Case {
+        const char* name;
+        double value;
+    };
+    const Case cases[] = {{"integer", 1234567.0}, {"fraction", 3.14159265358979}, {"large", 6.02214076e23}, {"small", 1.602176634e-19}};
+    for (const Case& c : cases) {
+        const double value = c.value;
+        benchmarks.push_back(Benchmark{std::string("format/") + c.name, [value](size_t iterations) {
+                                           for (size_t i = 0; i < iterations; ++i) {
+                                               std::string text = FormatNumber(value);
+                                               DoNotOptimize(text);
+                                           }
+                                       }});
+    }
+}
+
+// Button ids as HandleButtonPress receives them
+static const int kClear = 101, kBackspace = 102, kSin = 110, kAns = 205;
+
+static void AddCalculatorBenchmarks(std::vector<Benchmark>& benchmarks) {
+    struct Sequence {
+        const char* name;
+        std::vector<int> keys;
+    };
+    const Sequence sequences[] = {
+        {"arithmetic", {'1', '2', '.', '5', '*', '(', '3', '+', '4', ')', '-', '7', '/', '2', '='}},
+        {"function", {kSin, '3', '0', ')', '+', '2', '^', '1', '0', '='}},
+        {"edit", {'9', '8', '7', '+', '6', '5', kBackspace, kBackspace, '4', '3', '2', '*', kAns, '='}},
+    };
+    for (const Sequence& sequence : sequences) {
+        const std::vector<int> keys = sequence.keys;
+        benchmarks.push_back(Benchmark{std::string("calculator/keys/") + sequence.name, [keys](size_t iterations) {
+                                           CalculatorState state;
+                                           for (size_t i = 0; i < iterations; ++i) {
+                                               for (int key : keys) HandleButtonPress(state, key);
+                                               HandleButtonPress(state, kClear);
+                                           }
+                                           DoNotOptimize(state.display);
+                                       }});
+    }
+}
+
+#ifdef CALC_BENCH_TEXT
+static void AddTextBenchmarks(std::vector<Benchmark>& benchmarks) {
+    static const float kDispFontSize = 54.0f;
+    static const float kMaxWidth     = 339.0f;  // Display box width minus margins
+
+    Font font       = {};
+    font.baseSize   = 64;
+    font.glyphCount = 95;
+    font.recs       = fontRecs_FontUbuntu;
+    font.glyphs     = fontGlyphs_FontUbuntu;
+    const GlyphTable glyphs = GlyphTable::build(font);
+
+    const std::string text = "sin(30)+12.5*(7-3)^2/ln(10)-sin(30)+12.5*(7-3)^2/ln(10)";
+    // Same text every frame: served from the truncation cache
+    benchmarks.push_back(Benchmark{"text/truncate/idle", [font, glyphs, text](size_t iterations) {
+                                       TextLayout layout(font, glyphs);
+                                       for (size_t i = 0; i < iterations; ++i) {
+                                           DoNotOptimize(layout.truncateToFit(text, kDispFontSize, kMaxWidth));
+                                       }
+                                   }});
+    // Text changes every frame, as while typing
+    benchmarks.push_back(Benchmark{"text/truncate/typing", [font, glyphs, text](size_t iterations) {
+                                       TextLayout layout(font, glyphs);
+                                       std::string frames[2] = {text, text + "1"};
+                                       for (size_t i = 0; i < iterations; ++i) {
+                                           DoNotOptimize(layout.truncateToFit(frames[i % 2], kDispFontSize, kMaxWidth + (i % 8)));
+                                       }
+                                   }});
+    benchmarks.push_back(Benchmark{"text/measure", [font, glyphs, text](size_t iterations) {
+                                       TextLayout layout(font, glyphs);
+                                       for (size_t i = 0; i < iterations; ++i) {
+                                           Vector2 size = layout.measure(text, kDispFontSize);
+                                           DoNotOptimize(size);
+                                       }
+                                   }});
+}
+#endif
+
+int main(int argc, char** argv) {
+    std::vector<Benchmark> benchmarks;
+    AddParserBenchmarks(benchmarks);
+    AddFormatBenchmarks(benchmarks);
+    AddCalculatorBenchmarks(benchmarks);
+#ifdef CALC_BENCH_TEXT
+    AddTextBenchmarks(benchmarks);
+#endif
+    return bench::RunAll(benchmarks, argc, argv);
+}
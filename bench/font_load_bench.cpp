@@ -0,0 +1,111 @@
+// Startup cost of getting the font atlas into memory. For the embedded font:
+// raylib's DecompressData, which callocs a 64 MB scratch buffer and shrinks it
+// afterwards, versus inflating straight into a buffer of the size recorded at
+// build time. For the font file used by debug builds: rasterizing it and
+// writing the atlas cache, versus mapping an existing cache. Peak memory is
+// per process, so compare it with one mode per run:
+//   font_load_bench legacy
+//   font_load_bench exact
+//   font_load_bench cold
+//   font_load_bench warm
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "../includes/font_cache.h"
+#include "../includes/process_stats.h"
+#include "../raylib/src/external/sinfl.h"
+#include "../raylib/src/raylib.h"
+
+// The generated font header relies on raylib types being declared already
+#include "../includes/font_ubuntu.h"
+
+// Peak virtual size of this process in bytes (Linux only), or 0 if unknown
+static size_t PeakVirtualBytes() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 7, "VmPeak:") == 0) return std::stoul(line.substr(7)) * 1024;
+    }
+    return 0;
+}
+
+static size_t LegacyLoad() {
+    int size            = 0;
+    unsigned char* data = DecompressData(fontData_FontUbuntu, COMPRESSED_DATA_SIZE_FONT_FONTUBUNTU, &size);
+    size_t checksum     = data != nullptr ? data[size / 2] + static_cast<size_t>(size) : 0;
+    MemFree(data);
+    return checksum;
+}
+
+static size_t ExactLoad() {
+    std::unique_ptr<unsigned char[]> pixels(new unsigned char[DECOMPRESSED_DATA_SIZE_FONT_FONTUBUNTU]);  // Not zero-filled
+    int size = sinflate(pixels.get(), DECOMPRESSED_DATA_SIZE_FONT_FONTUBUNTU, fontData_FontUbuntu, COMPRESSED_DATA_SIZE_FONT_FONTUBUNTU);
+    return pixels[DECOMPRESSED_DATA_SIZE_FONT_FONTUBUNTU / 2] + static_cast<size_t>(size);
+}
+
+// Same font and size as a debug build's main(), run from the build directory
+static const char* const fontFile = "resource/Ubuntu-Regular.ttf";
+static const int fontFileSize     = 64;
+
+static size_t CachedLoad() {
+    FontAtlasCache cache;
+    if (!cache.load(fontFile, fontFileSize)) return 0;
+    const Image& atlas = cache.atlas();
+    return static_cast<size_t>(atlas.width) + static_cast<const unsigned char*>(atlas.data)[atlas.width * 2] + cache.hit();
+}
+
+static size_t ColdLoad() {
+    std::remove(FontAtlasCache::pathFor(fontFile, fontFileSize).c_str());
+    return CachedLoad();
+}
+
+struct Mode {
+    const char* name;
+    size_t (*load)();
+};
+
+static const Mode modes[] = {
+    {"legacy", LegacyLoad},
+    {"exact", ExactLoad},
+    {"cold", ColdLoad},
+    {"warm", CachedLoad},
+};
+
+int main(int argc, char** argv) {
+    const Mode* mode = nullptr;
+    for (const Mode& candidate : modes) {
+        if (argc > 1 && std::strcmp(argv[1], candidate.name) == 0) mode = &candidate;
+    }
+    if (mode == nullptr) {
+        std::fprintf(stderr, "Usage: %s legacy|exact|cold|warm [repeats]\n", argv[0]);
+        return 2;
+    }
+    const int repeats = argc > 2 ? std::max(1, std::atoi(argv[2])) : 50;
+
+    SetTraceLogLevel(LOG_WARNING);
+    size_t (*load)() = mode->load;
+
+    // A warm start needs the cache to exist already
+    if (load == CachedLoad && CachedLoad() == 0) {
+        std::fprintf(stderr, "Cannot load %s\n", fontFile);
+        return 1;
+    }
+
+    // The first load is the one startup pays for; later ones show steady state
+    auto start        = std::chrono::steady_clock::now();
+    size_t checksum   = load();
+    double firstMs    = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    start             = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeats; ++i) checksum += load();
+    double averageMs  = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / repeats;
+
+    std::printf("%-8s first %.2f ms, average %.2f ms, peak RSS %.1f MiB, peak virtual %.1f MiB (checksum %zu)\n", mode->name,
+                firstMs, averageMs, PeakRssBytes() / (1024.0 * 1024.0), PeakVirtualBytes() / (1024.0 * 1024.0), checksum);
+    return 0;
+}
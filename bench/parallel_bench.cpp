@@ -0,0 +1,52 @@
+// Scaling of ParallelBatchEvaluator from one thread up to every core
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "../includes/batch_evaluator.h"
+#include "../includes/parser.h"
+
+int main(int argc, char** argv) {
+    const size_t points     = argc > 1 ? static_cast<size_t>(std::strtoull(argv[1], nullptr, 10)) : 8000000;
+    const size_t maxThreads = std::max<size_t>(1, std::thread::hardware_concurrency());
+    const int repetitions   = 5;
+
+    MathParser parser;
+    CompiledExpression expression = parser.compile("sin(x)*cos(y)+sqrt(x*x+y*y)/(1+exp(-x/100))");
+
+    std::vector<double> xs(points), ys(points);
+    for (size_t i = 0; i < points; ++i) {
+        xs[i] = static_cast<double>(i % 3600) * 0.1;
+        ys[i] = static_cast<double>(i % 1000) * 0.5 - 250.0;
+    }
+    const double* columns[] = {xs.data(), ys.data()};
+
+    std::vector<double> reference(points);
+    expression.evaluateBatch(columns, points, reference.data());
+
+    std::printf("%zu points, best of %d runs\n", points, repetitions);
+    std::printf("%-8s %14s %10s %10s\n", "threads", "Mpoints/s", "speedup", "identical");
+
+    double baseline = 0.0;
+    for (size_t threads = 1; threads <= maxThreads; threads *= 2) {
+        ParallelBatchEvaluator evaluator(threads);
+        std::vector<double> out(points);
+
+        double best = 1e30;
+        for (int run = 0; run < repetitions; ++run) {
+            auto start = std::chrono::steady_clock::now();
+            evaluator.evaluate(expression, columns, points, out.data());
+            best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        }
+
+        double rate = static_cast<double>(points) / best / 1e6;
+        if (threads == 1) baseline = rate;
+        bool identical = std::memcmp(out.data(), reference.data(), points * sizeof(double)) == 0;
+        std::printf("%-8zu %14.1f %9.2fx %10s\n", threads, rate, rate / baseline, identical ? "yes" : "NO");
+
+        if (threads < maxThreads && threads * 2 > maxThreads) threads = maxThreads / 2;
+    }
+    return 0;
+}
@@ -0,0 +1,117 @@
+// Per-frame text cost of Display::draw: the original MeasureTextEx-based
+// truncation and DrawTextEx glyph lookups versus TextLayout with the glyph
+// table. Runs without a window; the embedded font's metrics are used as-is
+// and drawing is reduced to resolving each glyph, which is the part that
+// changed (the quads submitted are identical).
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "../includes/text_layout.h"
+
+// The generated font header relies on raylib types being declared already
+#include "../includes/font_ubuntu.h"
+
+static const float kDispFontSize = 54.0f;
+static const float kMaxWidth     = 339.0f;  // Display box width minus margins
+
+// Copy of the original Display::truncateToFit, kept as the baseline
+static std::string LegacyTruncateToFit(const Font& font, const std::string& text, float fontSize, float maxWidth) {
+    std::string result = text;
+    Vector2 size       = MeasureTextEx(font, result.c_str(), fontSize, 0);
+    while (size.x > maxWidth && result.length() > 1) {
+        result.erase(0, 1);
+        size = MeasureTextEx(font, result.c_str(), fontSize, 0);
+    }
+    if (result != text && result.length() > 1) {
+        result[0] = '.';
+    }
+    return result;
+}
+
+// Glyph lookups DrawTextEx makes: one of its own plus one in DrawTextCodepoint
+static long LegacyResolveGlyphs(const Font& font, const std::string& text) {
+    long checksum = 0;
+    for (char c : text) {
+        checksum += GetGlyphIndex(font, c);
+        if (c != ' ') checksum += GetGlyphIndex(font, c);
+    }
+    return checksum;
+}
+
+static long TableResolveGlyphs(const TextLayout& layout, const std::string& text) {
+    long checksum = 0;
+    for (char c : text) {
+        int index = layout.glyphIndex(c);
+        checksum += index;
+        if (c != ' ') checksum += index;
+    }
+    return checksum;
+}
+
+// Expression as it looks after each keystroke of typing it out
+static std::vector<std::string> TypingFrames(size_t length) {
+    const std::string pattern = "sin(30)+12.5*(7-3)^2/ln(10)-";
+    std::vector<std::string> frames;
+    std::string expr;
+    while (expr.size() < length) {
+        expr += pattern[expr.size() % pattern.size()];
+        frames.push_back(expr);
+    }
+    return frames;
+}
+
+template <typename Fn>
+static double NanosecondsPerFrame(Fn drawFrame, const std::vector<std::string>& frames, size_t repeats) {
+    long sink  = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < repeats; ++r) {
+        for (const std::string& text : frames) {
+            sink += drawFrame(text);
+        }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (sink == 42) std::printf(" ");  // Keep the work observable
+    return seconds * 1e9 / static_cast<double>(repeats * frames.size());
+}
+
+int main() {
+    Font font       = {};
+    font.baseSize   = 64;
+    font.glyphCount = 95;
+    font.recs       = fontRecs_FontUbuntu;
+    font.glyphs     = fontGlyphs_FontUbuntu;
+
+    TextLayout layout(font, GlyphTable::build(font));
+
+    auto legacyFrame = [&](const std::string& text) {
+        std::string shown = LegacyTruncateToFit(font, text, kDispFontSize, kMaxWidth);
+        Vector2 size      = MeasureTextEx(font, shown.c_str(), kDispFontSize, 0);
+        return LegacyResolveGlyphs(font, shown) + static_cast<long>(size.x);
+    };
+    auto layoutFrame = [&](const std::string& text) {
+        const std::string& shown = layout.truncateToFit(text, kDispFontSize, kMaxWidth);
+        Vector2 size             = layout.measure(shown, kDispFontSize);
+        return TableResolveGlyphs(layout, shown) + static_cast<long>(size.x);
+    };
+
+    const size_t lengths[] = {8, 32, 128, 512};
+
+    std::printf("%-8s %-8s %14s %14s %8s\n", "chars", "frames", "legacy ns/f", "layout ns/f", "speedup");
+    for (size_t length : lengths) {
+        // Typing: the text changes every frame, so nothing is cached
+        std::vector<std::string> typing = TypingFrames(length);
+        size_t repeats                  = 200000 / (length * length / 8 + 1) + 1;
+        double legacy                   = NanosecondsPerFrame(legacyFrame, typing, repeats);
+        double table                    = NanosecondsPerFrame(layoutFrame, typing, repeats);
+        std::printf("%-8zu %-8s %14.0f %14.0f %7.2fx\n", length, "typing", legacy, table, legacy / table);
+
+        // Idle: the same text redrawn every frame
+        std::vector<std::string> idle(1, typing.back());
+        legacy = NanosecondsPerFrame(legacyFrame, idle, repeats * 8);
+        table  = NanosecondsPerFrame(layoutFrame, idle, repeats * 8);
+        std::printf("%-8zu %-8s %14.0f %14.0f %7.2fx\n", length, "idle", legacy, table, legacy / table);
+    }
+    return 0;
+}
@@ -0,0 +1,93 @@
+// Tokenizer throughput: the string-per-token tokenizer MathParser used to
+// have versus the span-based tokenizer writing into a reused buffer.
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "../includes/parser.h"
+
+// Copy of the original MathParser::tokenize, kept as the baseline
+static std::vector<std::string> LegacyTokenize(const std::string& expr) {
+    auto isOperator = [](const std::string& token) { return token == "+" || token == "-" || token == "*" || token == "/" || token == "^"; };
+
+    std::vector<std::string> tokens;
+    for (size_t i = 0; i < expr.length(); ++i) {
+        char c = expr[i];
+        if (isspace(c)) continue;
+
+        if (c == '-' && (tokens.empty() || tokens.back() == "(" || isOperator(tokens.back()))) {
+            std::string num_str = "-";
+            i++;
+            while (i < expr.length() && (isdigit(expr[i]) || expr[i] == '.')) {
+                num_str += expr[i];
+                i++;
+            }
+            i--;
+            tokens.push_back(num_str);
+        } else if (isdigit(c) || c == '.') {
+            std::string num_str;
+            while (i < expr.length() && (isdigit(expr[i]) || expr[i] == '.')) {
+                num_str += expr[i];
+                i++;
+            }
+            i--;
+            tokens.push_back(num_str);
+        } else if (isalpha(c)) {
+            std::string func_str;
+            while (i < expr.length() && isalpha(expr[i])) {
+                func_str += expr[i];
+                i++;
+            }
+            i--;
+            tokens.push_back(func_str);
+        } else {
+            tokens.push_back(std::string(1, c));
+        }
+    }
+    return tokens;
+}
+
+// Builds a long "pasted" expression of roughly the requested token count
+static std::string MakeExpression(size_t terms) {
+    std::string expr;
+    for (size_t i = 0; i < terms; ++i) {
+        if (i > 0) expr += (i % 3 == 0) ? " + " : (i % 3 == 1 ? "*" : "-");
+        expr += (i % 5 == 0) ? "sqrt(" + std::to_string(i * 7 + 1) + ".25)" : std::to_string(i * 13 + 3);
+    }
+    return expr;
+}
+
+template <typename Fn>
+static double MeasureTokensPerSecond(Fn tokenizeOnce, size_t iterations) {
+    size_t tokenCount = 0;
+    auto start        = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        tokenCount += tokenizeOnce();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return static_cast<double>(tokenCount) / seconds;
+}
+
+int main() {
+    const size_t sizes[] = {8, 64, 512, 4096};
+
+    std::printf("%-8s %-8s %16s %16s %8s\n", "terms", "tokens", "legacy tok/s", "span tok/s", "speedup");
+    for (size_t terms : sizes) {
+        const std::string expr  = MakeExpression(terms);
+        const size_t iterations = 2000000 / terms;
+
+        MathParser parser;
+        double legacy = MeasureTokensPerSecond([&]() { return LegacyTokenize(expr).size(); }, iterations);
+        double span   = MeasureTokensPerSecond(
+            [&]() {
+                parser.tokenize(expr);
+                return parser.tokenBuffer().size();
+            },
+            iterations);
+
+        std::printf("%-8zu %-8zu %16.0f %16.0f %7.2fx\n", terms, parser.tokenBuffer().size(), legacy, span, span / legacy);
+    }
+    return 0;
+}
@@ -0,0 +1,37 @@
+# Optional microbenchmarks (not built by default)
+option(BUILD_BENCHMARKS "Build parser and rendering microbenchmarks" OFF)
+
+if(BUILD_BENCHMARKS)
+    add_executable(tokenizer_bench bench/tokenizer_bench.cpp)
+    target_link_libraries(tokenizer_bench PRIVATE calc_core)
+
+    add_executable(parallel_bench bench/parallel_bench.cpp)
+    target_link_libraries(parallel_bench PRIVATE calc_core)
+
+    # Regression suite: calc_bench --json=before.json, then diff against a later run
+    add_executable(calc_bench bench/calc_bench.cpp)
+    target_link_libraries(calc_bench PRIVATE calc_core)
+
+    # Needs raylib for the font metrics it measures against
+    if(CALC_BUILD_GUI)
+        add_executable(text_bench
+            bench/text_bench.cpp
+            src/coverage_shader.cpp
+            src/glyph_table.cpp
+            src/text_layout.cpp
+        )
+        target_include_directories(text_bench PRIVATE includes)
+        target_link_libraries(text_bench PRIVATE raylib)
+        add_dependencies(text_bench generate_resources)
+
+        add_executable(font_load_bench bench/font_load_bench.cpp src/font_cache.cpp src/mapped_file.cpp)
+        target_link_libraries(font_load_bench PRIVATE calc_core calc_resources raylib)
+        add_dependencies(font_load_bench generate_resources)
+
+        # Display text benchmarks in calc_bench need the same font and raylib
+        target_sources(calc_bench PRIVATE src/coverage_shader.cpp src/glyph_table.cpp src/text_layout.cpp)
+        target_compile_definitions(calc_bench PRIVATE CALC_BENCH_TEXT)
+        target_link_libraries(calc_bench PRIVATE raylib)
+        add_dependencies(calc_bench generate_resources)
+    endif()
+endif()
@@ -0,0 +1,10 @@
+# Turns one binary blob into a C source defining it as a const byte array,
+# for compilers without .incbin (MSVC). Run as a script:
+#   cmake -DINPUT=blob.bin -DOUTPUT=blob.c -DSYMBOL=name -P bin2c.cmake
+file(READ ${INPUT} hex HEX)
+
+# 32 bytes per line, then every byte pair as 0xNN
+string(REGEX REPLACE "(................................................................)" "\\1\n" hex "${hex}")
+string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," hex "${hex}")
+
+file(WRITE ${OUTPUT} "// Generated from ${INPUT} by bin2c.cmake; do not edit\nconst unsigned char ${SYMBOL}[] = {\n${hex}\n};\n")
@@ -0,0 +1,15 @@
+# Runs calc_cli over a fixture file and compares its whole stdout with the
+# expected file. Run as a script:
+#   cmake -DCLI=calc_cli "-DARGS=-j 4" -DINPUT=case.txt -DEXPECTED=case.expected -P cli_check.cmake
+# Exit status 1 (some line failed) is part of the expected behaviour; anything
+# higher is a usage or I/O error
+separate_arguments(args UNIX_COMMAND "${ARGS}")
+execute_process(COMMAND ${CLI} ${args} ${INPUT} OUTPUT_VARIABLE output ERROR_VARIABLE errors RESULT_VARIABLE status)
+file(READ ${EXPECTED} expected)
+
+if(NOT status MATCHES "^[01]$")
+    message(FATAL_ERROR "calc_cli ${ARGS} ${INPUT} exited with ${status}: ${errors}")
+endif()
+if(NOT output STREQUAL expected)
+    message(FATAL_ERROR "calc_cli ${ARGS} ${INPUT}: output differs from ${EXPECTED}\n--- expected\n${expected}--- got\n${output}")
+endif()
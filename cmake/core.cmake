@@ -0,0 +1,49 @@
+# Calculator logic shared by the GUI, the headless CLI and the benchmarks.
+# Nothing here depends on raylib or a display
+find_package(Threads REQUIRED)
+
+add_library(calc_core STATIC
+    src/calculator.cpp
+    src/number_format.cpp
+    src/parser.cpp
+    src/process_stats.cpp
+    src/expression_cache.cpp
+    src/incremental_parser.cpp
+    src/thread_pool.cpp
+    src/batch_evaluator.cpp
+    src/stream_evaluator.cpp
+)
+target_include_directories(calc_core PUBLIC includes)
+target_link_libraries(calc_core PUBLIC Threads::Threads)
+
+if(IS_WINDOWS)
+    target_link_libraries(calc_core PUBLIC psapi)
+else()
+    target_link_libraries(calc_core PUBLIC m)
+endif()
+
+# Headless evaluator: expressions from stdin or files, results on stdout
+add_executable(calc_cli src/cli.cpp)
+target_link_libraries(calc_cli PRIVATE calc_core)
+
+# End-to-end checks through calc_cli: ctest --test-dir <build>
+enable_testing()
+function(add_cli_check name fixture)
+    string(REPLACE ";" " " args "${ARGN}")
+    add_test(NAME ${name}
+        COMMAND ${CMAKE_COMMAND} -DCLI=$<TARGET_FILE:calc_cli> "-DARGS=${args}"
+                -DINPUT=${CMAKE_CURRENT_SOURCE_DIR}/tests/cli/${fixture}.txt
+                -DEXPECTED=${CMAKE_CURRENT_SOURCE_DIR}/tests/cli/${fixture}.expected
+                -P ${CMAKE_CURRENT_SOURCE_DIR}/cmake/cli_check.cmake
+    )
+endfunction()
+
+add_cli_check(cli_precedence precedence)
+add_cli_check(cli_errors errors)
+add_cli_check(cli_edits edits)
+add_cli_check(cli_edits_incremental edits --incremental)
+add_cli_check(cli_batch_nan batch_rows --batch "sqrt(x)/y" -j 2)
+add_cli_check(cli_order order -j 4 --chunk 64 -c 0)
+add_cli_check(cli_format format)
+add_cli_check(cli_rounding_p0 rounding_p0 -p 0)
+add_cli_check(cli_rounding_p1 rounding_p1 -p 1)
@@ -0,0 +1,29 @@
+# raylib's image, text and file modules without a windowing platform: rcore.c
+# is built with no PLATFORM_* define and src/headless_platform.c stands in for
+# the backend. Needs neither GLFW nor X11 headers, so the exporter builds and
+# runs on machines that cannot build the GUI
+set(RAYLIB_SOURCE_DIR ${CMAKE_CURRENT_SOURCE_DIR}/raylib/src)
+add_library(raylib_headless STATIC
+    ${RAYLIB_SOURCE_DIR}/rcore.c
+    ${RAYLIB_SOURCE_DIR}/rshapes.c
+    ${RAYLIB_SOURCE_DIR}/rtext.c
+    ${RAYLIB_SOURCE_DIR}/rtextures.c
+    ${RAYLIB_SOURCE_DIR}/utils.c
+    src/headless_platform.c
+)
+target_compile_definitions(raylib_headless PRIVATE GRAPHICS_API_OPENGL_33)
+target_include_directories(raylib_headless PRIVATE ${RAYLIB_SOURCE_DIR})
+if(IS_WINDOWS)
+    target_compile_definitions(raylib_headless PRIVATE _CRT_SECURE_NO_WARNINGS)
+    target_link_libraries(raylib_headless PUBLIC winmm)
+elseif(IS_LINUX)
+    target_link_libraries(raylib_headless PUBLIC m)
+endif()
+
+# calc_core provides the thread pool the exporter rasterizes glyphs on.
+# Headless builds only build it on request: cmake --build build --target resource_exporter
+add_executable(resource_exporter src/resource_exporter.cpp)
+target_link_libraries(resource_exporter raylib_headless calc_core)
+if(NOT CALC_BUILD_GUI)
+    set_target_properties(resource_exporter raylib_headless PROPERTIES EXCLUDE_FROM_ALL ON)
+endif()
@@ -2,39 +2,61 @@ if(CMAKE_BUILD_TYPE STREQUAL "Release")
     add_definitions(-DRELEASE_BUILD)
 endif()
 
-add_executable(resource_exporter src/resource_exporter.cpp)
-target_link_libraries(resource_exporter raylib)
-
+# Small headers with sizes, layout and glyph tables
 set(EMBEDDED_RESOURCE_FILES
     ${CMAKE_CURRENT_SOURCE_DIR}/includes/font_ubuntu.h
     ${CMAKE_CURRENT_SOURCE_DIR}/includes/icon_calc.h
 )
 
+# The asset bytes themselves, linked in by calc_resources below
+set(EMBEDDED_BLOB_DIR ${CMAKE_CURRENT_SOURCE_DIR}/includes)
+set(EMBEDDED_BLOBS
+    ${EMBEDDED_BLOB_DIR}/font_ubuntu.bin
+    ${EMBEDDED_BLOB_DIR}/icon_calc.bin
+)
+
 file(MAKE_DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR}/includes)
 
-add_custom_command(
-    OUTPUT ${EMBEDDED_RESOURCE_FILES}
+# Runs on every build. The exporter regenerates any header or blob that is
+# missing or was made from other inputs and leaves the rest untouched, which
+# takes about a millisecond, so dependents rebuild only when an asset changed
+add_custom_target(generate_resources ALL
     COMMAND resource_exporter
+    BYPRODUCTS ${EMBEDDED_RESOURCE_FILES} ${EMBEDDED_BLOBS}
     WORKING_DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR}
-    DEPENDS resource_exporter ${CMAKE_CURRENT_SOURCE_DIR}/resource/Ubuntu-Regular.ttf ${CMAKE_CURRENT_SOURCE_DIR}/resource/calc.png
-    COMMENT "Generating embedded resource files"
+    COMMENT "Checking embedded resource files"
     VERBATIM
 )
 
-add_custom_target(generate_resources ALL DEPENDS ${EMBEDDED_RESOURCE_FILES})
-
-add_executable(fix_headers src/fix_generated_headers.cpp)
-target_link_libraries(fix_headers PRIVATE raylib)
-
-add_custom_command(
-    OUTPUT ${CMAKE_CURRENT_BINARY_DIR}/headers_fixed.stamp
-    COMMAND fix_headers
-    WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR}
-    DEPENDS generate_resources fix_headers
-    COMMENT "Fixing generated headers"
-)
+# Blobs go into the binary without being parsed as C arrays: GNU-style
+# assemblers pull them in with .incbin, MSVC compiles a C array generated
+# once per blob change
+if(MSVC)
+    set(EMBEDDED_BLOB_SOURCES)
+    foreach(blob font_ubuntu:fontData_FontUbuntu icon_calc:ICON_CALC_DATA)
+        string(REPLACE ":" ";" blob ${blob})
+        list(GET blob 0 blobName)
+        list(GET blob 1 blobSymbol)
+        set(blobSource ${CMAKE_CURRENT_BINARY_DIR}/${blobName}_blob.c)
+        add_custom_command(
+            OUTPUT ${blobSource}
+            COMMAND ${CMAKE_COMMAND} -DINPUT=${EMBEDDED_BLOB_DIR}/${blobName}.bin -DOUTPUT=${blobSource} -DSYMBOL=${blobSymbol}
+                    -P ${CMAKE_CURRENT_SOURCE_DIR}/cmake/bin2c.cmake
+            DEPENDS ${EMBEDDED_BLOB_DIR}/${blobName}.bin ${CMAKE_CURRENT_SOURCE_DIR}/cmake/bin2c.cmake
+            COMMENT "Converting ${blobName}.bin to a C array"
+            VERBATIM
+        )
+        list(APPEND EMBEDDED_BLOB_SOURCES ${blobSource})
+    endforeach()
+else()
+    enable_language(ASM)
+    configure_file(src/embedded_blobs.S.in ${CMAKE_CURRENT_BINARY_DIR}/embedded_blobs.S @ONLY)
+    set(EMBEDDED_BLOB_SOURCES ${CMAKE_CURRENT_BINARY_DIR}/embedded_blobs.S)
+    set_source_files_properties(${EMBEDDED_BLOB_SOURCES} PROPERTIES OBJECT_DEPENDS "${EMBEDDED_BLOBS}")
+endif()
 
-add_custom_target(fix_headers_target ALL DEPENDS ${CMAKE_CURRENT_BINARY_DIR}/headers_fixed.stamp)
+add_library(calc_resources STATIC ${EMBEDDED_BLOB_SOURCES})
+add_dependencies(calc_resources generate_resources)
 
 file(MAKE_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR}/resource)
 configure_file(
@@ -47,4 +69,4 @@ configure_file(
     ${CMAKE_CURRENT_SOURCE_DIR}/resource/calc.png
     ${CMAKE_CURRENT_BINARY_DIR}/resource/calc.png
     COPYONLY
-)
\ No newline at end of file
+)
@@ -0,0 +1,31 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+#include "parser.h"
+#include "thread_pool.h"
+
+// Evaluates a compiled expression over large input ranges by splitting the
+// points across a work-stealing thread pool. Every range writes its own
+// slice of the output, so results are identical to a single-threaded run.
+class ParallelBatchEvaluator {
+   public:
+    // threadCount of 0 uses one thread per hardware core
+    explicit ParallelBatchEvaluator(size_t threadCount = 0, size_t grain = 16384);
+
+    // Same contract as CompiledExpression::evaluateBatch
+    EvalError evaluate(const CompiledExpression& expression, const double* const* columns, size_t count, double* out);
+
+    size_t threadCount() const { return pool.size(); }
+
+   private:
+    // Per-worker state reused across calls
+    struct WorkerScratch {
+        std::vector<double> stack;
+        std::vector<const double*> columns;
+    };
+
+    ThreadPool pool;
+    std::vector<WorkerScratch> scratch;
+    size_t grain;
+};
@@ -1,9 +1,15 @@
 #pragma once
 #include <cmath>
+#include <cstdint>
 #include <string>
 #include <vector>
 
 #include "../raylib/src/raylib.h"
+#include "render_layer.h"
+#include "text_layout.h"
+
+// Button categories for visual styling
+enum class ButtonCategory : uint8_t { NUMBER, OPERATOR, FUNCTION, CONTROL, SPECIAL };
 
 struct Button {
     Rectangle rect;
@@ -12,9 +18,20 @@ struct Button {
     Texture2D* texture;
     int fontSize;
     Vector2 labelSize;
+    ButtonCategory category;  // Resolved once by CreateButtons
+    Color background;         // Idle colors for the current theme, set by ApplyButtonTheme
+    Color textColor;
 
     Button(Rectangle r, std::string l, int i, const Font& font, Texture2D* tex = nullptr)
-        : rect(r), label(std::move(l)), id(i), texture(tex), fontSize(0), labelSize() {
+        : rect(r),
+          label(std::move(l)),
+          id(i),
+          texture(tex),
+          fontSize(0),
+          labelSize(),
+          category(ButtonCategory::NUMBER),
+          background(),
+          textColor() {
         fontSize  = (label.length() > 2) ? 16 : ((label.length() > 1) ? 18 : 22);
         labelSize = MeasureTextEx(font, label.c_str(), static_cast<float>(fontSize), 0.0f);
     }
@@ -29,4 +46,46 @@ struct Button {
 };
 
 std::vector<Button> CreateButtons(int btnW, int btnH, int margin, int topOffset, int leftOffset, const Font& font);
-void DrawButtons(const std::vector<Button>& buttons, const Font& font, Vector2 mouse, bool isDarkMode = false);
+
+// Resolve each button's idle colors for a theme; call when the theme changes
+void ApplyButtonTheme(std::vector<Button>& buttons, bool isDarkMode);
+
+// Maps a point to the button under it. Layouts from CreateButtons form a
+// regular grid and resolve in O(1) by row/column arithmetic; any other
+// layout falls back to testing every rectangle
+class ButtonHitIndex {
+   public:
+    explicit ButtonHitIndex(const std::vector<Button>& buttons);
+
+    // Index into the buttons vector of the button containing point, or -1
+    int find(Vector2 point) const;
+
+   private:
+    bool regular{false};
+    float originX{0.0f};
+    float originY{0.0f};
+    float pitchX{0.0f};  // Distance between neighbouring columns/rows
+    float pitchY{0.0f};
+    float cellWidth{0.0f};
+    float cellHeight{0.0f};
+    int columns{0};
+    int rows{0};
+    std::vector<Rectangle> rects;  // Only kept for irregular layouts
+};
+
+// Button grid pre-rendered into a texture once per theme. Each frame draws it
+// with one textured quad plus the hovered button on top, instead of issuing
+// every button's shapes and text again
+class ButtonLayer {
+   public:
+    // hovered is an index into buttons, or -1
+    void draw(const std::vector<Button>& buttons, const TextLayout& text, int hovered, bool isDarkMode, Color background);
+
+    // Release the texture; must run before CloseWindow
+    void unload() { layer.unload(); }
+
+   private:
+    RenderLayer layer;
+    Rectangle bounds{};  // Screen area covered by the layer
+    bool renderedDark{false};
+};
\ No newline at end of file
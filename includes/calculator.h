@@ -1,7 +1,11 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <vector>
 
+#include "incremental_parser.h"
+#include "parser.h"
+
 struct CalculatorState {
     std::string display{"0"};
     std::string expression;
@@ -15,7 +19,14 @@ struct CalculatorState {
     bool isDarkMode{false};
     bool errorState{false};
     std::string errorMessage;
+    uint64_t generation{0};  // Bumped on every button press so views can skip unchanged state
+    IncrementalParser input;  // Parse state kept in step with expression
+    MathParser parser;        // Full parse, for the diagnostics of incomplete input
     CalculatorState() = default;
 };
 
+// Format a number for display, removing trailing zeros and decimal point if
+// needed; see FormatNumberTo for the allocation-free form
+std::string FormatNumber(double value, int precision = 10);
+
 void HandleButtonPress(CalculatorState& state, int buttonId);
\ No newline at end of file
@@ -0,0 +1,16 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// 64-bit FNV-1a, used to key caches and generated files on the bytes they
+// were built from. Chain calls by passing the previous result as hash
+const uint64_t fnvOffsetBasis = 14695981039346656037ULL;
+
+inline uint64_t Fnv1a(const void* data, size_t size, uint64_t hash = fnvOffsetBasis) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include "../raylib/src/raylib.h"
+
+// Draws fonts whose atlas stores only glyph coverage, one byte per pixel.
+// raylib samples such a grayscale texture as (c, c, c, 1); this shader takes
+// r * a as coverage and outputs (tint.rgb, tint.a * c), which is exactly what
+// the default shader makes of a gray+alpha atlas texel (255, c). Shapes and
+// gray+alpha atlases render unchanged through it as well
+class CoverageShader {
+   public:
+    CoverageShader() = default;
+
+    CoverageShader(const CoverageShader&)            = delete;
+    CoverageShader& operator=(const CoverageShader&) = delete;
+
+    // Compile the shader for the current OpenGL version. Returns false where
+    // shaders are unavailable or compilation failed; single-channel fonts must
+    // then be expanded to gray+alpha. Needs an OpenGL context
+    bool load();
+    bool loaded() const;
+
+    // Whether text in font has to be drawn through the shader
+    static bool needed(const Font& font) { return font.texture.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE; }
+
+    // Bracket drawing text in font; no-ops for fonts that do not need the shader
+    void begin(const Font& font) const;
+    void end(const Font& font) const;
+
+    // Release the shader; must run before CloseWindow
+    void unload();
+
+   private:
+    Shader shader{};
+};
@@ -1,26 +1,52 @@
 #pragma once
+#include <cstdint>
 #include <string>
+#include <vector>
 
 #include "../raylib/src/raylib.h"
 #include "calculator.h"
+#include "render_layer.h"
+#include "text_layout.h"
 #include "theme.h"
 
 class Display {
    private:
     Rectangle displayBox;
     Font font;
+    TextLayout layout;
     float maxTextWidth;
     float dispFontSize{54.0f};
     float exprFontSize{24.0f};
     float historyFontSize{20.0f};
     float statusFontSize{16.0f};
 
+    // Live result preview, rebuilt only when the calculator generation changes
+    uint64_t previewGeneration{UINT64_MAX};
+    std::string previewText;
+    float previewWidth{0.0f};
+
+    void updatePreview(const CalculatorState& calc);
+
+    // Display box and history lines, re-rendered only when either changes
+    RenderLayer frameLayer;
+    std::vector<std::string> frameHistory;
+    bool frameDark{false};
+    uint64_t frameGeneration{UINT64_MAX};
+
+    void renderFrame(const CalculatorState& calc, const Theme& theme);
+
    public:
-    Display(Rectangle box, Font displayFont);
+    // coverage draws single-channel fonts and must outlive the display
+    Display(Rectangle box, Font displayFont, const GlyphTable& glyphs, const CoverageShader* coverage);
+
+    // Draw the calculator display with all elements; the two info lines are
+    // shown in debug builds only
+    void draw(const CalculatorState& calc, const Theme& theme, const std::string& perfInfo, const std::string& redrawInfo);
 
-    // Draw the calculator display with all elements
-    void draw(const CalculatorState& calc, const Theme& theme, const std::string& perfInfo);
+    // Release cached textures; must run before CloseWindow
+    void unload() { frameLayer.unload(); }
 
-    // Helper function to truncate string to fit width
-    std::string truncateToFit(const std::string& text, float fontSize, float maxWidth) const;
+    // Helper function to truncate string to fit width; the result is cached
+    // and stays valid until the next call
+    const std::string& truncateToFit(const std::string& text, float fontSize, float maxWidth);
 };
\ No newline at end of file
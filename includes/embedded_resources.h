@@ -2,34 +2,77 @@
 #define EMBEDDED_RESOURCES_H
 
 // This header file contains embedded resources for the calculator application
-// Font and image data will be included from generated header files
+// Font and image data are linked in as binary blobs; the generated headers
+// declare them along with their sizes
 
+#include <memory>
+
+#include "../includes/content_hash.h"
 #include "../includes/font_ubuntu.h"
+#include "../includes/glyph_table.h"
 #include "../includes/icon_calc.h"
+// raylib's vendored DEFLATE decoder. Not public API: rcore.c compiles it in
+// because raylib/src/config.h enables SUPPORT_COMPRESSION_API
+#include "../raylib/src/external/sinfl.h"
 #include "../raylib/src/raylib.h"
 
-// Function to load embedded font
-Font LoadEmbeddedFont(void) {
+// Function to load embedded font; also fills glyphs with its codepoint lookup
+// table when given. The atlas is embedded as coverage only, one byte per
+// pixel; keep it that way on the GPU only if a loaded CoverageShader draws the
+// font, otherwise it is expanded to raylib's usual gray+alpha layout. Returns
+// raylib's default font if the embedded atlas does not inflate
+Font LoadEmbeddedFont(GlyphTable* glyphs = nullptr, bool keepSingleChannel = false) {
+    static_assert(ATLAS_FORMAT_FONT_FONTUBUNTU == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, "embedded font atlas must be single-channel");
+
     // Load font from memory
     Font font = {};
 
     // Create a new font from embedded data
-    font.baseSize     = 64;  // From font_ubuntu.h
-    font.glyphCount   = 95;  // From font_ubuntu.h
-    font.glyphPadding = 4;   // From font_ubuntu.h
+    font.baseSize     = BASE_SIZE_FONT_FONTUBUNTU;
+    font.glyphCount   = GLYPH_COUNT_FONT_FONTUBUNTU;
+    font.glyphPadding = GLYPH_PADDING_FONT_FONTUBUNTU;
+
+    // sinflate does not validate its input and can write past the buffer on
+    // corrupt data, so check the blob is the one the header was made for
+    const int atlasSize = DECOMPRESSED_DATA_SIZE_FONT_FONTUBUNTU;
+    const bool intact   = Fnv1a(fontData_FontUbuntu, COMPRESSED_DATA_SIZE_FONT_FONTUBUNTU) == COMPRESSED_DATA_HASH_FONT_FONTUBUNTU;
 
-    // Load texture from memory using the decompressed data
-    int fontDataSize    = 0;
-    unsigned char* data = DecompressData(fontData_FontUbuntu, COMPRESSED_DATA_SIZE_FONT_FONTUBUNTU, &fontDataSize);
-    Image imFont        = {data, 1024, 512, 1, 2};
+    // Inflate into a buffer of exactly the atlas size recorded at build time,
+    // instead of DecompressData's 64 MB scratch allocation, then upload it
+    std::unique_ptr<unsigned char[]> pixels(new unsigned char[atlasSize]);  // Not zero-filled
+    const int inflated = intact ? sinflate(pixels.get(), atlasSize, fontData_FontUbuntu, COMPRESSED_DATA_SIZE_FONT_FONTUBUNTU) : 0;
+    if (inflated != atlasSize) {
+        // Stale or corrupt blob; never upload a partly written atlas
+        TraceLog(LOG_WARNING, "FONT: Embedded atlas inflated to %i bytes, expected %i; using the default font", inflated, atlasSize);
+        font = GetFontDefault();
+        if (glyphs != nullptr) {
+            *glyphs = GlyphTable::build(font);
+        }
+        return font;
+    }
+    Image imFont = {pixels.get(), ATLAS_WIDTH_FONT_FONTUBUNTU, ATLAS_HEIGHT_FONT_FONTUBUNTU, 1, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE};
 
-    font.texture = LoadTextureFromImage(imFont);
-    UnloadImage(imFont);  // Uncompressed data can be unloaded from memory
+    std::unique_ptr<unsigned char[]> grayAlpha;
+    if (!keepSingleChannel) {
+        grayAlpha.reset(new unsigned char[2 * atlasSize]);
+        for (int i = 0; i < atlasSize; ++i) {
+            grayAlpha[2 * i]     = 255;
+            grayAlpha[2 * i + 1] = pixels[i];
+        }
+        imFont.data   = grayAlpha.get();
+        imFont.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+    }
+
+    font.texture = LoadTextureFromImage(imFont);  // Copies to the GPU; the buffers are freed on return
 
     // Assign glyph recs and info data directly
     font.recs   = fontRecs_FontUbuntu;
     font.glyphs = fontGlyphs_FontUbuntu;
 
+    if (glyphs != nullptr) {
+        *glyphs = GlyphTable::build(font);
+    }
+
     return font;
 }
 
@@ -37,7 +80,7 @@ Font LoadEmbeddedFont(void) {
 Image LoadEmbeddedIcon(void) {
     // Create image from embedded data
     Image icon   = {};
-    icon.data    = ICON_CALC_DATA;
+    icon.data    = const_cast<unsigned char*>(ICON_CALC_DATA);  // Read-only; SetWindowIcon copies it
     icon.width   = ICON_CALC_WIDTH;
     icon.height  = ICON_CALC_HEIGHT;
     icon.format  = ICON_CALC_FORMAT;
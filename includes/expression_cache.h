@@ -0,0 +1,43 @@
+#pragma once
+#include <cstddef>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "parser.h"
+
+// LRU memo of normalized expression text -> evaluation outcome. Used by the
+// calc_cli workers, where input lines repeat; the GUI evaluates through
+// IncrementalParser, which already holds the value when '=' is pressed
+class ExpressionCache {
+   public:
+    explicit ExpressionCache(size_t capacity = 64);
+
+    // Evaluate through the cache, parsing only on a miss
+    EvalResult evaluate(const std::string& expression);
+
+    size_t capacity() const { return maxEntries; }
+    size_t size() const { return entries.size(); }
+
+    size_t hits() const { return hitCount; }
+    size_t misses() const { return missCount; }
+
+    void clear();
+
+    // Collapse whitespace runs to one space and close any open parentheses.
+    // Error positions in results still point into the expression as typed
+    static std::string normalize(const std::string& expression);
+
+   private:
+    typedef std::list<std::pair<std::string, EvalResult>> EntryList;
+
+    EntryList entries;  // Most recently used first
+    std::unordered_map<std::string, EntryList::iterator> index;
+    MathParser parser;
+    size_t maxEntries;
+    size_t hitCount{0};
+    size_t missCount{0};
+
+    void evictOverflow();
+};
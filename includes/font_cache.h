@@ -0,0 +1,53 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../includes/mapped_file.h"
+#include "../raylib/src/raylib.h"
+
+// Rasterized font atlas (glyph metrics and atlas pixels) kept on disk next to
+// the font file, so file-based builds rasterize with stb_truetype only once.
+// The cache is keyed by a hash of the font file's bytes, the pixel size and
+// the raylib version; a warm load maps the cache file and uploads its pixels
+// without copying them
+class FontAtlasCache {
+   public:
+    FontAtlasCache() = default;
+    ~FontAtlasCache();
+
+    FontAtlasCache(const FontAtlasCache&)            = delete;
+    FontAtlasCache& operator=(const FontAtlasCache&) = delete;
+
+    // Read the atlas for fileName at fontSize from the cache, or rasterize it
+    // and rewrite the cache. False if the font file itself cannot be loaded
+    bool load(const char* fileName, int fontSize);
+
+    // Whether the last load came from an existing cache file
+    bool hit() const { return cacheHit; }
+
+    // Atlas pixels, valid until the next load or destruction
+    const Image& atlas() const { return image; }
+
+    // Hand over the glyphs and recs, allocated the way UnloadFont frees them.
+    // The texture is left for the caller to load from atlas()
+    Font takeFont();
+
+    // Cache file used for fileName at fontSize
+    static std::string pathFor(const char* fileName, int fontSize);
+
+   private:
+    Font font{};
+    Image image{};
+    bool cacheHit = false;
+    MappedFile mapping;
+    std::vector<unsigned char> built;  // Cache contents rasterized by this load
+
+    void reset();
+    bool parse(const unsigned char* data, size_t size, uint64_t key);
+    bool rasterize(const unsigned char* fileData, size_t dataSize, int fontSize, uint64_t key);
+};
+
+// Drop-in for LoadFontEx(fileName, fontSize, 0, 0) that goes through the atlas
+// cache; falls back to LoadFontEx if the cache cannot be used at all
+Font LoadFontCached(const char* fileName, int fontSize);
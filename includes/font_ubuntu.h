@@ -1,1730 +1,219 @@
 #pragma once
-////////////////////////////////////////////////////////////////////////////////////////
-//                                                                                    //
-// FontAsCode exporter v1.0 - Font data exported as an array of bytes                 //
-//                                                                                    //
-// more info and bugs-report:  github.com/raysan5/raylib                              //
-// feedback and support:       ray[at]raylib.com                                      //
-//                                                                                    //
-// Copyright (c) 2018-2025 Ramon Santamaria (@raysan5)                                //
-//                                                                                    //
-// ---------------------------------------------------------------------------------- //
-//                                                                                    //
-// TODO: Fill the information and license of the exported font here:                  //
-//                                                                                    //
-// Font name:    ....                                                                 //
-// Font creator: ....                                                                 //
-// Font LICENSE: ....                                                                 //
-//                                                                                    //
-////////////////////////////////////////////////////////////////////////////////////////
+// Source hash: a6928f7a51fb1f6a
+// Generated by resource_exporter; do not edit.
+// Glyph atlas stored as coverage only, one byte per pixel, DEFLATE-compressed.
+// Draw it through CoverageShader or expand it to gray+alpha, see LoadEmbeddedFont.
+// Needs raylib's Rectangle and GlyphInfo declared before it is included.
+// The atlas is linked from font_ubuntu.bin; its glyph tables are defined here.
 
-#define COMPRESSED_DATA_SIZE_FONT_FONTUBUNTU 29572
+#define BASE_SIZE_FONT_FONTUBUNTU 64
+#define GLYPH_COUNT_FONT_FONTUBUNTU 95
+#define GLYPH_PADDING_FONT_FONTUBUNTU 4
 
-// Font image pixels data compressed (DEFLATE)
-// NOTE: Original pixel data simplified to GRAYSCALE
-static unsigned char fontData_FontUbuntu[COMPRESSED_DATA_SIZE_FONT_FONTUBUNTU] = { 0xec,
-    0x5d, 0x79, 0xbc, 0x4e, 0xc5, 0x1f, 0xbe, 0x8b, 0x7d, 0xdf, 0xc9, 0x92, 0x22, 0xa5, 0x92, 0xad, 0x45, 0x48, 0x21, 0x21,
-    0xbb, 0x5f, 0x89, 0x16, 0x52, 0x91, 0x3d, 0x6b, 0xb6, 0x88, 0xc8, 0x96, 0x6c, 0x6d, 0x4a, 0xd9, 0x45, 0x4a, 0x49, 0x4a,
-    0xa5, 0x6c, 0x85, 0xec, 0x59, 0x4a, 0x42, 0x45, 0x89, 0x42, 0xd9, 0x65, 0xb9, 0xee, 0xf3, 0xfb, 0xbc, 0x77, 0x39, 0xef,
-    0x77, 0xce, 0x3b, 0x33, 0x67, 0xe6, 0x9c, 0xf3, 0xbe, 0xf7, 0xbd, 0xcc, 0x79, 0xfe, 0xe1, 0x9e, 0x39, 0x73, 0xe6, 0x9d,
-    0x33, 0x33, 0xcf, 0xcc, 0x77, 0x45, 0x8c, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xc1, 0x15, 0x89,
-    0x71, 0x98, 0x98, 0x82, 0xce, 0x9c, 0xbb, 0xad, 0xf0, 0x54, 0x0a, 0x6a, 0x5a, 0x7f, 0x6b, 0x62, 0xfd, 0xad, 0xa1, 0xe2,
-    0x3b, 0x1e, 0xb3, 0xde, 0x51, 0x38, 0xe4, 0x5e, 0x0b, 0xeb, 0x5e, 0x09, 0x8d, 0x56, 0xe7, 0x47, 0xe3, 0x14, 0x5c, 0xef,
-    0xe2, 0x37, 0xc7, 0xe1, 0x7a, 0x3c, 0x84, 0x66, 0x28, 0x19, 0xc1, 0x7e, 0xce, 0x83, 0x6a, 0x68, 0x87, 0xf6, 0xa8, 0x86,
-    0xdc, 0xae, 0x9e, 0xe7, 0x7d, 0x09, 0x31, 0x32, 0xa0, 0x3f, 0xb2, 0x4b, 0x4b, 0xd4, 0x42, 0x3d, 0x97, 0xbf, 0x64, 0xb0,
-    0xf5, 0xc5, 0x6e, 0x70, 0x59, 0x43, 0x46, 0x94, 0x48, 0x41, 0x76, 0x8d, 0xa7, 0x1a, 0x63, 0x98, 0x85, 0xc2, 0x9c, 0xbb,
-    0xaf, 0x0b, 0xd1, 0x92, 0x3b, 0x06, 0xee, 0xc7, 0x22, 0x2c, 0x41, 0x13, 0xc4, 0xbb, 0xfe, 0xa6, 0x57, 0x61, 0xb1, 0x85,
-    0x92, 0x8a, 0x23, 0xaf, 0x3c, 0x1a, 0xa2, 0x23, 0x9e, 0x41, 0x73, 0xdc, 0x86, 0x2c, 0x1e, 0xc6, 0x53, 0x4e, 0x8c, 0x4c,
-    0xf9, 0x0a, 0xd9, 0x1c, 0xdf, 0x59, 0x02, 0xf7, 0xe0, 0x09, 0x74, 0x47, 0x13, 0x94, 0xd3, 0xea, 0xf1, 0x54, 0xe4, 0xc5,
-    0x1d, 0x68, 0x8e, 0x6e, 0xe8, 0x80, 0x5a, 0x28, 0x8e, 0x58, 0x9f, 0x66, 0x44, 0x49, 0x6b, 0x1c, 0x4d, 0x44, 0x5e, 0xc7,
-    0xd2, 0x77, 0x91, 0xd2, 0x62, 0x3c, 0xee, 0xb2, 0x2d, 0x05, 0xd0, 0x08, 0xed, 0x31, 0x08, 0xaf, 0x62, 0x3e, 0x6a, 0x09,
-    0xca, 0x3c, 0xa0, 0xd4, 0x02, 0x8a, 0x96, 0x4a, 0xef, 0xce, 0x84, 0x0a, 0x68, 0x83, 0x0e, 0xa8, 0x8e, 0x5c, 0xae, 0xfb,
-    0x32, 0x0e, 0x15, 0x92, 0x7e, 0x41, 0x57, 0xd4, 0x40, 0x0e, 0x8d, 0xe7, 0x0a, 0x63, 0x00, 0x9e, 0x47, 0x51, 0x4f, 0x25,
-    0x54, 0x5b, 0xd8, 0x08, 0x13, 0xb8, 0x77, 0xda, 0xa3, 0xa3, 0x36, 0xf2, 0x71, 0xea, 0xe9, 0x8d, 0x27, 0x91, 0xd5, 0xb7,
-    0xf5, 0x3a, 0x0e, 0x45, 0x51, 0x15, 0x2d, 0xd1, 0x1b, 0x9d, 0xd0, 0x02, 0x77, 0x21, 0xb3, 0x2f, 0xb5, 0x66, 0xc6, 0x75,
-    0xa8, 0x9a, 0xc4, 0xa0, 0xcf, 0xe2, 0x69, 0x34, 0x43, 0x75, 0x94, 0xf1, 0xa9, 0x66, 0xb7, 0x38, 0x8f, 0xd4, 0xeb, 0x2b,
-    0xce, 0xdd, 0x3f, 0xac, 0xbb, 0xef, 0x5a, 0x7f, 0x5b, 0x67, 0xfd, 0x6d, 0xa5, 0xe2, 0x3b, 0xd6, 0xa7, 0x94, 0xbf, 0xc0,
-    0xf9, 0xad, 0xcb, 0x52, 0xee, 0x25, 0x6a, 0xf1, 0x62, 0x0d, 0xab, 0x0d, 0x43, 0x34, 0x7f, 0xef, 0x2d, 0xf8, 0x1a, 0x27,
-    0xad, 0xa7, 0xff, 0xc1, 0x47, 0x28, 0xee, 0xc8, 0xdc, 0x13, 0x52, 0xe6, 0xf3, 0x04, 0x57, 0x33, 0x34, 0x27, 0xc6, 0xe2,
-    0x80, 0xf5, 0xc6, 0xc0, 0x2f, 0xfd, 0x03, 0xa3, 0xb4, 0xd7, 0x61, 0xde, 0x97, 0x10, 0x63, 0x08, 0x80, 0xbd, 0xb8, 0x4b,
-    0x70, 0x37, 0x2b, 0x26, 0xe2, 0x12, 0xfe, 0x42, 0x41, 0x57, 0x23, 0x66, 0xab, 0xd5, 0x92, 0x3b, 0x5c, 0x8e, 0xb9, 0x0a,
-    0x56, 0x0d, 0x4f, 0x6a, 0x3c, 0x35, 0x81, 0xf4, 0x61, 0x95, 0x90, 0xbb, 0xc3, 0xc9, 0x5d, 0xfb, 0xf5, 0x3a, 0x67, 0x76,
-    0x07, 0x7f, 0xc5, 0x2e, 0x64, 0x70, 0xf9, 0x3b, 0x7a, 0x58, 0x75, 0xfc, 0xaa, 0xc0, 0x8a, 0x25, 0x30, 0x14, 0xfb, 0x99,
-    0x76, 0xfd, 0x8b, 0x57, 0x71, 0x8b, 0xab, 0x37, 0x17, 0xc5, 0xf7, 0x56, 0x2d, 0x32, 0xee, 0xbc, 0x13, 0x53, 0x71, 0x8a,
-    0x79, 0x67, 0x22, 0x0e, 0x61, 0x39, 0xea, 0x2a, 0x7f, 0xa9, 0x51, 0xd8, 0x80, 0x04, 0xa6, 0x86, 0xd3, 0xf8, 0x1e, 0x93,
-    0x3d, 0x33, 0x42, 0x3e, 0xec, 0x24, 0x75, 0x3a, 0xef, 0x9e, 0xfa, 0x48, 0xbe, 0x6f, 0xf0, 0x9a, 0xaf, 0xd9, 0x8a, 0x4c,
-    0xa8, 0x8d, 0x51, 0xd8, 0x84, 0x4b, 0xa4, 0x8e, 0x67, 0x04, 0x65, 0x5f, 0x51, 0x6a, 0x01, 0xbd, 0xa6, 0x38, 0xbc, 0xbd,
-    0x12, 0x66, 0x60, 0x2b, 0x59, 0x81, 0x13, 0xf1, 0x1b, 0x3e, 0xc1, 0x40, 0x4d, 0x16, 0xbb, 0x06, 0x63, 0xf0, 0x3b, 0x79,
-    0xeb, 0x25, 0xec, 0xc4, 0x6c, 0xf4, 0x40, 0x7e, 0xc7, 0x27, 0xa7, 0xa4, 0xbc, 0xfb, 0x22, 0x66, 0xbb, 0x2e, 0xa1, 0xb6,
-    0x7f, 0xec, 0x8d, 0x5f, 0x92, 0x7e, 0x5f, 0x29, 0xce, 0xdd, 0x73, 0xda, 0xfd, 0x0a, 0x94, 0xe3, 0x9c, 0x78, 0xfe, 0x06,
-    0x70, 0x14, 0x63, 0x70, 0x8d, 0xe7, 0x7d, 0xe9, 0x10, 0xfc, 0x18, 0xd2, 0xaa, 0x53, 0xf8, 0x18, 0xb7, 0xb9, 0xae, 0x33,
-    0x1e, 0x77, 0xa0, 0x3f, 0x96, 0xe2, 0x0c, 0xe7, 0xb7, 0x9c, 0xc1, 0x97, 0xe8, 0x83, 0x0a, 0xbe, 0xed, 0xab, 0xa3, 0x8d,
-    0xff, 0x33, 0xe0, 0x6c, 0x4a, 0xf9, 0xad, 0x21, 0xf7, 0x62, 0xf1, 0x6f, 0xca, 0xbd, 0xbd, 0x5a, 0xad, 0x76, 0xc7, 0xff,
-    0xb1, 0xe8, 0x81, 0xff, 0x42, 0xfa, 0xff, 0x1f, 0x34, 0x97, 0x3e, 0x35, 0xd6, 0x2a, 0x39, 0xd7, 0x45, 0xff, 0xb6, 0x20,
-    0x7d, 0x48, 0xaf, 0xfd, 0x78, 0x20, 0x6c, 0xfc, 0x7f, 0x3b, 0x2e, 0x26, 0x95, 0x4c, 0xc0, 0x4b, 0x9c, 0xd3, 0x6d, 0x65,
-    0xec, 0x4a, 0xa9, 0xe9, 0x23, 0x57, 0x23, 0x66, 0xa9, 0xd5, 0x92, 0x12, 0x11, 0xe5, 0xff, 0x17, 0x49, 0xef, 0xdd, 0xe2,
-    0x91, 0xff, 0x6b, 0x33, 0xf7, 0x9b, 0xb8, 0xfc, 0x1d, 0xeb, 0xad, 0x1a, 0x46, 0x3a, 0x96, 0x6d, 0x6d, 0xe3, 0xe1, 0xd4,
-    0x2b, 0x01, 0xcf, 0x6b, 0x4b, 0x20, 0x6e, 0x66, 0xf6, 0x11, 0x22, 0xfe, 0xaf, 0x8d, 0xed, 0x92, 0x3e, 0xf9, 0x0c, 0x37,
-    0x3a, 0xca, 0x5b, 0x56, 0x4a, 0x9e, 0x3f, 0x85, 0x01, 0x1e, 0xe4, 0x17, 0x59, 0xf0, 0x2d, 0x53, 0x9b, 0x33, 0xff, 0x0f,
-    0xf5, 0x9d, 0xff, 0x33, 0xa3, 0x33, 0xc3, 0x9b, 0xa9, 0xd7, 0x88, 0x88, 0xf0, 0x7f, 0x2e, 0x4c, 0xb4, 0xed, 0xab, 0x40,
-    0x76, 0xa4, 0x77, 0x2a, 0xff, 0x8a, 0xfb, 0xad, 0x15, 0xd4, 0x7e, 0xfd, 0x8a, 0x8a, 0x0e, 0x27, 0x21, 0x7a, 0xdd, 0xe9,
-    0xaa, 0x84, 0x33, 0xca, 0x63, 0x0a, 0x61, 0xbd, 0x7e, 0x61, 0xe3, 0xff, 0x3a, 0x64, 0x46, 0x7d, 0x8c, 0x7b, 0x5d, 0xb2,
-    0xe9, 0x83, 0xf8, 0x8a, 0xd9, 0x0b, 0xb2, 0xd7, 0x45, 0x8c, 0x74, 0x71, 0x5a, 0xcf, 0x8b, 0x41, 0x38, 0xac, 0xf0, 0x9b,
-    0xf6, 0xe1, 0x19, 0x47, 0x59, 0x5e, 0xa4, 0xf9, 0x7f, 0x9f, 0x75, 0x37, 0xb8, 0xff, 0x5b, 0x63, 0xfd, 0x6d, 0xb9, 0xe2,
-    0x6a, 0x95, 0x7a, 0xcd, 0xe0, 0xec, 0x5d, 0x53, 0xaf, 0x0f, 0x22, 0xc0, 0xff, 0xb3, 0x85, 0x7d, 0xdf, 0x5b, 0xf8, 0x4c,
-    0x69, 0x6b, 0x7c, 0x9e, 0x75, 0xa1, 0x2f, 0x18, 0x29, 0xfd, 0xe2, 0x9d, 0x34, 0x6a, 0xe2, 0x7d, 0x09, 0xd1, 0xe9, 0xfe,
-    0x27, 0xab, 0xec, 0x42, 0xce, 0xfd, 0x5b, 0x53, 0x76, 0x07, 0x81, 0xab, 0x8d, 0x8b, 0x11, 0x33, 0xc7, 0x3a, 0x67, 0x64,
-    0x8c, 0x28, 0xff, 0x0f, 0x27, 0x27, 0x9c, 0x6c, 0x1e, 0xf9, 0x9f, 0x1d, 0x09, 0x0b, 0x5d, 0xfd, 0x8a, 0xeb, 0x90, 0x28,
-    0xd9, 0x8f, 0xb0, 0xd2, 0x86, 0xb7, 0xa5, 0xe3, 0xe0, 0x6b, 0x2d, 0x69, 0x50, 0x4d, 0x1c, 0x63, 0x9e, 0xe6, 0xf1, 0x7f,
-    0x6e, 0x4c, 0x21, 0xad, 0x13, 0xad, 0x66, 0xcf, 0x49, 0xf6, 0xec, 0x5f, 0x2b, 0xac, 0x58, 0x4e, 0x0c, 0x23, 0xee, 0x8f,
-    0x05, 0xb6, 0x9a, 0x9c, 0x67, 0xd6, 0xcb, 0xbe, 0xf2, 0x7f, 0x26, 0x74, 0x63, 0x64, 0x72, 0xf4, 0x7a, 0x3b, 0x02, 0xfc,
-    0xdf, 0x1c, 0x7f, 0x4a, 0x9f, 0x4c, 0xc0, 0x68, 0x05, 0xa6, 0x89, 0xc5, 0x73, 0x12, 0xb6, 0x0a, 0x9c, 0x2c, 0x1f, 0x95,
-    0x3c, 0x3d, 0xde, 0xb1, 0xad, 0xe3, 0xb5, 0xa4, 0x19, 0xa1, 0x63, 0xa8, 0x05, 0x56, 0xd9, 0x5a, 0xb4, 0x39, 0x6c, 0xfc,
-    0x3f, 0xc5, 0x56, 0x62, 0x27, 0x3a, 0x23, 0xa7, 0xf6, 0xc8, 0x9c, 0xef, 0xf8, 0xe6, 0x1f, 0x1d, 0xf7, 0xcd, 0xac, 0xf6,
-    0x64, 0x34, 0x4e, 0x68, 0xfc, 0xae, 0xc3, 0x18, 0x8c, 0x3c, 0x51, 0xc4, 0xff, 0x3b, 0xac, 0xbb, 0x6f, 0x58, 0x7f, 0xfb,
-    0xc2, 0xfa, 0xdb, 0x22, 0x45, 0xed, 0x7f, 0xea, 0xd5, 0x9d, 0x33, 0x0f, 0x52, 0xaf, 0x81, 0x61, 0xe7, 0xff, 0xda, 0x44,
-    0xce, 0xb6, 0x13, 0x53, 0xf1, 0x2e, 0x7e, 0xb5, 0xfe, 0x72, 0x56, 0x28, 0x35, 0x5a, 0xe0, 0x78, 0x2e, 0x10, 0xa3, 0x3a,
-    0xb3, 0xc3, 0x3f, 0x89, 0xb5, 0x58, 0xc3, 0x8c, 0x86, 0xd3, 0x28, 0xa3, 0x5c, 0x17, 0xef, 0x4b, 0xf0, 0x31, 0x89, 0xc8,
-    0x97, 0xaf, 0xe2, 0x96, 0x18, 0x6d, 0x95, 0x38, 0x8e, 0xab, 0xb5, 0x7f, 0x55, 0xea, 0xaa, 0xf0, 0xb7, 0xeb, 0x31, 0xe7,
-    0x8e, 0xff, 0x27, 0x93, 0x9d, 0x72, 0x8c, 0x47, 0xfe, 0x7f, 0x8d, 0xb9, 0x3f, 0xdd, 0xd5, 0xaf, 0x18, 0x64, 0x3d, 0xff,
-    0x83, 0x86, 0xe4, 0x82, 0x7f, 0x7d, 0xa0, 0x7c, 0x5e, 0x79, 0x24, 0x64, 0xbd, 0xcc, 0xcb, 0xd1, 0x34, 0xfc, 0xa0, 0xb4,
-    0xda, 0x5c, 0x12, 0xea, 0xba, 0x55, 0x56, 0xc2, 0xe4, 0x5f, 0xee, 0x46, 0x7b, 0x19, 0xca, 0xa4, 0xce, 0xfc, 0xff, 0x26,
-    0x99, 0x35, 0x27, 0x84, 0x98, 0xa1, 0xf4, 0xfe, 0x42, 0xf8, 0x46, 0xf0, 0x7b, 0xce, 0x63, 0xaf, 0x50, 0x96, 0xa3, 0xcf,
-    0xff, 0x93, 0x1d, 0xe4, 0x73, 0x94, 0xef, 0xcf, 0x2b, 0xef, 0x43, 0x52, 0x91, 0x0d, 0x1f, 0x85, 0x3c, 0x13, 0xca, 0xa5,
-    0x13, 0x85, 0xda, 0xad, 0x79, 0x4c, 0xb9, 0xc5, 0xae, 0x4a, 0x88, 0x79, 0x6f, 0x10, 0x57, 0xee, 0xb9, 0x97, 0xc3, 0xc9,
-    0xfe, 0xf0, 0xff, 0x12, 0x4e, 0xa9, 0x13, 0x98, 0xa4, 0x69, 0xa3, 0xd4, 0xd8, 0x56, 0x03, 0x6f, 0x0f, 0xfd, 0x8d, 0x86,
-    0x34, 0xe1, 0xb8, 0x60, 0xe7, 0xfd, 0x27, 0x76, 0x60, 0x3f, 0x47, 0x16, 0x1d, 0xb8, 0xfe, 0x10, 0xea, 0x6d, 0x23, 0xcf,
-    0xff, 0xab, 0xad, 0xbb, 0xa3, 0x38, 0x2b, 0xc3, 0x2c, 0x45, 0x0b, 0xc3, 0xd4, 0xeb, 0xee, 0x90, 0x7b, 0x2f, 0x58, 0xf7,
-    0x1a, 0x84, 0x99, 0xff, 0x33, 0x58, 0xd2, 0xd0, 0x8b, 0x84, 0x75, 0x5e, 0x70, 0x38, 0x03, 0x06, 0xdf, 0x73, 0x48, 0x7b,
-    0x37, 0x99, 0x1d, 0x7b, 0xad, 0xa7, 0xff, 0xc4, 0xfd, 0x29, 0x2b, 0x7c, 0x2c, 0xda, 0x92, 0x51, 0xb1, 0x46, 0xb9, 0x36,
-    0xde, 0x97, 0xe0, 0xe1, 0x5e, 0x32, 0x66, 0x9f, 0x10, 0x4a, 0x08, 0x7e, 0x26, 0x67, 0xcf, 0x58, 0x47, 0xfb, 0x85, 0x78,
-    0xae, 0x26, 0x76, 0x73, 0x88, 0x9d, 0x44, 0x78, 0xf9, 0x3f, 0xb8, 0x13, 0xfb, 0x92, 0x2b, 0xd5, 0x78, 0x52, 0x88, 0xaa,
-    0x1c, 0x1d, 0x08, 0xbd, 0xee, 0x76, 0x35, 0x73, 0x82, 0xfa, 0xeb, 0xe7, 0x1c, 0x2c, 0x37, 0xe9, 0x2a, 0xb2, 0x07, 0xfd,
-    0xd0, 0x18, 0xf7, 0xa1, 0x3b, 0xf9, 0xa2, 0x81, 0x6b, 0x90, 0x92, 0xd5, 0xeb, 0x58, 0xce, 0x8a, 0x94, 0xd7, 0x81, 0xa9,
-    0xce, 0x62, 0x21, 0x46, 0xa1, 0x2d, 0x9a, 0xa0, 0x37, 0xde, 0xb1, 0xc9, 0x0e, 0xf6, 0x09, 0x2d, 0x5a, 0x6e, 0xb2, 0x4e,
-    0x96, 0xc7, 0xb0, 0x1a, 0x6f, 0xa1, 0x1b, 0xee, 0x45, 0x43, 0x74, 0xc3, 0x0c, 0xdb, 0x7a, 0x3d, 0x4a, 0xbb, 0xdf, 0xfa,
-    0x72, 0xd6, 0x3c, 0x67, 0xfe, 0x7f, 0x57, 0x51, 0xd6, 0xe2, 0x8c, 0xca, 0x36, 0x2b, 0x0c, 0xe0, 0x20, 0x86, 0xa3, 0x15,
-    0xaa, 0xa2, 0x18, 0xe2, 0xa4, 0x72, 0xb5, 0xdc, 0x0a, 0x58, 0x4c, 0xd8, 0xa7, 0x8c, 0xa3, 0x7c, 0x0e, 0xd8, 0x84, 0x76,
-    0xb8, 0x1d, 0xd9, 0x90, 0x09, 0xb7, 0xa1, 0x23, 0x91, 0xad, 0x06, 0xb8, 0xa7, 0xa6, 0x83, 0x1d, 0x2e, 0xdd, 0xc9, 0xcd,
-    0xc1, 0x93, 0x28, 0x85, 0x0c, 0xa8, 0x8e, 0xa1, 0x58, 0xcb, 0x9c, 0x3b, 0x44, 0xf6, 0x0c, 0xf5, 0x99, 0x3e, 0x78, 0xc0,
-    0x55, 0x09, 0x1e, 0xaa, 0x60, 0x36, 0x87, 0xd3, 0x13, 0xb0, 0x08, 0xf5, 0xb9, 0xfd, 0x5b, 0x14, 0xc5, 0xb4, 0x91, 0x91,
-    0xbb, 0x02, 0xbc, 0xc3, 0xd1, 0xaf, 0x27, 0xe2, 0x0b, 0x34, 0x92, 0x7e, 0x57, 0xd6, 0x32, 0xf9, 0x48, 0xd2, 0x33, 0xcb,
-    0xd1, 0x0d, 0x0d, 0x70, 0x63, 0xd2, 0x37, 0xbf, 0x1d, 0x4f, 0xdb, 0xf6, 0x32, 0xcd, 0x95, 0x24, 0x4c, 0x13, 0x43, 0x7a,
-    0x60, 0x35, 0x06, 0xe2, 0x56, 0x14, 0x20, 0xad, 0xc9, 0x8d, 0x9b, 0xd0, 0x0d, 0x5f, 0xd8, 0x76, 0x02, 0x17, 0xd1, 0x2f,
-    0x62, 0xd6, 0x00, 0x72, 0xfe, 0xff, 0xcc, 0xba, 0xdb, 0x9f, 0x23, 0x69, 0x79, 0x55, 0xe9, 0x0d, 0xcb, 0x25, 0x16, 0x7e,
-    0x9f, 0x58, 0x75, 0x5d, 0x15, 0x66, 0xfe, 0x7f, 0xc2, 0x7a, 0xa2, 0x27, 0xf3, 0xf7, 0x57, 0xad, 0xbf, 0xd7, 0xe0, 0xc8,
-    0x29, 0x37, 0x5a, 0x77, 0xdb, 0x69, 0xf7, 0x6c, 0x4f, 0xeb, 0xd9, 0xbf, 0x6d, 0x96, 0x76, 0x55, 0xc9, 0xfc, 0x54, 0xd5,
-    0xa1, 0xf3, 0xbe, 0x04, 0xcf, 0xce, 0x64, 0x37, 0x61, 0xc9, 0x58, 0x49, 0xff, 0x05, 0xe5, 0x86, 0x0f, 0x3b, 0xbc, 0x79,
-    0x04, 0xf6, 0xa1, 0x0f, 0x61, 0x99, 0x3a, 0x21, 0xda, 0x9c, 0x58, 0xd4, 0xc3, 0x12, 0x1c, 0x52, 0xd6, 0x63, 0xbb, 0xe3,
-    0xff, 0x95, 0x9a, 0xe3, 0x4e, 0x8e, 0xf7, 0x52, 0x7a, 0x20, 0x11, 0x8b, 0x5c, 0xcd, 0xb5, 0x8a, 0x64, 0x85, 0x29, 0x2d,
-    0xd5, 0xf3, 0x1e, 0x25, 0x33, 0x7b, 0x02, 0x39, 0x2f, 0xc7, 0xa2, 0x1d, 0x61, 0xf3, 0x0b, 0xb8, 0xce, 0x41, 0x8b, 0x38,
-    0x5c, 0x20, 0x49, 0xcc, 0xcb, 0x91, 0xfe, 0xa7, 0x6a, 0x8b, 0x8e, 0x60, 0xb0, 0x6d, 0xec, 0xe5, 0xc3, 0x68, 0xe6, 0xf4,
-    0x29, 0x3e, 0x65, 0xce, 0x4d, 0x92, 0xa2, 0x3e, 0x18, 0xd2, 0x3b, 0x45, 0x31, 0x95, 0x59, 0xd5, 0x6e, 0xd7, 0xf4, 0x63,
-    0x49, 0xb4, 0xf6, 0x25, 0x3a, 0xfc, 0xff, 0xa9, 0x55, 0xb6, 0x98, 0xa7, 0xef, 0x7e, 0xbf, 0x8d, 0x23, 0xb6, 0xa0, 0x35,
-    0x32, 0xf9, 0xb6, 0x9a, 0x76, 0x24, 0xa3, 0xe2, 0x01, 0x47, 0xf9, 0xdc, 0x25, 0x8c, 0xb5, 0xbd, 0x3b, 0x1e, 0x43, 0xc8,
-    0xd7, 0xf9, 0x59, 0x62, 0x61, 0x51, 0x80, 0x8c, 0x86, 0x0b, 0x78, 0xc4, 0x76, 0xb7, 0x1d, 0x73, 0x9e, 0xcc, 0xec, 0xb8,
-    0x56, 0xfc, 0xce, 0xed, 0x03, 0xe7, 0x12, 0x76, 0x8b, 0x8a, 0x36, 0xd8, 0xc0, 0x19, 0xa1, 0x87, 0xf0, 0xa2, 0x0b, 0x39,
-    0xa3, 0x3b, 0x2f, 0xab, 0xee, 0xcc, 0xee, 0x2a, 0xf5, 0xfa, 0x05, 0xbd, 0x15, 0x7c, 0x4c, 0x02, 0x18, 0x86, 0xb1, 0x1c,
-    0x9f, 0xb2, 0x9c, 0x64, 0xff, 0x09, 0xec, 0x76, 0xdc, 0x4f, 0x5c, 0x45, 0xac, 0xe4, 0x92, 0xe7, 0x61, 0x6f, 0xa9, 0x3d,
-    0x66, 0x76, 0x74, 0xb4, 0xe9, 0xa3, 0x3e, 0xf1, 0x71, 0x54, 0xba, 0xe7, 0xff, 0x79, 0x1c, 0x5d, 0x75, 0x50, 0x13, 0xf7,
-    0xa2, 0x92, 0xcd, 0x9d, 0xcc, 0xc2, 0xef, 0x0f, 0x6b, 0x84, 0xa8, 0xb7, 0xb8, 0x08, 0xda, 0xe2, 0x73, 0xab, 0x0d, 0xc7,
-    0xb0, 0x16, 0xb3, 0xf1, 0x02, 0x1e, 0x47, 0x45, 0xe9, 0x3a, 0xfe, 0x96, 0x25, 0x13, 0xcf, 0x6e, 0xb3, 0x40, 0x48, 0x10,
-    0xda, 0xa6, 0xb4, 0xb6, 0xde, 0xb2, 0xcd, 0x85, 0x97, 0xd8, 0x2c, 0x09, 0xcb, 0x05, 0x65, 0xd9, 0x8d, 0x14, 0x6b, 0x9b,
-    0xa7, 0x64, 0x35, 0xd0, 0x8a, 0xd8, 0x67, 0xc9, 0xed, 0x60, 0x83, 0x12, 0xf0, 0xad, 0x0e, 0xfc, 0xb7, 0x3b, 0x45, 0xea,
-    0xfa, 0x46, 0xca, 0xbc, 0xc8, 0x97, 0xb2, 0x82, 0xf7, 0x48, 0x39, 0xcd, 0x74, 0xb2, 0x66, 0x5c, 0xed, 0xb0, 0xf2, 0xff,
-    0x8f, 0xd6, 0x53, 0x5d, 0x7d, 0x19, 0xf9, 0xd7, 0x62, 0x14, 0xc6, 0x6a, 0x68, 0x60, 0x58, 0x8c, 0xb1, 0x5a, 0xb3, 0x4e,
-    0xf9, 0x94, 0xb6, 0x22, 0x64, 0xdd, 0xa0, 0x27, 0xf5, 0x77, 0x25, 0xab, 0xda, 0x0b, 0x36, 0x49, 0xe2, 0x39, 0x07, 0xfd,
-    0x7f, 0xcd, 0xa4, 0xdd, 0xcd, 0xc7, 0x28, 0xe4, 0xd8, 0xa6, 0xff, 0x84, 0x23, 0xfb, 0x7a, 0xb4, 0x11, 0xdc, 0x8b, 0x65,
-    0x24, 0xcf, 0xa3, 0x35, 0x7a, 0xad, 0x8c, 0xe5, 0x7b, 0x73, 0x09, 0x2d, 0xb5, 0xf8, 0x3f, 0x28, 0x2d, 0xf1, 0xe2, 0x35,
-    0x59, 0x8a, 0x91, 0x7f, 0xac, 0x55, 0xf2, 0xa5, 0xd5, 0xd1, 0x6b, 0xfd, 0xe7, 0xb8, 0x47, 0xbd, 0x96, 0xec, 0xf9, 0x5e,
-    0xe3, 0x96, 0x18, 0x48, 0x5a, 0xd8, 0x59, 0xc1, 0x1b, 0xe6, 0x22, 0x9a, 0x3a, 0xe8, 0x9c, 0x9e, 0x16, 0x9e, 0x51, 0x5b,
-    0x62, 0x05, 0x56, 0xe3, 0x31, 0x61, 0x9f, 0x3a, 0x97, 0x08, 0xea, 0x9c, 0x46, 0x24, 0x59, 0xe0, 0xdb, 0x4f, 0xdf, 0x2b,
-    0xf0, 0x50, 0x84, 0x98, 0x2c, 0x38, 0x3a, 0x6b, 0xe1, 0x7d, 0x5c, 0xe0, 0x58, 0x43, 0x4c, 0x41, 0x05, 0xd7, 0xb5, 0x66,
-    0x23, 0x32, 0x53, 0xe0, 0x5a, 0x07, 0xc9, 0xef, 0x66, 0x46, 0x0b, 0x31, 0x58, 0x49, 0x76, 0x9c, 0x15, 0xbd, 0x99, 0xd1,
-    0x39, 0x37, 0x22, 0x32, 0x00, 0x39, 0xff, 0x07, 0xb5, 0x6e, 0x8f, 0x72, 0x56, 0x8f, 0x67, 0x95, 0xbc, 0x53, 0xc4, 0x16,
-    0x7e, 0x05, 0xad, 0x7b, 0x4b, 0x14, 0xbf, 0x6c, 0x17, 0x6c, 0x96, 0xd8, 0x35, 0x1d, 0xc4, 0x74, 0x54, 0x73, 0x38, 0x3d,
-    0xbe, 0x2d, 0x94, 0x4f, 0x4c, 0x0d, 0xf9, 0xe2, 0x41, 0xa9, 0x4f, 0x1d, 0x0f, 0x7e, 0x72, 0x89, 0x9c, 0xaf, 0xdf, 0x52,
-    0x4b, 0xee, 0x2b, 0xfa, 0x12, 0xa1, 0xfd, 0x13, 0xf4, 0x6a, 0xeb, 0xeb, 0x50, 0x5f, 0x0e, 0x62, 0x93, 0x7a, 0xbf, 0xd2,
-    0x39, 0x37, 0xb0, 0xd2, 0x4c, 0x4e, 0xf2, 0xbc, 0x4f, 0xd6, 0x6b, 0xdc, 0x83, 0x38, 0xb4, 0x61, 0x2c, 0xa8, 0x27, 0x87,
-    0x95, 0xff, 0x83, 0xed, 0xbd, 0x2f, 0xcd, 0xa3, 0x66, 0xc4, 0x12, 0x19, 0x72, 0x0f, 0xe9, 0x79, 0xe4, 0x18, 0xd9, 0xa9,
-    0x5e, 0x2d, 0x5d, 0x55, 0x2e, 0x71, 0xb4, 0x9a, 0xc9, 0xbb, 0xd0, 0x63, 0xb6, 0x71, 0x1e, 0x58, 0x53, 0x9d, 0xec, 0xff,
-    0xc7, 0xa0, 0x8f, 0x44, 0x4a, 0x44, 0xe5, 0xcc, 0x6e, 0x22, 0x68, 0xe4, 0xc0, 0x5f, 0x9a, 0x73, 0x37, 0x99, 0x4d, 0x36,
-    0x11, 0x29, 0x56, 0x46, 0x2d, 0xfe, 0xff, 0xc1, 0xda, 0xd7, 0xc6, 0x78, 0xf0, 0x3a, 0xd8, 0xc4, 0xb0, 0x7f, 0x0e, 0x5f,
-    0xc7, 0x44, 0x06, 0xe2, 0x93, 0xb9, 0x4f, 0x58, 0xf7, 0xc3, 0xe4, 0x54, 0x9c, 0x5b, 0xd0, 0x4b, 0xbb, 0xac, 0x32, 0x33,
-    0x85, 0x3e, 0x6a, 0xe7, 0x1c, 0xbc, 0x92, 0x62, 0xf1, 0x21, 0x39, 0xfd, 0x66, 0x08, 0xeb, 0x6c, 0xa8, 0x89, 0x05, 0x21,
-    0x16, 0x0d, 0x01, 0xdb, 0xa2, 0x57, 0x70, 0x53, 0x9a, 0xcd, 0xd0, 0xab, 0x30, 0x98, 0xeb, 0xdd, 0xb1, 0x0a, 0x2d, 0x5c,
-    0xda, 0x2d, 0xb7, 0x26, 0xb5, 0x34, 0x90, 0x5a, 0xb7, 0x7e, 0xcc, 0xf8, 0x72, 0x94, 0xd1, 0xda, 0x1f, 0x53, 0xe9, 0xc5,
-    0xd8, 0x34, 0xe7, 0xff, 0x11, 0xd6, 0xdd, 0x60, 0xb4, 0x98, 0xce, 0x5a, 0xab, 0xb7, 0xcc, 0xc2, 0xef, 0x3e, 0x2d, 0xdb,
-    0xba, 0x22, 0xc4, 0xf2, 0x50, 0x7c, 0x75, 0x14, 0x3c, 0x7d, 0x48, 0xa8, 0xab, 0x4d, 0x95, 0x66, 0xae, 0xb6, 0xfd, 0xfd,
-    0x79, 0x57, 0x96, 0x2f, 0x41, 0x4d, 0xd2, 0x79, 0x4b, 0xfe, 0x16, 0x7a, 0xf7, 0x6e, 0xed, 0xd3, 0x13, 0xef, 0x4b, 0xd8,
-    0xd1, 0x90, 0xd8, 0x1a, 0xe6, 0xd6, 0xb0, 0xa7, 0x5f, 0xa5, 0xf4, 0xde, 0xd4, 0x9a, 0x9f, 0x4f, 0x92, 0xc5, 0x26, 0xa2,
-    0x05, 0x59, 0xef, 0x52, 0xf5, 0x1c, 0xf1, 0x61, 0xe3, 0xff, 0x32, 0x64, 0x17, 0x52, 0x28, 0xcd, 0xf9, 0xbf, 0x06, 0x91,
-    0x7f, 0xcb, 0x34, 0x57, 0x4f, 0x92, 0xde, 0x79, 0x54, 0xe0, 0xa1, 0x1f, 0xd4, 0x05, 0x8d, 0x77, 0x98, 0x41, 0xc9, 0xa7,
-    0x89, 0x9e, 0xc8, 0x40, 0xc6, 0x0f, 0x14, 0xe5, 0x9a, 0x2c, 0xba, 0x6a, 0x6a, 0x33, 0x43, 0xb1, 0xd0, 0x7a, 0xfe, 0x80,
-    0xb6, 0xe5, 0x68, 0xb2, 0xc5, 0xa5, 0x1e, 0xff, 0xff, 0x21, 0xb1, 0xfd, 0xd4, 0xb7, 0x20, 0x0d, 0x48, 0xbd, 0xf2, 0xfa,
-    0x3c, 0x26, 0x9e, 0x21, 0xb5, 0xdf, 0xaf, 0xd0, 0x07, 0x62, 0xcd, 0x4b, 0x70, 0xe5, 0xd9, 0x21, 0x28, 0xd1, 0x9d, 0x9c,
-    0xb0, 0x2b, 0x08, 0x23, 0x7c, 0xc1, 0x93, 0x9f, 0x8f, 0x9a, 0x8d, 0x53, 0x07, 0xae, 0x97, 0xe9, 0x16, 0xb4, 0x77, 0x15,
-    0x69, 0x2a, 0xc6, 0xe7, 0x1d, 0x59, 0x33, 0x7c, 0xc9, 0xf1, 0x90, 0x38, 0x80, 0x41, 0x9c, 0x08, 0x62, 0x4e, 0x28, 0xa7,
-    0xe4, 0x2f, 0x46, 0xed, 0xdd, 0x02, 0x9c, 0xaa, 0x3b, 0xca, 0x72, 0x33, 0x96, 0x8c, 0x1d, 0xd3, 0x98, 0xff, 0x83, 0xeb,
-    0x57, 0x50, 0x3b, 0x59, 0xcf, 0xfa, 0xdb, 0x3d, 0x9c, 0xbd, 0xeb, 0xd5, 0x36, 0x8c, 0x27, 0xd6, 0x68, 0xf6, 0x7b, 0x41,
-    0x19, 0x55, 0x17, 0xeb, 0x6f, 0x22, 0x39, 0x53, 0x35, 0x25, 0x1f, 0x4a, 0x08, 0x76, 0x9c, 0xb9, 0xad, 0xfb, 0x8f, 0x0b,
-    0x6d, 0x10, 0x8f, 0xd8, 0xb4, 0x9c, 0xa7, 0x2d, 0xed, 0x5a, 0x59, 0x17, 0xfd, 0x5a, 0x88, 0x30, 0x66, 0xe8, 0x7e, 0xb3,
-    0x8b, 0x75, 0xb7, 0x95, 0x62, 0x7d, 0xbc, 0x2f, 0x21, 0x96, 0x91, 0xbe, 0xa2, 0xb4, 0x43, 0x0e, 0x7e, 0xfb, 0x6a, 0xc2,
-    0x52, 0x6f, 0x0b, 0xac, 0x54, 0x79, 0xd7, 0xcf, 0x0e, 0x72, 0x31, 0x2f, 0xfc, 0xdf, 0xd7, 0x75, 0x8c, 0x97, 0x70, 0xe0,
-    0x0d, 0xab, 0x35, 0xcb, 0xa4, 0xe5, 0x82, 0x27, 0x81, 0xbf, 0x84, 0xd2, 0xbc, 0xd5, 0xe4, 0x9c, 0xc6, 0x5f, 0xc5, 0xfe,
-    0xb0, 0xac, 0xd3, 0xdf, 0x4e, 0x89, 0xbb, 0xe3, 0x95, 0xff, 0xab, 0x69, 0x5a, 0x1e, 0xca, 0xa5, 0xd4, 0xf9, 0x95, 0x9e,
-    0x68, 0x60, 0x49, 0xee, 0x56, 0x26, 0x49, 0x84, 0xf5, 0xf8, 0xff, 0xac, 0xc4, 0x83, 0x4c, 0x35, 0xf2, 0x57, 0x22, 0x19,
-    0xa9, 0x85, 0x7d, 0x1e, 0x11, 0x45, 0x88, 0x86, 0x46, 0x16, 0xa1, 0xe3, 0x5b, 0x81, 0x1d, 0x12, 0xdb, 0x53, 0xc1, 0xbd,
-    0x6e, 0x16, 0x41, 0x5c, 0x9e, 0xd4, 0xeb, 0x5b, 0x09, 0xfb, 0x1d, 0x51, 0xda, 0xe1, 0xbb, 0xc7, 0xd8, 0x10, 0xc9, 0x54,
-    0x40, 0x9f, 0x34, 0xc3, 0x65, 0xa4, 0x80, 0x70, 0xe1, 0x3a, 0x8c, 0x65, 0x6c, 0x70, 0x52, 0x35, 0x68, 0xb3, 0x35, 0x67,
-    0x4e, 0x7e, 0xf2, 0x74, 0x07, 0x89, 0x7d, 0x09, 0x8d, 0xb1, 0x91, 0xc1, 0x95, 0x94, 0x6a, 0x17, 0xe1, 0x8e, 0xc2, 0x61,
-    0xee, 0x9d, 0xa0, 0x35, 0xcc, 0x17, 0x92, 0x73, 0xea, 0x45, 0xc2, 0x61, 0xa5, 0x25, 0x96, 0x38, 0xb7, 0xb9, 0xf0, 0xe5,
-    0x60, 0xaf, 0xfa, 0x82, 0x3e, 0xd9, 0x6d, 0x1b, 0x65, 0x5b, 0xb0, 0x18, 0x93, 0x31, 0x05, 0x4b, 0xb0, 0x83, 0x8c, 0xc2,
-    0xc3, 0x82, 0x55, 0x36, 0xa8, 0x69, 0x78, 0x44, 0xa8, 0x0d, 0x3d, 0xc1, 0xfc, 0x75, 0xba, 0x16, 0x97, 0xf2, 0xf0, 0x9b,
-    0x55, 0x43, 0x75, 0x0e, 0xab, 0xa6, 0x5e, 0xaa, 0x7b, 0x0b, 0xde, 0x97, 0x60, 0x71, 0x0f, 0x91, 0x24, 0x97, 0xd1, 0x8c,
-    0x87, 0xb0, 0x48, 0x3a, 0x1e, 0x6b, 0x62, 0x28, 0x56, 0x0a, 0x7c, 0x59, 0x02, 0x33, 0x69, 0x17, 0xa6, 0xe0, 0x11, 0x8d,
-    0x88, 0x70, 0x6e, 0xf8, 0x3f, 0x68, 0x4f, 0x73, 0x57, 0x9a, 0xaf, 0x28, 0x19, 0xc9, 0xca, 0xda, 0x4e, 0xaa, 0x33, 0x3c,
-    0xa3, 0xb0, 0x6b, 0xa1, 0x12, 0x96, 0xf2, 0x42, 0x7d, 0xfd, 0x09, 0xbc, 0x4a, 0x58, 0xd2, 0x2b, 0xff, 0xe7, 0x20, 0xcf,
-    0x4f, 0x75, 0xd5, 0x07, 0x9d, 0x49, 0x0d, 0xb9, 0x95, 0x76, 0x9b, 0x87, 0xad, 0x39, 0x7a, 0x55, 0x4a, 0x2f, 0xaa, 0xf3,
-    0x7f, 0xb0, 0xbd, 0x4b, 0x5d, 0x7f, 0xb5, 0x39, 0x64, 0x55, 0xf5, 0xdf, 0x1a, 0x6d, 0x36, 0x99, 0x0f, 0xb2, 0xda, 0xff,
-    0x52, 0xd0, 0x9e, 0x36, 0x25, 0x75, 0xf1, 0x25, 0x6a, 0x6b, 0x94, 0xbc, 0x04, 0xa7, 0x11, 0xff, 0xa3, 0x70, 0xcc, 0x03,
-    0xbb, 0x95, 0xff, 0x1e, 0x07, 0x2b, 0xb7, 0xb4, 0x43, 0x16, 0xb4, 0xc1, 0x77, 0x0a, 0x5e, 0x84, 0xf2, 0xfd, 0x6b, 0xf0,
-    0xaa, 0x24, 0x94, 0xfd, 0x6f, 0x25, 0xbb, 0xf9, 0xbc, 0x52, 0x5d, 0xd8, 0x75, 0x28, 0x28, 0xb0, 0x23, 0xac, 0x41, 0x76,
-    0xaa, 0x6f, 0x87, 0xb9, 0x67, 0x82, 0x3b, 0xa3, 0x8f, 0xb8, 0xbe, 0x19, 0xa9, 0x5f, 0x96, 0xee, 0x2b, 0x2f, 0xa4, 0xd8,
-    0x53, 0xc4, 0x46, 0x8c, 0xff, 0x87, 0x30, 0x52, 0xe6, 0x41, 0x21, 0x91, 0x6b, 0x73, 0xa2, 0x06, 0xc6, 0xe0, 0x47, 0x2c,
-    0x10, 0xfe, 0xce, 0x7f, 0x84, 0x7a, 0xf1, 0x54, 0xcd, 0xfa, 0x46, 0xc6, 0x47, 0xe8, 0x92, 0x65, 0x2f, 0xe8, 0x76, 0x44,
-    0x07, 0xed, 0xff, 0x9e, 0x0f, 0x91, 0x0d, 0xfc, 0x63, 0xe9, 0xc8, 0xe2, 0x94, 0x23, 0xbe, 0x86, 0x7e, 0x09, 0x16, 0x9f,
-    0x6b, 0xeb, 0x2b, 0x6e, 0x23, 0x52, 0xc4, 0x9b, 0x94, 0x22, 0xa6, 0x95, 0x40, 0x65, 0xcb, 0x0f, 0xef, 0x30, 0x1a, 0xa0,
-    0x0c, 0xf2, 0x38, 0x58, 0xa9, 0xb4, 0xc2, 0x23, 0x21, 0x18, 0x60, 0xbd, 0xf7, 0x2d, 0xce, 0xdd, 0x47, 0x38, 0x9e, 0x84,
-    0xc5, 0xad, 0x19, 0xb1, 0x25, 0x0a, 0x56, 0x93, 0x06, 0xc4, 0x5f, 0x3c, 0x9f, 0xa4, 0x5c, 0x3d, 0x25, 0x4b, 0xae, 0xba,
-    0xa4, 0x54, 0x3f, 0xc1, 0xd9, 0xf2, 0x49, 0x9b, 0x34, 0xd5, 0x2b, 0xff, 0xdf, 0x40, 0x9e, 0xef, 0xe3, 0xaa, 0x0f, 0xe6,
-    0x12, 0xab, 0x1b, 0x95, 0x88, 0x3f, 0x5f, 0x5b, 0x23, 0xad, 0x91, 0xb5, 0x8b, 0x52, 0xe7, 0xff, 0x52, 0x9e, 0x62, 0x70,
-    0x26, 0xdb, 0xdd, 0x05, 0x35, 0xd4, 0xef, 0xf8, 0x3e, 0x22, 0xae, 0x27, 0x52, 0xe6, 0xd7, 0xa4, 0x25, 0x83, 0x3a, 0xb3,
-    0x39, 0x0a, 0x71, 0xa5, 0xb7, 0x09, 0x74, 0xfb, 0xc7, 0x95, 0xa4, 0x37, 0xff, 0x23, 0x27, 0x82, 0xcc, 0x61, 0xe5, 0xff,
-    0x44, 0x2c, 0x44, 0x5d, 0x97, 0xf6, 0x6a, 0x35, 0x70, 0x8f, 0x36, 0xdc, 0xe9, 0x16, 0x2a, 0x61, 0x0a, 0x23, 0xcd, 0xd4,
-    0xe3, 0xff, 0x97, 0x88, 0x25, 0x61, 0x06, 0xc7, 0x58, 0x37, 0x67, 0xb9, 0x7b, 0x84, 0x2c, 0xa8, 0x8d, 0x9e, 0x98, 0x69,
-    0x45, 0x7d, 0x4e, 0xc0, 0x5f, 0xd8, 0x8e, 0xaf, 0x30, 0x1a, 0x0d, 0x98, 0x5d, 0xf4, 0x64, 0xa2, 0x5f, 0xac, 0x10, 0xd6,
-    0xb5, 0xec, 0x77, 0xe9, 0x78, 0x8c, 0x4d, 0x91, 0x82, 0x7f, 0xce, 0xb1, 0x08, 0xdf, 0x2e, 0x65, 0x14, 0x3f, 0xf9, 0xbf,
-    0x30, 0xf9, 0x6a, 0xff, 0x4a, 0x4f, 0xcc, 0xe2, 0xc8, 0xd9, 0x6b, 0x85, 0x76, 0xb9, 0x9f, 0x71, 0x7e, 0xff, 0x0a, 0x05,
-    0x29, 0x9d, 0x13, 0xda, 0x5b, 0x75, 0x6c, 0xb4, 0xb1, 0xfc, 0x6c, 0x2d, 0x0b, 0x4a, 0xd9, 0x97, 0xa0, 0xfe, 0x61, 0x09,
-    0x2e, 0xac, 0x15, 0x83, 0xb2, 0xe7, 0xa1, 0x8a, 0xad, 0x18, 0x91, 0xf2, 0x15, 0x92, 0x57, 0xa7, 0x62, 0xda, 0x67, 0x04,
-    0x77, 0xd1, 0x3d, 0xba, 0x3a, 0xc6, 0x34, 0x88, 0x24, 0x66, 0x13, 0x2f, 0x1d, 0x59, 0xb9, 0xde, 0xe4, 0x37, 0xdd, 0x2c,
-    0x39, 0xdb, 0x5e, 0x50, 0x8e, 0xed, 0xe8, 0x17, 0xff, 0x3f, 0xe6, 0x39, 0xfa, 0xc1, 0x9f, 0x8a, 0x1a, 0x10, 0xbb, 0xf6,
-    0xe6, 0x55, 0x22, 0x45, 0x51, 0xe7, 0xff, 0x2a, 0x9e, 0xa5, 0x71, 0xaf, 0x93, 0xb7, 0x55, 0xf3, 0x7d, 0x44, 0x4c, 0x21,
-    0x92, 0xc9, 0x62, 0x8a, 0x1a, 0x21, 0xb1, 0x55, 0x5e, 0x70, 0xf5, 0x9f, 0x27, 0x88, 0xc8, 0x01, 0x49, 0x4c, 0x35, 0x1a,
-    0x67, 0x08, 0x0a, 0x5a, 0x43, 0x7f, 0xce, 0xff, 0xdb, 0xd1, 0xd9, 0x65, 0xfe, 0x22, 0x7f, 0x56, 0x08, 0x15, 0xa9, 0x5d,
-    0x0b, 0x2c, 0x67, 0xac, 0xc7, 0xcb, 0x69, 0x79, 0x16, 0xfe, 0xe1, 0x28, 0x2d, 0xcd, 0x4c, 0x22, 0xca, 0x3d, 0xcf, 0x8d,
-    0x50, 0xb0, 0x53, 0x1a, 0xf3, 0xb1, 0x07, 0xd1, 0x57, 0x1f, 0xf0, 0x64, 0x7d, 0xa6, 0x8e, 0x5d, 0x0e, 0xf1, 0x1d, 0xb7,
-    0x72, 0x58, 0x73, 0x89, 0x50, 0x5e, 0x10, 0x1e, 0xfe, 0xaf, 0xe7, 0x22, 0x0a, 0x85, 0x1d, 0x33, 0x2c, 0xfb, 0xa1, 0x78,
-    0x1b, 0x6f, 0xa6, 0xca, 0x68, 0x07, 0x5b, 0x7f, 0x6b, 0x46, 0x24, 0x5a, 0x99, 0x3c, 0x9c, 0x09, 0x82, 0x63, 0x6d, 0x38,
-    0xf9, 0x7b, 0x3f, 0xeb, 0xef, 0x3f, 0x68, 0x59, 0xa2, 0x6e, 0x95, 0xfa, 0x15, 0xb5, 0x20, 0x31, 0xb6, 0xd4, 0xf7, 0xe1,
-    0x6d, 0x14, 0xbd, 0xd8, 0x52, 0x67, 0xd0, 0x4c, 0xcb, 0xfe, 0xf5, 0x97, 0x14, 0xaf, 0xe0, 0x9b, 0x23, 0x32, 0xbb, 0xe7,
-    0x5a, 0x36, 0x1a, 0x59, 0xd2, 0x9c, 0xfd, 0xb3, 0x91, 0x48, 0xfe, 0xf2, 0xd8, 0x09, 0x6f, 0x3b, 0xea, 0xa5, 0x92, 0xf1,
-    0x1d, 0x89, 0x06, 0x13, 0x19, 0xfe, 0x7f, 0x8d, 0x68, 0x98, 0xdd, 0x9c, 0xa5, 0xee, 0x25, 0xef, 0x6f, 0xa6, 0x70, 0xf6,
-    0x3e, 0x6b, 0xb1, 0x44, 0x16, 0x57, 0xfc, 0xdf, 0xc8, 0x2a, 0x39, 0xc0, 0x65, 0xc4, 0xe1, 0x7f, 0xac, 0x1a, 0x7e, 0x0a,
-    0x83, 0xad, 0xf9, 0x39, 0x12, 0xe1, 0x41, 0x5e, 0x96, 0x4a, 0x32, 0x7b, 0x08, 0x76, 0xf2, 0x41, 0xcf, 0xfe, 0x07, 0x05,
-    0xb5, 0xfc, 0xeb, 0x60, 0x33, 0x6a, 0xd7, 0xd4, 0xba, 0xf3, 0x60, 0xd2, 0x65, 0xee, 0x93, 0x98, 0x2c, 0xd0, 0x60, 0xa5,
-    0x35, 0xff, 0x97, 0xc0, 0x30, 0x1c, 0xf4, 0x54, 0xcb, 0x6c, 0x05, 0xcf, 0xea, 0x27, 0x88, 0xef, 0x43, 0x9e, 0x10, 0x9f,
-    0x9b, 0xe7, 0x38, 0x3e, 0x89, 0xec, 0x35, 0x8c, 0x94, 0x6f, 0x42, 0x64, 0x8c, 0xe1, 0x8c, 0x08, 0xbc, 0x85, 0x44, 0x8a,
-    0xe4, 0xdb, 0x33, 0xb4, 0x47, 0x7b, 0x5b, 0x9c, 0xef, 0xbb, 0x93, 0xfe, 0x56, 0x9d, 0xab, 0xd5, 0x28, 0xce, 0xe0, 0x15,
-    0xe2, 0x83, 0x5a, 0xdc, 0x86, 0x41, 0x44, 0x87, 0x1a, 0xfc, 0x6b, 0x16, 0x69, 0x24, 0x9d, 0x4b, 0x2e, 0xb3, 0xe7, 0x52,
-    0x99, 0xda, 0xff, 0xb8, 0xd1, 0xec, 0x80, 0xc6, 0xd6, 0x6f, 0xd8, 0xed, 0xd1, 0x36, 0x3a, 0xd4, 0x47, 0x37, 0x31, 0x65,
-    0x26, 0x67, 0x24, 0xe7, 0x90, 0xf3, 0x9a, 0x9a, 0x6c, 0xde, 0x97, 0xe0, 0x71, 0x8d, 0x8e, 0xc6, 0xa8, 0x38, 0xd9, 0x7d,
-    0xe6, 0x77, 0xf4, 0xde, 0x4a, 0xd5, 0x30, 0xac, 0x47, 0x0c, 0x3a, 0x59, 0xf2, 0x98, 0xdb, 0x23, 0x32, 0xbb, 0x2b, 0x62,
-    0x18, 0x76, 0x28, 0xe4, 0xd9, 0x09, 0x3f, 0x5a, 0x92, 0x48, 0xb4, 0xd9, 0x15, 0xa5, 0x2b, 0xdf, 0x4a, 0xcb, 0x4d, 0x23,
-    0x35, 0xc6, 0x46, 0x80, 0xff, 0x8b, 0x92, 0x1d, 0xcc, 0x5a, 0x17, 0x3d, 0x50, 0x8b, 0x3c, 0xbf, 0x5a, 0xa1, 0xfc, 0xa7,
-    0xd6, 0x88, 0x2f, 0xc7, 0xec, 0x26, 0xd5, 0xf9, 0xbf, 0x1d, 0xe1, 0xbb, 0x1b, 0x5c, 0xf8, 0x6f, 0x55, 0x22, 0xef, 0xea,
-    0x6b, 0xc9, 0xb2, 0x8a, 0xe0, 0x0e, 0xdc, 0x89, 0xd2, 0x1e, 0xf2, 0xee, 0xda, 0xe3, 0x69, 0x9f, 0x71, 0xb4, 0xd7, 0x2a,
-    0x41, 0xf4, 0x10, 0x27, 0xb8, 0xd1, 0xbf, 0x86, 0x92, 0xe8, 0xca, 0x22, 0xed, 0x60, 0xd0, 0x8f, 0xf1, 0x63, 0xe9, 0x99,
-    0x35, 0x78, 0x3d, 0x15, 0x86, 0x99, 0xd0, 0x91, 0xc4, 0xe4, 0x00, 0x19, 0x11, 0x8f, 0x6a, 0x69, 0x1b, 0xc2, 0xcb, 0xff,
-    0x71, 0xa8, 0x87, 0x85, 0x1c, 0xef, 0xc4, 0x83, 0x18, 0xa2, 0xb1, 0xf3, 0x7d, 0x94, 0x3c, 0xd9, 0x4d, 0xc1, 0x27, 0x66,
-    0xb8, 0xed, 0x4e, 0x31, 0x4b, 0xfe, 0xac, 0xca, 0xff, 0x34, 0xa2, 0xf1, 0xa3, 0x61, 0x5c, 0xcd, 0x56, 0x6b, 0xe4, 0x30,
-    0xd3, 0xc7, 0x62, 0x89, 0xfc, 0x29, 0xc8, 0x58, 0xa5, 0x95, 0xa5, 0x6b, 0xbf, 0xb9, 0x6e, 0x49, 0x0e, 0x4b, 0x62, 0x79,
-    0x84, 0xc4, 0x83, 0x6d, 0x6e, 0x9d, 0x4c, 0xd6, 0x5b, 0x73, 0xad, 0x27, 0xf1, 0xb3, 0xf6, 0xf6, 0xeb, 0xa9, 0xbf, 0xf3,
-    0x69, 0x94, 0x47, 0x5d, 0x22, 0xff, 0xf9, 0x0f, 0x0d, 0x7d, 0xed, 0xe9, 0xa0, 0x3f, 0xfa, 0x63, 0x5a, 0xcf, 0xfd, 0xa2,
-    0xe8, 0x89, 0x10, 0x4b, 0x22, 0x60, 0x35, 0x4e, 0xd2, 0x64, 0x1d, 0xb2, 0xec, 0x31, 0xae, 0x8b, 0xd8, 0xec, 0x8e, 0x8f,
-    0x02, 0xfe, 0xff, 0x58, 0x59, 0x17, 0xfd, 0x37, 0xb1, 0x04, 0x8e, 0x51, 0xf4, 0x18, 0x2a, 0x1e, 0x01, 0xfe, 0x9f, 0x4e,
-    0x9e, 0xae, 0xa9, 0xed, 0xd7, 0xd2, 0x8b, 0x44, 0xee, 0xdb, 0xa5, 0x10, 0x5f, 0xbd, 0xb9, 0x60, 0x7d, 0xd3, 0xe1, 0xff,
-    0xc1, 0xb6, 0xf8, 0xa8, 0xbb, 0xb1, 0x18, 0xe3, 0xd0, 0x01, 0x35, 0x15, 0x47, 0x44, 0x2f, 0xf2, 0x6c, 0x71, 0xdc, 0x8b,
-    0xb7, 0xb1, 0x9b, 0xd1, 0x04, 0xef, 0xc3, 0x6b, 0xb8, 0xd7, 0xe5, 0x78, 0xc8, 0x4d, 0xb4, 0xf1, 0x2f, 0x29, 0x94, 0xff,
-    0x88, 0xf1, 0x44, 0xab, 0x1e, 0x72, 0x4e, 0x09, 0x5a, 0x12, 0xb4, 0x50, 0xc8, 0xce, 0xb0, 0x4b, 0x3a, 0x67, 0x2f, 0x0a,
-    0xfa, 0xde, 0xbf, 0x38, 0x18, 0xf7, 0x62, 0x21, 0x27, 0x8f, 0xe1, 0x61, 0x8c, 0xe1, 0xe6, 0xfa, 0x8d, 0x2c, 0xff, 0xe7,
-    0x47, 0x1f, 0xec, 0xe1, 0xee, 0x50, 0x5a, 0x69, 0xed, 0x21, 0x1b, 0x10, 0x4f, 0xa9, 0x05, 0xc2, 0x3d, 0x59, 0x26, 0x2b,
-    0xb6, 0xd5, 0xb9, 0x90, 0xb3, 0xd4, 0x42, 0x5b, 0x0e, 0xa1, 0x59, 0x78, 0x16, 0xf5, 0x51, 0x1b, 0x4d, 0xd1, 0x95, 0x9c,
-    0x36, 0xd9, 0x6f, 0xf4, 0x2c, 0x79, 0x67, 0xf8, 0x56, 0xb3, 0xa5, 0x1e, 0xfd, 0x80, 0xe4, 0x38, 0x60, 0xc9, 0x43, 0x42,
-    0xcf, 0x35, 0x9b, 0x25, 0xf7, 0x44, 0xb1, 0xbf, 0x2f, 0x7a, 0x88, 0xd9, 0xd1, 0x96, 0xd8, 0x66, 0xcc, 0x47, 0x2f, 0x0c,
-    0xc0, 0x22, 0x6b, 0xe4, 0x5e, 0xb2, 0x72, 0xd9, 0xe7, 0xb7, 0x64, 0x6b, 0x97, 0x50, 0xd9, 0x07, 0xdf, 0x93, 0x13, 0x44,
-    0x6e, 0x44, 0xb3, 0xa7, 0xd6, 0xf6, 0xb5, 0x9f, 0x6f, 0x24, 0x75, 0xeb, 0xd9, 0x36, 0x4f, 0x93, 0x64, 0x67, 0xe4, 0xc7,
-    0xbb, 0xfb, 0x3e, 0xe5, 0x7b, 0xf5, 0x25, 0x5a, 0x92, 0x82, 0x12, 0x4b, 0xb3, 0xb2, 0x21, 0x68, 0x4a, 0x62, 0x42, 0x94,
-    0xe5, 0x20, 0x73, 0x54, 0xda, 0x10, 0xa7, 0x4a, 0x67, 0xcf, 0x29, 0xe7, 0x0d, 0x3e, 0xe7, 0xa0, 0xc7, 0xe5, 0xb1, 0x5b,
-    0xb9, 0xb0, 0xf3, 0xff, 0x5d, 0x84, 0x61, 0x16, 0x28, 0xfa, 0x6b, 0xdc, 0x85, 0xba, 0x78, 0x1c, 0xfd, 0xf1, 0x09, 0x23,
-    0xc3, 0xfc, 0x40, 0xe1, 0xe4, 0x9c, 0xdd, 0xda, 0x99, 0xee, 0xb6, 0xc9, 0xf6, 0x74, 0xf8, 0xff, 0x0d, 0x21, 0x13, 0xec,
-    0x42, 0x2b, 0x05, 0x1b, 0xda, 0x4f, 0xc8, 0xcc, 0x3b, 0x24, 0xac, 0x6b, 0xb6, 0x2b, 0x49, 0x40, 0x5f, 0x22, 0xff, 0x2e,
-    0xa0, 0x50, 0xbe, 0x18, 0xd3, 0x82, 0x0b, 0xe8, 0x65, 0xf5, 0x4b, 0x3c, 0x13, 0x0f, 0x72, 0x92, 0xa4, 0x0e, 0x9a, 0x57,
-    0x54, 0x16, 0x41, 0xf4, 0x98, 0xa2, 0x55, 0xa2, 0x37, 0x94, 0xc4, 0x68, 0xe2, 0x11, 0x13, 0x94, 0xd5, 0x2e, 0x41, 0x63,
-    0x85, 0xfd, 0x59, 0x6d, 0xd4, 0xd1, 0x86, 0x33, 0x0b, 0xdc, 0x89, 0x99, 0x1c, 0xcf, 0xe5, 0xb3, 0x98, 0x2a, 0xb4, 0xdd,
-    0x17, 0x4b, 0xbb, 0xce, 0x92, 0x7d, 0xbc, 0x58, 0x1f, 0x5c, 0x47, 0x98, 0x17, 0xbf, 0x3e, 0x93, 0x61, 0xaa, 0xa7, 0x8d,
-    0xef, 0x16, 0x0a, 0xf8, 0xbf, 0x2e, 0x39, 0x3b, 0x66, 0x8e, 0xc0, 0x69, 0xa6, 0x97, 0xef, 0x75, 0x17, 0x14, 0xf6, 0x48,
-    0x60, 0xb7, 0x74, 0x5e, 0xd9, 0x37, 0xb5, 0xb7, 0xa3, 0x7f, 0x80, 0x9a, 0x24, 0x68, 0xa3, 0x70, 0xe6, 0x4f, 0xe5, 0x44,
-    0x64, 0x9d, 0xee, 0x4b, 0x1f, 0x3c, 0xcc, 0x79, 0xdb, 0x1a, 0xdf, 0xe3, 0x62, 0x75, 0x77, 0x2d, 0x21, 0x69, 0x4b, 0xe2,
-    0x91, 0x89, 0xf7, 0x61, 0x5d, 0x48, 0xeb, 0xef, 0xb3, 0xf4, 0xe0, 0xfb, 0x88, 0xf5, 0x40, 0x36, 0xad, 0x38, 0xa9, 0x6e,
-    0xe2, 0xff, 0x45, 0x07, 0xda, 0x11, 0x4b, 0xd4, 0x4c, 0x0e, 0xd6, 0x12, 0x20, 0x7e, 0x0e, 0xaa, 0xd1, 0x78, 0xee, 0x0c,
-    0x33, 0xff, 0x5f, 0x43, 0x3c, 0xd0, 0xfe, 0x53, 0x8c, 0xd7, 0xf0, 0x1d, 0x67, 0x0c, 0x07, 0x78, 0x2b, 0x56, 0xc3, 0x6a,
-    0x3a, 0x31, 0xe4, 0x7c, 0xad, 0xc3, 0xff, 0x0b, 0xa5, 0xa7, 0xc1, 0xed, 0x68, 0x26, 0x6d, 0x4b, 0xac, 0xd0, 0x77, 0x35,
-    0x34, 0x4e, 0x7c, 0x55, 0xcd, 0xf1, 0x90, 0x99, 0xe8, 0x95, 0x47, 0x28, 0x47, 0x5f, 0x60, 0xb3, 0xfd, 0x1d, 0xc3, 0x14,
-    0xd4, 0x40, 0x0e, 0xb2, 0x4b, 0x01, 0x3e, 0x95, 0x32, 0x67, 0x05, 0xb2, 0x87, 0xfb, 0x41, 0x52, 0xf2, 0xb8, 0x87, 0xec,
-    0xa5, 0xba, 0x1e, 0x76, 0x4f, 0x30, 0x51, 0x6f, 0x83, 0x92, 0x95, 0x81, 0x61, 0xf7, 0x61, 0xb7, 0xef, 0x38, 0xdb, 0x13,
-    0xad, 0x36, 0xc8, 0xca, 0xd8, 0xd7, 0x85, 0x2f, 0x57, 0x25, 0x72, 0x82, 0x5b, 0x2e, 0xb1, 0x2f, 0xa7, 0x91, 0x9d, 0x86,
-    0xd8, 0x98, 0xee, 0x67, 0xb2, 0xc6, 0x56, 0x91, 0x8c, 0xed, 0x61, 0x82, 0x08, 0x32, 0xe1, 0xb1, 0xde, 0xb4, 0x9f, 0xad,
-    0xfd, 0x8f, 0x35, 0x74, 0x9f, 0xc4, 0x4a, 0xa5, 0xb2, 0xd2, 0x3e, 0x37, 0x74, 0xb5, 0xfb, 0x5d, 0x71, 0xcd, 0xe2, 0x9f,
-    0xdd, 0xe6, 0x70, 0xed, 0x2e, 0x47, 0x5a, 0x2b, 0x79, 0x59, 0xeb, 0x7c, 0x73, 0x5a, 0xc3, 0x9f, 0x5d, 0x8c, 0x7c, 0x78,
-    0xdd, 0x16, 0xaf, 0xf8, 0x24, 0xba, 0x28, 0xfb, 0xfc, 0xa9, 0x63, 0x89, 0x63, 0xc4, 0x50, 0x67, 0xcf, 0x2a, 0x99, 0x57,
-    0x2b, 0x3f, 0xe7, 0x73, 0xd0, 0xbf, 0xe8, 0xa8, 0x25, 0x3f, 0xb9, 0xdc, 0xf9, 0x7f, 0x99, 0xb2, 0x9d, 0x45, 0x5e, 0xe5,
-    0x48, 0x9e, 0x8f, 0x69, 0xdb, 0x69, 0xb9, 0xe5, 0xff, 0xdc, 0x4c, 0x66, 0x60, 0x55, 0xef, 0x13, 0x1e, 0xff, 0x8f, 0x50,
-    0x62, 0xff, 0x72, 0xd6, 0x7c, 0x9a, 0x25, 0xdd, 0x1f, 0x95, 0x54, 0x8e, 0xfe, 0x20, 0xba, 0x36, 0x4a, 0xe6, 0x6b, 0x1e,
-    0x0d, 0xc9, 0xf2, 0x45, 0xb4, 0x77, 0xb9, 0x1f, 0x3c, 0xa7, 0xc1, 0x2e, 0x77, 0x85, 0xe4, 0x20, 0x64, 0xf3, 0x21, 0xbd,
-    0xe5, 0x78, 0xe2, 0x9b, 0xca, 0x64, 0x8e, 0xc8, 0xef, 0xe8, 0xf3, 0xd8, 0x27, 0x22, 0xb3, 0xa3, 0x1a, 0xe6, 0x72, 0x32,
-    0x19, 0x9f, 0xc7, 0x7b, 0xb8, 0x27, 0x22, 0xd1, 0xec, 0x6f, 0xc2, 0xab, 0x9c, 0xbd, 0x5e, 0x22, 0xbe, 0x42, 0x53, 0x57,
-    0xba, 0xc3, 0xd2, 0x44, 0x56, 0xe3, 0x14, 0x2f, 0x7a, 0xb3, 0xc0, 0xa3, 0xa6, 0x3f, 0x69, 0x49, 0x5b, 0xe9, 0xde, 0xd6,
-    0xae, 0xa3, 0x39, 0x18, 0x81, 0x98, 0x27, 0x93, 0x3c, 0x5b, 0xd6, 0xab, 0x48, 0xc6, 0x1e, 0x93, 0xcc, 0x9b, 0xb6, 0x0a,
-    0xba, 0x7b, 0xaa, 0x61, 0xfa, 0xd5, 0x53, 0xd6, 0x8e, 0x07, 0x6d, 0xf2, 0xbf, 0x9f, 0x99, 0xbe, 0x5d, 0x2c, 0xf1, 0xdf,
-    0xc8, 0x25, 0xf5, 0xf5, 0xe6, 0xe9, 0xaa, 0x3b, 0x70, 0xe2, 0x4e, 0x1d, 0x0d, 0x8b, 0x3f, 0xe7, 0x5f, 0x1e, 0xec, 0x7c,
-    0x82, 0x7e, 0x2d, 0xed, 0x25, 0xb2, 0x93, 0x9e, 0x49, 0xd2, 0xb4, 0x73, 0xb6, 0x9d, 0xe8, 0xd2, 0x94, 0xc8, 0x51, 0x7a,
-    0x7b, 0xa5, 0xf4, 0xcb, 0xff, 0x45, 0xc9, 0x48, 0xac, 0xed, 0x68, 0xe9, 0xa5, 0x1a, 0x63, 0xaf, 0xa1, 0x96, 0x35, 0xbd,
-    0x7b, 0xfe, 0xcf, 0x66, 0xe5, 0xba, 0x70, 0xd6, 0xf7, 0x38, 0xf1, 0x7f, 0x20, 0x37, 0x60, 0x07, 0x47, 0xef, 0x98, 0x15,
-    0x96, 0x8e, 0xaf, 0xa0, 0x27, 0xfe, 0xcf, 0x8c, 0xbc, 0x28, 0x8a, 0xd2, 0xa8, 0x80, 0xc6, 0xe8, 0x8e, 0x89, 0x58, 0xc7,
-    0xc9, 0x02, 0xb2, 0x4a, 0xe8, 0x4f, 0x57, 0x3a, 0x44, 0x67, 0xf0, 0x12, 0x9e, 0x44, 0x3d, 0xdc, 0x8c, 0x12, 0xa8, 0x89,
-    0x4e, 0x98, 0xc2, 0x68, 0x35, 0x4e, 0x6a, 0xc5, 0x97, 0xfe, 0x49, 0xc9, 0x12, 0x8f, 0xb7, 0x3b, 0x5c, 0x26, 0xdc, 0x83,
-    0x4c, 0x52, 0x1a, 0x89, 0xa7, 0x99, 0x98, 0x28, 0xed, 0x71, 0x93, 0xb5, 0x67, 0xc8, 0x85, 0x9b, 0xf1, 0x2c, 0x36, 0x30,
-    0x7d, 0xf4, 0x54, 0x04, 0x23, 0xef, 0x0f, 0xe1, 0xd8, 0xda, 0x07, 0xe4, 0x14, 0x5d, 0x5d, 0x5b, 0x6f, 0xab, 0xd8, 0x5a,
-    0xb5, 0xc4, 0x4a, 0xce, 0xa8, 0x38, 0x89, 0xd7, 0x70, 0xa3, 0xcb, 0x3a, 0x33, 0x13, 0xfb, 0xc6, 0x2d, 0x8e, 0x56, 0xf8,
-    0x07, 0xad, 0xdd, 0x0e, 0x3b, 0x2b, 0xb6, 0x13, 0xbd, 0x7f, 0xbc, 0x16, 0xff, 0x2f, 0x71, 0xf4, 0x03, 0xf1, 0x8e, 0xa0,
-    0x95, 0x41, 0x15, 0xdf, 0xeb, 0x9e, 0x2b, 0x89, 0xca, 0x1b, 0xb4, 0x83, 0xaf, 0xa8, 0x50, 0xd3, 0xab, 0xb6, 0xaf, 0xba,
-    0xd4, 0xc3, 0x8e, 0x28, 0x16, 0xd7, 0xa0, 0x39, 0x5e, 0xc0, 0x73, 0x68, 0x60, 0x8b, 0xdd, 0x5e, 0x87, 0xe4, 0xcc, 0xcc,
-    0x46, 0xe2, 0x1d, 0x75, 0xc5, 0xfb, 0xd8, 0x93, 0x34, 0xb6, 0xf6, 0x61, 0x21, 0xfa, 0x2a, 0xf9, 0xa0, 0x65, 0x65, 0x64,
-    0x96, 0x97, 0x98, 0x5c, 0x90, 0xe5, 0xb8, 0x72, 0xf8, 0xee, 0x68, 0x82, 0x5b, 0x5c, 0xd9, 0x37, 0xc4, 0x11, 0x56, 0xba,
-    0x47, 0xfb, 0xe9, 0x15, 0x8a, 0x79, 0xec, 0xcb, 0x61, 0x2b, 0xc6, 0x84, 0xd8, 0x1d, 0x1c, 0x47, 0x57, 0xed, 0x9d, 0x7d,
-    0xfa, 0xe5, 0xff, 0x9e, 0xc4, 0x7e, 0x38, 0xde, 0xd1, 0xeb, 0x0d, 0x4a, 0x39, 0x9b, 0xa9, 0x9c, 0x4c, 0x75, 0xa6, 0xbb,
-    0xe1, 0xff, 0x6c, 0x0c, 0xe3, 0x7c, 0xa3, 0xe1, 0xd9, 0xfa, 0x9d, 0x90, 0xa9, 0x96, 0x4b, 0x57, 0xf4, 0xfb, 0xa4, 0xde,
-    0xd0, 0x7a, 0xf1, 0x7f, 0x43, 0xf5, 0x18, 0x7d, 0x43, 0xe4, 0xcd, 0x23, 0x15, 0xfc, 0xe0, 0xf9, 0x39, 0x69, 0x2a, 0x33,
-    0x51, 0xec, 0xd5, 0xf3, 0x4b, 0x57, 0x26, 0x4f, 0xb5, 0xd2, 0xd4, 0x0b, 0x9e, 0x14, 0xf6, 0xea, 0x25, 0xbc, 0xa6, 0xc0,
-    0x94, 0xcf, 0x73, 0x24, 0x99, 0x7b, 0xf1, 0x1b, 0x23, 0x47, 0x80, 0xc0, 0xeb, 0x29, 0xfc, 0x11, 0x32, 0x5b, 0x11, 0xcb,
-    0x72, 0x9a, 0xbd, 0x22, 0x67, 0x98, 0xde, 0xb8, 0x91, 0x6b, 0x1b, 0xd2, 0xcd, 0x93, 0x6f, 0xc7, 0xf3, 0x64, 0x7f, 0x55,
-    0xc8, 0x91, 0x55, 0x2e, 0x70, 0xf3, 0x61, 0x64, 0x20, 0x56, 0x40, 0x8f, 0x3a, 0xe8, 0xb6, 0xec, 0xfc, 0x3f, 0x8a, 0xc4,
-    0xc7, 0x0f, 0xd7, 0x97, 0x6a, 0xe5, 0x53, 0x5e, 0x6d, 0xd9, 0xde, 0xf8, 0x34, 0x67, 0xad, 0xfc, 0x4e, 0xb0, 0x5b, 0x12,
-    0x8d, 0xa7, 0x15, 0x21, 0x5f, 0xf7, 0x27, 0xf4, 0x93, 0xe6, 0x5e, 0xd1, 0x45, 0x3c, 0xb6, 0x59, 0x75, 0xb7, 0x26, 0x67,
-    0x87, 0xb5, 0x1c, 0x7d, 0x63, 0x39, 0x47, 0xb9, 0xff, 0x6a, 0x26, 0x0e, 0xf4, 0x8d, 0xc4, 0x17, 0x30, 0x30, 0x9a, 0x42,
-    0xd7, 0xa0, 0xbd, 0x1e, 0xe2, 0x9b, 0x15, 0x54, 0x8a, 0x33, 0x23, 0xc2, 0x07, 0xca, 0xe7, 0x8e, 0xcc, 0x1c, 0xfd, 0x97,
-    0x1b, 0xdf, 0xd4, 0xf4, 0xcb, 0xff, 0x1b, 0x1c, 0xbc, 0x65, 0x45, 0xfa, 0x3b, 0xb9, 0xf6, 0xb5, 0x85, 0xb6, 0x7d, 0x8b,
-    0x3e, 0xff, 0xb3, 0xec, 0xbf, 0x57, 0xc9, 0x52, 0x2d, 0x15, 0x05, 0x50, 0x1c, 0x95, 0xd0, 0x10, 0xed, 0xf0, 0x22, 0xa3,
-    0x3f, 0x48, 0x9e, 0x0b, 0xc5, 0x1d, 0xf7, 0x0d, 0xff, 0x70, 0x57, 0x61, 0x6f, 0xfc, 0x9f, 0x8c, 0x32, 0xf8, 0x92, 0xe1,
-    0x4d, 0x7e, 0xef, 0xd5, 0x57, 0x98, 0x1f, 0x99, 0x49, 0x24, 0x94, 0x0b, 0xca, 0xfa, 0xd6, 0x11, 0xca, 0xbe, 0xa0, 0xec,
-    0x4a, 0xf3, 0x26, 0x69, 0xd1, 0x26, 0x7c, 0xc2, 0xe1, 0xec, 0x83, 0xa8, 0xe1, 0xc8, 0x38, 0xdd, 0x04, 0x5c, 0xcf, 0xbb,
-    0x6a, 0xa6, 0xc1, 0x6c, 0xa9, 0x84, 0xa9, 0xb6, 0x16, 0xae, 0x0a, 0xdb, 0xbb, 0xc6, 0xdb, 0x76, 0x50, 0x8b, 0x51, 0xcf,
-    0xa3, 0xc6, 0xe1, 0x7a, 0x62, 0x3f, 0xd8, 0x52, 0x41, 0x9e, 0xc3, 0x8f, 0xd9, 0x58, 0xd6, 0x31, 0xd3, 0xa6, 0x98, 0xff,
-    0x3b, 0x09, 0x2c, 0x0a, 0xfc, 0xc4, 0x5d, 0x96, 0xde, 0x2b, 0xde, 0x77, 0x3b, 0x8c, 0x04, 0xcb, 0xde, 0xcd, 0x7e, 0x2f,
-    0x83, 0x35, 0x2e, 0xb6, 0x28, 0x73, 0xdc, 0x6e, 0xae, 0x15, 0xd2, 0x7c, 0x97, 0xf1, 0xcb, 0x64, 0x9a, 0xbc, 0x60, 0xbc,
-    0xbe, 0xa6, 0x82, 0x5d, 0xfa, 0x59, 0x69, 0xe4, 0x97, 0xac, 0x64, 0x95, 0xbc, 0x98, 0xa2, 0xdf, 0x88, 0x65, 0x6c, 0x7b,
-    0x0f, 0xd9, 0xfc, 0xa6, 0x0a, 0x2a, 0xc4, 0x89, 0x15, 0xe3, 0x66, 0x52, 0x73, 0x11, 0xed, 0xa7, 0x83, 0x6b, 0xd1, 0x7b,
-    0x11, 0x5a, 0x17, 0xd2, 0x2b, 0xff, 0x97, 0x21, 0xfd, 0x5c, 0x45, 0x81, 0x71, 0x55, 0x4f, 0x94, 0x4f, 0x93, 0x92, 0x77,
-    0x85, 0x85, 0xff, 0xb3, 0x5a, 0xf1, 0x77, 0x93, 0x6d, 0x68, 0x4a, 0x79, 0x5a, 0xd5, 0xc7, 0x31, 0xbe, 0x2c, 0xeb, 0x05,
-    0xeb, 0x6c, 0x03, 0x87, 0x98, 0x3d, 0x7e, 0xf0, 0x7f, 0x60, 0x95, 0xf9, 0x8e, 0x91, 0xad, 0x65, 0x75, 0xf0, 0xde, 0x16,
-    0xff, 0xf2, 0x26, 0x2e, 0x32, 0x59, 0xef, 0x72, 0x15, 0x97, 0x98, 0x7a, 0x33, 0x2c, 0x4e, 0xda, 0x37, 0x64, 0x47, 0x73,
-    0xcc, 0xb0, 0x71, 0xe5, 0x71, 0x05, 0xff, 0xa3, 0x9b, 0xb8, 0x96, 0x6e, 0xe0, 0x68, 0xc0, 0xf3, 0x73, 0xe5, 0x86, 0xf7,
-    0x63, 0x11, 0x96, 0xa0, 0x89, 0x70, 0xed, 0x6f, 0x8c, 0x61, 0x16, 0xdc, 0x59, 0xf1, 0xe5, 0x47, 0x5f, 0x92, 0x09, 0x25,
-    0x7c, 0xe7, 0xd8, 0x3b, 0x89, 0x5d, 0xee, 0xcb, 0x9e, 0xc6, 0x77, 0x2a, 0x86, 0x59, 0x35, 0x2e, 0xd4, 0x8a, 0xa8, 0xbd,
-    0x5c, 0x10, 0x83, 0x59, 0x94, 0xb9, 0x45, 0xcc, 0xff, 0xcf, 0x45, 0x20, 0x0f, 0x60, 0x6a, 0x7e, 0xfe, 0xfd, 0xbe, 0xd7,
-    0x5c, 0x55, 0xb2, 0xfa, 0x05, 0x73, 0x29, 0x4e, 0xd3, 0x98, 0xe9, 0xe3, 0x38, 0x9e, 0xa6, 0xc9, 0x67, 0x90, 0xf6, 0x9e,
-    0x77, 0x2f, 0x39, 0x89, 0x5d, 0x40, 0x0d, 0x6b, 0x4f, 0x47, 0xbd, 0x5a, 0xfe, 0x62, 0xf2, 0x49, 0x9f, 0x94, 0xe8, 0xbc,
-    0x9f, 0x27, 0xfb, 0x84, 0x86, 0x64, 0xbf, 0xfe, 0x1a, 0x79, 0xfe, 0x4f, 0x26, 0x47, 0x4f, 0x30, 0xbe, 0x59, 0x05, 0x57,
-    0xf1, 0x58, 0x82, 0xf3, 0x5c, 0x3f, 0x5e, 0xe1, 0x08, 0xc1, 0xc8, 0x35, 0xfc, 0x2f, 0xf6, 0xd3, 0xfb, 0x45, 0xe1, 0x6c,
-    0x11, 0x4b, 0x46, 0xeb, 0x2c, 0x45, 0x3b, 0x19, 0x35, 0x6d, 0x98, 0x2e, 0xff, 0x67, 0x61, 0x4e, 0xc9, 0x07, 0x7c, 0xb0,
-    0x26, 0xae, 0x46, 0xac, 0xa2, 0xf9, 0x11, 0x27, 0x62, 0x2d, 0x89, 0xec, 0xdf, 0x02, 0x9d, 0x96, 0x3f, 0xfc, 0x1f, 0x90,
-    0xb5, 0xfd, 0xe0, 0xb0, 0x2f, 0xa3, 0xfc, 0x7f, 0xa3, 0x52, 0x2c, 0x94, 0xd5, 0x4a, 0x6f, 0xa6, 0x19, 0x61, 0x9b, 0x28,
-    0xb7, 0xb7, 0x1f, 0x79, 0x6a, 0x0a, 0x63, 0xb3, 0x50, 0x02, 0x33, 0x19, 0x4d, 0xe1, 0xdf, 0x8e, 0x91, 0x51, 0x02, 0x7a,
-    0xef, 0x41, 0xd8, 0x11, 0xb2, 0x22, 0x9e, 0xc6, 0x7c, 0x3c, 0x40, 0x7c, 0xbb, 0x77, 0x72, 0xd9, 0x7f, 0x2b, 0x91, 0x94,
-    0x67, 0x70, 0x88, 0x60, 0xe6, 0x45, 0x3f, 0x1c, 0x8f, 0xa6, 0xf8, 0x0a, 0x89, 0x48, 0x70, 0x71, 0x3a, 0x51, 0xd7, 0xea,
-    0xee, 0x4b, 0xca, 0xea, 0xdc, 0x5e, 0xcb, 0x13, 0x49, 0xcd, 0x67, 0xb4, 0xba, 0xc6, 0x39, 0x1a, 0x78, 0x5f, 0xb0, 0x66,
-    0xec, 0x75, 0xf4, 0x6d, 0x19, 0x26, 0xec, 0xfd, 0xba, 0x61, 0xb4, 0x9b, 0xb8, 0x24, 0x38, 0xa3, 0xc7, 0xb8, 0xb2, 0x97,
-    0x5c, 0x60, 0x61, 0x3d, 0x91, 0x88, 0x2c, 0xb0, 0x61, 0x0d, 0xb1, 0x89, 0x60, 0xef, 0xc8, 0xbd, 0x33, 0x6f, 0xe3, 0xda,
-    0x78, 0x24, 0x9f, 0xd9, 0x2b, 0x7a, 0x6a, 0xf9, 0x08, 0x8e, 0x4f, 0xf4, 0x44, 0x92, 0x1b, 0xb9, 0x74, 0x4a, 0xbc, 0xbc,
-    0x79, 0x8e, 0x59, 0x3e, 0x4b, 0x90, 0xac, 0x6f, 0x03, 0x6c, 0x63, 0x74, 0xb2, 0xe0, 0x14, 0x36, 0x4a, 0x3b, 0x1f, 0x10,
-    0xc5, 0x43, 0x44, 0xbf, 0xa6, 0xff, 0x74, 0x2f, 0x62, 0xa1, 0x63, 0xf8, 0x5f, 0xcd, 0xd6, 0xeb, 0x45, 0xa5, 0xf2, 0x27,
-    0x14, 0x6d, 0xc3, 0x46, 0x69, 0x7b, 0xfa, 0xe8, 0xf0, 0x7f, 0x66, 0x26, 0xa3, 0xf8, 0x41, 0x85, 0x88, 0x3d, 0x2a, 0xb8,
-    0x83, 0xc4, 0xa0, 0xfd, 0x9d, 0xb3, 0xe6, 0x36, 0x25, 0x32, 0xdf, 0x9e, 0x5c, 0xf4, 0x61, 0x22, 0x9f, 0x25, 0xff, 0xcd,
-    0x5d, 0xa4, 0xb3, 0xdb, 0x1d, 0x32, 0xa6, 0xd7, 0x50, 0x94, 0xaf, 0x8c, 0x25, 0x72, 0x04, 0x95, 0xf7, 0x0e, 0x51, 0xf6,
-    0x05, 0xa5, 0xb2, 0xba, 0x4b, 0xd6, 0x5e, 0x7d, 0x30, 0xd7, 0xa2, 0x60, 0x1f, 0x63, 0xd9, 0xaf, 0x1a, 0xc7, 0xb3, 0x19,
-    0xda, 0xa1, 0x3f, 0x86, 0xe0, 0x69, 0x34, 0x44, 0xa5, 0x24, 0x99, 0x42, 0x41, 0x62, 0xd5, 0xf8, 0x0e, 0xd7, 0xef, 0x1e,
-    0x8e, 0xfb, 0x97, 0x17, 0x49, 0x89, 0x5b, 0x3c, 0xc7, 0x28, 0xe9, 0x16, 0xd6, 0xd9, 0xd9, 0xca, 0x37, 0x49, 0x30, 0x6b,
-    0x17, 0x7d, 0x5e, 0xc9, 0xde, 0xab, 0xb6, 0x40, 0x12, 0xf4, 0xa2, 0x74, 0x0f, 0x26, 0xe7, 0xff, 0x39, 0x11, 0xf0, 0xff,
-    0x8b, 0x49, 0x39, 0xf7, 0xfa, 0x93, 0x55, 0x3d, 0x5c, 0xf9, 0xff, 0xd8, 0x71, 0x34, 0x9e, 0x63, 0x57, 0x1f, 0x90, 0xaf,
-    0x8c, 0x72, 0x1d, 0x1d, 0xbe, 0xa4, 0x25, 0x7b, 0x3b, 0x67, 0xed, 0xb9, 0x83, 0xbe, 0x80, 0x4b, 0x89, 0x37, 0x4e, 0x9c,
-    0x15, 0x09, 0x3a, 0x51, 0xa0, 0xa1, 0x9b, 0x4a, 0x2c, 0x14, 0x32, 0x85, 0xec, 0x52, 0xdf, 0x62, 0x7c, 0x63, 0xaf, 0x49,
-    0x39, 0x09, 0xa5, 0xc6, 0x49, 0xfa, 0xdc, 0x55, 0xeb, 0xbb, 0x12, 0xdf, 0x08, 0xfd, 0xa7, 0x1f, 0xd7, 0x5c, 0xf5, 0xae,
-    0x54, 0xfe, 0xaf, 0xa4, 0x1d, 0xa5, 0x67, 0x87, 0xa2, 0x64, 0x85, 0x66, 0xfb, 0xca, 0xe2, 0x33, 0xff, 0xc7, 0x91, 0x08,
-    0x1f, 0x01, 0xbd, 0xd3, 0x8d, 0x61, 0x88, 0x39, 0xc1, 0xf3, 0x5a, 0x58, 0xe4, 0x6a, 0xf6, 0x6f, 0x76, 0x79, 0x86, 0x39,
-    0x2f, 0x8d, 0xb4, 0x70, 0xb5, 0xe2, 0x39, 0xbd, 0x23, 0x29, 0xa7, 0xe2, 0xeb, 0xb3, 0xdd, 0x45, 0x46, 0xc1, 0xf9, 0x8e,
-    0xb1, 0x97, 0xca, 0x13, 0xed, 0xca, 0x45, 0x0f, 0x92, 0xec, 0x67, 0xc8, 0xaf, 0x79, 0x42, 0x1a, 0xd1, 0x5e, 0x2c, 0xe3,
-    0x1e, 0x4e, 0x34, 0xea, 0xd9, 0xd2, 0x9d, 0xaf, 0xae, 0x17, 0xc4, 0x59, 0xfb, 0xb4, 0x0d, 0x4a, 0xe5, 0x6f, 0x11, 0x64,
-    0xa8, 0x7e, 0x94, 0xc8, 0x82, 0x63, 0x35, 0xf9, 0x7f, 0x99, 0xb5, 0x2a, 0x64, 0x0c, 0xe3, 0x2f, 0x1d, 0x8b, 0xf7, 0xf1,
-    0xbe, 0x4f, 0x79, 0xd5, 0x22, 0xc1, 0xff, 0xc9, 0x12, 0xcd, 0x56, 0xf8, 0x92, 0x91, 0x95, 0xa5, 0x6a, 0xb0, 0x63, 0x3d,
-    0x7a, 0x2a, 0x8c, 0x25, 0x91, 0x38, 0xf9, 0x92, 0xaf, 0x92, 0x96, 0x57, 0x2d, 0xdf, 0xab, 0xfb, 0x67, 0xe9, 0x59, 0x24,
-    0x8e, 0xc4, 0x3d, 0x0e, 0xf0, 0x75, 0x09, 0xc6, 0xfe, 0xeb, 0x29, 0x8f, 0x9a, 0xaa, 0x8d, 0x2e, 0x9e, 0x6e, 0x44, 0xe6,
-    0x78, 0x06, 0xc3, 0xff, 0x8e, 0x91, 0x6c, 0xf8, 0x99, 0x2f, 0xe5, 0x96, 0x95, 0x3b, 0x15, 0x25, 0x8d, 0x7b, 0x15, 0x6b,
-    0x56, 0xe7, 0xff, 0x31, 0x61, 0x62, 0x7f, 0xfa, 0x15, 0x79, 0xf6, 0xfd, 0x9f, 0x47, 0x90, 0xff, 0xa9, 0xef, 0xf5, 0x06,
-    0xae, 0xfc, 0xf9, 0xa2, 0x92, 0xb7, 0xf1, 0x7d, 0x5a, 0x71, 0x98, 0xae, 0x77, 0x91, 0x5d, 0xe7, 0x26, 0xb2, 0x66, 0x55,
-    0x93, 0x58, 0x22, 0x04, 0x65, 0x9c, 0x2f, 0xbb, 0xfe, 0x3e, 0x9b, 0x89, 0x56, 0x90, 0xa7, 0x47, 0x78, 0x8d, 0xe9, 0xf9,
-    0xe9, 0x0e, 0x3b, 0xd3, 0x7d, 0x57, 0x14, 0xfb, 0x07, 0x70, 0x58, 0x2b, 0x9f, 0xca, 0x55, 0xc4, 0x53, 0x50, 0xe4, 0x21,
-    0x52, 0x4c, 0x8b, 0xff, 0xb3, 0x59, 0x67, 0xd2, 0xdf, 0xd2, 0x4d, 0x9f, 0x45, 0x8a, 0xff, 0x53, 0xf7, 0xf5, 0xe3, 0x42,
-    0x2c, 0x60, 0x07, 0xb8, 0xb2, 0x1d, 0x49, 0xb4, 0x4e, 0xc0, 0x79, 0x42, 0xc6, 0xfe, 0x26, 0xe1, 0xd9, 0xe6, 0x13, 0xae,
-    0xa5, 0x55, 0x42, 0x88, 0x1d, 0x81, 0x7d, 0x07, 0x40, 0x63, 0x77, 0xec, 0x41, 0x31, 0xac, 0xb2, 0xe4, 0xa8, 0xee, 0xb2,
-    0x0d, 0x0e, 0xf1, 0xb4, 0x7e, 0x36, 0x21, 0xa7, 0xcf, 0xb8, 0x88, 0x8c, 0x92, 0xf2, 0x38, 0x97, 0x82, 0xc7, 0xd3, 0xd1,
-    0x79, 0xe0, 0x77, 0xed, 0x31, 0x36, 0x8c, 0xac, 0xc0, 0x05, 0x24, 0x35, 0x1f, 0x55, 0xcc, 0x27, 0xac, 0xcf, 0xff, 0xad,
-    0x19, 0x6d, 0xf2, 0x8d, 0x3e, 0xf7, 0xc8, 0x51, 0xc9, 0x59, 0x36, 0xb2, 0xfc, 0xff, 0x8e, 0xc3, 0x29, 0x2b, 0x68, 0x81,
-    0xd6, 0x5b, 0xc9, 0x8e, 0x06, 0x0a, 0xb6, 0x77, 0x03, 0xc8, 0xbe, 0x4a, 0xd5, 0xfa, 0xa8, 0x37, 0x89, 0x3b, 0x22, 0x2b,
-    0xb7, 0x9b, 0x68, 0x1e, 0xdd, 0xf5, 0x08, 0xb5, 0x4d, 0xf8, 0xc2, 0xd1, 0x77, 0x51, 0x94, 0x05, 0x7a, 0x81, 0x75, 0xff,
-    0xcb, 0x2b, 0x8e, 0xff, 0x27, 0x24, 0x9d, 0x8b, 0xdf, 0x47, 0x27, 0x45, 0x8f, 0xc7, 0x44, 0x6b, 0x15, 0x67, 0xad, 0xd6,
-    0x82, 0x3b, 0xbe, 0x5a, 0x5a, 0xfc, 0xdf, 0x50, 0x2b, 0xc3, 0x76, 0x74, 0xa0, 0x04, 0xc6, 0xa5, 0x60, 0x2e, 0xd9, 0x0f,
-    0x8d, 0xb3, 0x61, 0x26, 0xd1, 0x38, 0xdb, 0xef, 0x95, 0xd5, 0x7c, 0x63, 0x31, 0x4c, 0x66, 0xb2, 0x3b, 0x5d, 0xd2, 0xce,
-    0xab, 0x13, 0x4b, 0x3c, 0xfc, 0xa8, 0xf5, 0xfd, 0x72, 0x61, 0x44, 0xbd, 0x91, 0x92, 0xdc, 0x1b, 0xb7, 0x92, 0xb6, 0x14,
-    0x10, 0xae, 0x9c, 0x33, 0x48, 0xa9, 0x60, 0x24, 0xb0, 0x67, 0x5c, 0xf6, 0x7a, 0x27, 0x52, 0x97, 0xfe, 0xd3, 0x4f, 0x92,
-    0x75, 0xec, 0x4a, 0x9b, 0xe3, 0xea, 0xb8, 0x9b, 0x70, 0xb9, 0x6a, 0x04, 0xca, 0x47, 0x94, 0xfc, 0xaf, 0xcb, 0x93, 0x52,
-    0x63, 0x7c, 0xe5, 0xff, 0x2a, 0xc4, 0x83, 0xe9, 0xb4, 0x43, 0x9e, 0x46, 0x6f, 0x16, 0x52, 0xbb, 0x38, 0xd2, 0xe5, 0x03,
-    0x0e, 0xf8, 0x93, 0x91, 0x4c, 0x24, 0xff, 0xed, 0x73, 0x97, 0x2d, 0x99, 0x4c, 0x22, 0x77, 0xf0, 0xee, 0xaf, 0x22, 0x39,
-    0x0b, 0x54, 0x3c, 0x80, 0x54, 0xa4, 0xdd, 0x9b, 0x5c, 0x64, 0xdc, 0x7c, 0x87, 0xc4, 0xf7, 0x95, 0x95, 0x9b, 0xe3, 0x69,
-    0x46, 0xb3, 0xb6, 0x0c, 0x62, 0xeb, 0xb1, 0xf7, 0x52, 0xb8, 0x29, 0x11, 0x8b, 0x04, 0x72, 0xd3, 0x95, 0x2e, 0x62, 0x22,
-    0x5c, 0xa9, 0xf8, 0xd7, 0xda, 0x81, 0xb2, 0x7f, 0xdf, 0xe7, 0xa0, 0xf1, 0x11, 0xf1, 0xff, 0x1b, 0xca, 0x39, 0xa5, 0xa3,
-    0x11, 0xc1, 0x98, 0xa6, 0xdd, 0x43, 0xee, 0x35, 0x53, 0x8c, 0x38, 0xa3, 0x8a, 0x16, 0x4c, 0xfc, 0xae, 0x95, 0x9a, 0x4f,
-    0xb7, 0x24, 0xb6, 0x88, 0x54, 0xfe, 0x7d, 0x40, 0xe8, 0xbb, 0xdd, 0xd9, 0xf2, 0x3e, 0xcc, 0xc8, 0x89, 0x2f, 0x18, 0x8c,
-    0x7a, 0x19, 0x27, 0xb1, 0x88, 0x9d, 0x15, 0x72, 0xf6, 0xf9, 0xdb, 0xb5, 0x86, 0xed, 0x01, 0xb2, 0xca, 0x7b, 0x89, 0x00,
-    0xb5, 0xcd, 0xcc, 0x62, 0x05, 0x86, 0xf9, 0x4e, 0x43, 0x3e, 0x95, 0xa8, 0x10, 0x5b, 0xa1, 0x9b, 0x62, 0x2e, 0x17, 0x5d,
-    0xfe, 0xcf, 0x61, 0x8d, 0xe0, 0x80, 0x64, 0xa7, 0x71, 0x18, 0xfa, 0x64, 0x95, 0x27, 0xbd, 0x93, 0x5f, 0xf6, 0xff, 0x6c,
-    0x84, 0xa2, 0xc5, 0xdc, 0xfb, 0xb3, 0x88, 0xdf, 0x8e, 0x38, 0xb2, 0xee, 0x68, 0x0d, 0x3d, 0xcc, 0x55, 0xe4, 0xdb, 0xaa,
-    0xdb, 0xb5, 0xad, 0x55, 0xe4, 0xd3, 0x6e, 0x64, 0x27, 0xe2, 0x46, 0xf7, 0x5b, 0x97, 0x58, 0x44, 0x6c, 0x97, 0xe8, 0x44,
-    0xaf, 0xc5, 0x28, 0x8c, 0x65, 0x3c, 0x91, 0x58, 0x04, 0xe3, 0xdf, 0x75, 0x35, 0x6b, 0x80, 0x03, 0x7e, 0x16, 0x44, 0xbb,
-    0xfb, 0x94, 0x9c, 0x1c, 0x78, 0x52, 0xa5, 0xf7, 0xb9, 0x51, 0x42, 0xf2, 0x59, 0xd9, 0x43, 0x13, 0xc2, 0x6a, 0xfd, 0x17,
-    0x2e, 0xbc, 0x2c, 0x91, 0x2c, 0xbd, 0x60, 0xdd, 0x6b, 0xe0, 0xd3, 0xdb, 0x9a, 0x92, 0x1d, 0xc0, 0x29, 0x2d, 0x5f, 0xc0,
-    0x2c, 0x44, 0x36, 0xd8, 0x80, 0x1b, 0xcf, 0xe9, 0x59, 0xc9, 0xb9, 0xae, 0xb0, 0x54, 0x03, 0x52, 0x5a, 0xea, 0x13, 0x33,
-    0xc7, 0x07, 0xcd, 0x45, 0x28, 0x1b, 0xe8, 0x5b, 0x40, 0x8e, 0xf6, 0x2c, 0x6b, 0xbc, 0xfc, 0x91, 0x91, 0x78, 0x82, 0xea,
-    0x48, 0x69, 0x82, 0xde, 0xd9, 0x5b, 0x85, 0x65, 0x16, 0x90, 0x91, 0x9b, 0xc5, 0x47, 0xfe, 0xa7, 0x59, 0x05, 0x7b, 0x84,
-    0xc5, 0xe3, 0xea, 0x98, 0x8b, 0x13, 0x70, 0x38, 0xf8, 0x3f, 0x13, 0x89, 0x85, 0x3b, 0xdc, 0xc1, 0xc6, 0x15, 0xa8, 0x27,
-    0x94, 0xca, 0xfd, 0xa4, 0xa1, 0x87, 0xa9, 0x47, 0x6a, 0xac, 0xed, 0x3b, 0xff, 0xb7, 0x23, 0x5e, 0xc7, 0x6e, 0x7c, 0x33,
-    0x4e, 0x39, 0x78, 0x67, 0xea, 0xea, 0xc0, 0x83, 0x59, 0xbf, 0x0c, 0x62, 0x1c, 0xed, 0xf8, 0xbb, 0xdb, 0x3c, 0x03, 0x13,
-    0xc9, 0xd9, 0x34, 0x34, 0x4a, 0x54, 0x30, 0xbb, 0xfd, 0x12, 0xae, 0x45, 0xda, 0xfb, 0xe9, 0xb2, 0x37, 0x96, 0x59, 0x7b,
-    0x9e, 0xdc, 0x12, 0xb9, 0xa1, 0x7f, 0xf1, 0xfb, 0xbe, 0x20, 0x23, 0xbe, 0xbc, 0xc6, 0x73, 0xfd, 0x85, 0x1a, 0xae, 0xd4,
-    0xfd, 0xdc, 0x38, 0xa1, 0xc7, 0xdc, 0x29, 0xce, 0xce, 0x9a, 0xea, 0x7b, 0x1e, 0x76, 0xf0, 0x8a, 0x9d, 0xcb, 0x44, 0xe8,
-    0x70, 0x9f, 0x6f, 0xa8, 0xac, 0xa3, 0x8d, 0x89, 0x0c, 0x6f, 0x6b, 0x7b, 0x1b, 0x5d, 0x79, 0x68, 0x48, 0x4e, 0xd2, 0x3a,
-    0x3e, 0xcc, 0x43, 0xc9, 0x39, 0x8e, 0xbf, 0x8b, 0xcf, 0x8d, 0x7f, 0x5c, 0xe4, 0xf9, 0x76, 0xe6, 0xff, 0x02, 0xc4, 0xfb,
-    0xf0, 0xb3, 0xb0, 0xe4, 0x5e, 0xa1, 0x51, 0xf5, 0x3b, 0xa7, 0x29, 0xff, 0x53, 0x2f, 0xb5, 0x07, 0x04, 0xef, 0xda, 0xe7,
-    0x18, 0xdb, 0xa7, 0x11, 0xa9, 0xa5, 0xaf, 0xe3, 0x3b, 0x7b, 0xba, 0x8a, 0xb9, 0x35, 0x45, 0x71, 0xaf, 0x1d, 0x94, 0xfd,
-    0x7e, 0xee, 0x62, 0x35, 0x38, 0xc2, 0xe4, 0x68, 0xf6, 0x23, 0xde, 0xd5, 0x45, 0xad, 0x9c, 0x08, 0x57, 0x26, 0x3a, 0x08,
-    0x75, 0x3b, 0xef, 0x30, 0xb1, 0x6a, 0xec, 0xeb, 0xc0, 0x40, 0xe2, 0xbd, 0x1d, 0xcf, 0x89, 0x08, 0x7a, 0x6b, 0x58, 0x5b,
-    0x9d, 0x09, 0xad, 0xb0, 0x02, 0xf3, 0x7c, 0xce, 0xcf, 0x14, 0x6b, 0xad, 0x6a, 0x7b, 0x25, 0x9e, 0x95, 0x7e, 0xea, 0x9b,
-    0xa9, 0xb7, 0x8b, 0x7a, 0x06, 0xaf, 0xc2, 0xd6, 0x2a, 0x99, 0x10, 0xe2, 0xd3, 0x95, 0xba, 0x4b, 0x99, 0x2f, 0x8c, 0x35,
-    0xc9, 0xb7, 0x56, 0xfa, 0x85, 0x58, 0x7d, 0x67, 0x94, 0xf2, 0xff, 0x20, 0xe6, 0xfc, 0xbf, 0xc8, 0x75, 0x0c, 0xa3, 0x7c,
-    0x2e, 0xf7, 0x3e, 0xc9, 0xf8, 0x48, 0x92, 0xa5, 0xd1, 0xc0, 0xae, 0x8f, 0xfd, 0x4a, 0xd3, 0x0a, 0x2b, 0x91, 0xc4, 0x94,
-    0xe1, 0x7d, 0xdf, 0x69, 0xe4, 0xdb, 0x3d, 0xe4, 0x23, 0xff, 0x8f, 0x23, 0x7a, 0xa5, 0xf0, 0xe4, 0x5f, 0xa5, 0x7e, 0x85,
-    0xd5, 0xd2, 0x90, 0xff, 0xab, 0x12, 0x8b, 0xdb, 0x0b, 0xb8, 0x5a, 0x50, 0xaa, 0x0b, 0xd9, 0xc1, 0x35, 0xe5, 0xb6, 0x66,
-    0x0d, 0x89, 0x91, 0x90, 0x5d, 0x43, 0x93, 0x7f, 0xd4, 0xd5, 0x2a, 0x75, 0x5c, 0xf2, 0x55, 0x32, 0x92, 0xb8, 0x82, 0x23,
-    0xb5, 0x77, 0x65, 0x34, 0xb3, 0xe0, 0x6e, 0x4f, 0xf1, 0xef, 0x83, 0x71, 0xa9, 0xe6, 0x9b, 0x35, 0x40, 0x41, 0xdb, 0x17,
-    0x94, 0xe3, 0x65, 0xb2, 0xc5, 0x40, 0x3c, 0xc2, 0x64, 0x7b, 0x7e, 0x0d, 0x6d, 0x71, 0x0b, 0xae, 0x45, 0x55, 0x3c, 0x8e,
-    0x25, 0x8c, 0xf5, 0xda, 0x74, 0x94, 0x43, 0x13, 0x7c, 0x4a, 0x46, 0x74, 0x78, 0x65, 0xb2, 0xb9, 0x49, 0xd4, 0xbb, 0x2f,
-    0xc2, 0x10, 0x55, 0x90, 0xb7, 0xff, 0x2c, 0xc8, 0x95, 0x77, 0x78, 0xc5, 0x2d, 0xa4, 0x17, 0x07, 0x2b, 0x3f, 0x15, 0xf4,
-    0xc6, 0x7f, 0x53, 0x68, 0x41, 0xb3, 0x3f, 0xc4, 0x2b, 0x6e, 0x83, 0x34, 0xe6, 0xe7, 0x44, 0xa5, 0x73, 0xc4, 0x75, 0x64,
-    0xbd, 0xf1, 0xca, 0xbf, 0xb1, 0x44, 0xfb, 0x51, 0xcb, 0x83, 0x16, 0xb7, 0xbf, 0x99, 0xc5, 0x5c, 0x64, 0x23, 0xf2, 0xd4,
-    0x27, 0x5d, 0xef, 0xae, 0x78, 0xfd, 0xdb, 0x90, 0xc9, 0x8f, 0x16, 0xef, 0x1b, 0xff, 0x17, 0x25, 0x96, 0x7f, 0x9d, 0xc3,
-    0x7c, 0xda, 0x01, 0xce, 0x68, 0xc4, 0xbe, 0xd7, 0xe7, 0xff, 0x7a, 0x18, 0x2d, 0x8c, 0x59, 0x94, 0x1d, 0x83, 0x98, 0x48,
-    0x84, 0xe2, 0x99, 0x9f, 0x95, 0xe4, 0xc8, 0x3c, 0x1b, 0xb2, 0x5f, 0xc9, 0x42, 0x32, 0x7f, 0x02, 0x4f, 0x6b, 0x49, 0xf2,
-    0xbf, 0xd1, 0xf8, 0xcd, 0x77, 0x31, 0xbe, 0xca, 0xce, 0xf1, 0x43, 0x81, 0x16, 0x5a, 0x7a, 0xc0, 0x0f, 0x18, 0x36, 0x39,
-    0xeb, 0x31, 0xd7, 0xe8, 0xba, 0x08, 0xe4, 0x9f, 0x8d, 0x5e, 0xe4, 0x42, 0x67, 0xac, 0xc7, 0xeb, 0x1a, 0x71, 0x8f, 0x82,
-    0xd6, 0x12, 0x76, 0xbf, 0xa6, 0xb6, 0x2e, 0xbd, 0xe1, 0x4e, 0xa3, 0x6a, 0x84, 0x64, 0x16, 0x4e, 0xb1, 0x31, 0xf5, 0xd0,
-    0xdc, 0xaa, 0x73, 0xa0, 0xc4, 0xcb, 0x76, 0xa4, 0x8f, 0xbf, 0xa4, 0x89, 0x76, 0x0e, 0xb5, 0xc0, 0x9e, 0x21, 0xc1, 0x92,
-    0xbc, 0x14, 0x92, 0xe8, 0xe0, 0x1e, 0xb0, 0x79, 0x0b, 0xca, 0xb2, 0x9a, 0x05, 0xa2, 0x06, 0x1f, 0x26, 0x52, 0xfd, 0x89,
-    0x1c, 0x9d, 0x6e, 0x2c, 0x3a, 0x30, 0x1a, 0xba, 0xe0, 0xd5, 0xc9, 0xe5, 0xaf, 0x3f, 0xe0, 0x3a, 0xc2, 0x76, 0x2c, 0x69,
-    0xed, 0x13, 0x86, 0xeb, 0x05, 0x91, 0xc5, 0x82, 0x39, 0xde, 0xf3, 0x68, 0xef, 0x4b, 0x2f, 0x11, 0x8b, 0xd0, 0x8a, 0x36,
-    0xb9, 0xcd, 0x9f, 0x2e, 0x33, 0xb4, 0x39, 0xf1, 0xff, 0x43, 0x44, 0xef, 0xe0, 0x2e, 0xe6, 0xea, 0x4c, 0x3c, 0x20, 0xf4,
-    0x46, 0x2d, 0x80, 0x97, 0xc8, 0xfe, 0x02, 0x9a, 0x19, 0xf3, 0x75, 0xf9, 0x7f, 0x7c, 0xd2, 0x3c, 0x5a, 0x83, 0x97, 0xd0,
-    0x01, 0x75, 0x70, 0x6d, 0xd2, 0x2e, 0x29, 0x3b, 0x6e, 0x41, 0x53, 0x0c, 0xb4, 0xe5, 0x99, 0x5d, 0x2b, 0x8d, 0x5f, 0xd1,
-    0x8f, 0xc9, 0xc2, 0xdd, 0xc1, 0x92, 0xc3, 0xc6, 0xe3, 0x36, 0x26, 0x2f, 0xf2, 0x8f, 0x0a, 0x51, 0x30, 0x62, 0x49, 0x96,
-    0xf9, 0xc9, 0xae, 0xf5, 0x94, 0x43, 0xb8, 0xf2, 0xc1, 0x07, 0x89, 0xed, 0xde, 0x41, 0xc5, 0x9c, 0xe3, 0xd9, 0xf0, 0x14,
-    0x89, 0xe6, 0x9b, 0xea, 0xcb, 0x5c, 0xcb, 0xd3, 0xa8, 0x2f, 0x6e, 0xc9, 0xae, 0xb6, 0x5c, 0x81, 0x73, 0xbe, 0x02, 0x59,
-    0xa1, 0x5f, 0xd6, 0xb6, 0x79, 0xdb, 0x1b, 0xf2, 0x65, 0x1f, 0x22, 0xfb, 0x4f, 0xd5, 0xeb, 0x4f, 0x05, 0x2f, 0xd4, 0x18,
-    0x9f, 0x76, 0x78, 0x81, 0xeb, 0x25, 0xdf, 0xea, 0x95, 0x59, 0xf8, 0xf5, 0x75, 0xb5, 0xb7, 0x75, 0xc2, 0xab, 0x2e, 0xf6,
-    0x31, 0xc1, 0xf8, 0xd8, 0xfd, 0xb8, 0xb2, 0x91, 0xc3, 0x96, 0x14, 0xad, 0x24, 0x59, 0xfb, 0x36, 0x58, 0x7b, 0xb3, 0x12,
-    0x82, 0x7a, 0x9f, 0xb6, 0x65, 0x27, 0xe8, 0x8a, 0x9a, 0x49, 0xbe, 0x80, 0xb9, 0x51, 0x0b, 0x7d, 0x30, 0xcf, 0xca, 0xf5,
-    0x97, 0x1a, 0x1b, 0x7e, 0x19, 0xd1, 0xb3, 0xd5, 0x73, 0xf5, 0xeb, 0x3f, 0x74, 0x6d, 0x2d, 0x42, 0x73, 0x07, 0x95, 0x35,
-    0x5c, 0xcf, 0xc5, 0x22, 0x97, 0x39, 0xde, 0xed, 0xf1, 0x20, 0x03, 0x92, 0xc1, 0xe7, 0x52, 0xbc, 0x42, 0x73, 0xa0, 0x0d,
-    0xd9, 0xb5, 0x05, 0xa2, 0xe4, 0xc6, 0xfa, 0xc8, 0xff, 0xc3, 0x08, 0x0b, 0x0c, 0x73, 0xc4, 0x10, 0x81, 0xfc, 0xee, 0x28,
-    0xa6, 0xa3, 0x3f, 0x1e, 0xc2, 0x6d, 0x29, 0x2c, 0x94, 0x17, 0xe5, 0xd1, 0x10, 0x23, 0x6c, 0x39, 0xb1, 0xde, 0x77, 0x6d,
-    0x53, 0xa9, 0xc6, 0xff, 0x6b, 0x43, 0x72, 0x7e, 0x1d, 0xe1, 0xc6, 0x00, 0x3f, 0xe9, 0x10, 0x2d, 0x3f, 0x57, 0x48, 0x8e,
-    0xd8, 0xdf, 0x31, 0x0b, 0x9f, 0x12, 0x26, 0x4f, 0xde, 0xe1, 0xdd, 0xa7, 0xc4, 0x8d, 0x70, 0x61, 0xfd, 0x9f, 0xac, 0x53,
-    0x3f, 0x47, 0x9e, 0xdd, 0x82, 0xea, 0x84, 0x29, 0x62, 0x71, 0x0b, 0x93, 0xa9, 0x21, 0x51, 0x6a, 0x1f, 0xdd, 0x04, 0x03,
-    0xf1, 0x3a, 0x3e, 0xc6, 0x46, 0x1c, 0xe4, 0x44, 0x42, 0xdb, 0x92, 0x12, 0x5b, 0xd4, 0x3d, 0xba, 0x5e, 0xd1, 0xe7, 0x82,
-    0x57, 0x99, 0xac, 0xc5, 0xd9, 0x15, 0xf7, 0x0c, 0xc1, 0xef, 0xd0, 0x2e, 0xe4, 0x6e, 0x7e, 0xe2, 0xf7, 0xce, 0x5e, 0xa7,
-    0x48, 0xe6, 0xd9, 0xe0, 0xf5, 0xbd, 0x24, 0xb3, 0x66, 0x38, 0xac, 0xe6, 0xfc, 0xf2, 0xc6, 0x73, 0xb2, 0xf0, 0x9b, 0xa7,
-    0x1d, 0xd5, 0xb8, 0x38, 0x9e, 0x70, 0xd0, 0x63, 0x35, 0x26, 0x3d, 0x7f, 0x4e, 0xd1, 0x63, 0x26, 0x98, 0x9f, 0xec, 0x37,
-    0x81, 0xdd, 0x75, 0x47, 0xb2, 0x0f, 0xef, 0x8a, 0xdb, 0x50, 0x1e, 0xed, 0x49, 0x64, 0x8e, 0x41, 0x92, 0xc8, 0x28, 0xeb,
-    0x38, 0xdf, 0xf3, 0x1f, 0xce, 0xaa, 0xf5, 0x6f, 0x52, 0x66, 0xc9, 0xbc, 0xd8, 0x49, 0xd6, 0xeb, 0xc2, 0x9e, 0xe4, 0x38,
-    0x87, 0x34, 0xed, 0x38, 0x3a, 0x5d, 0xc1, 0x11, 0xbe, 0x54, 0xad, 0x2b, 0xce, 0x6b, 0xe4, 0x01, 0xe5, 0x49, 0x9e, 0x37,
-    0xd8, 0xbe, 0xfa, 0x61, 0xfc, 0x61, 0x1b, 0x0b, 0x7f, 0x68, 0x9e, 0xd2, 0x9d, 0xf8, 0xff, 0x23, 0xad, 0x73, 0xc6, 0xf9,
-    0x90, 0xe7, 0x1f, 0x0e, 0x29, 0x73, 0x4c, 0x90, 0x09, 0x73, 0x9f, 0xab, 0x0c, 0xd0, 0xea, 0xfc, 0x9f, 0x99, 0xe1, 0x4b,
-    0xf1, 0x75, 0x48, 0x21, 0x03, 0x4f, 0x16, 0x4c, 0x77, 0x3c, 0x71, 0xa9, 0x65, 0xb9, 0x71, 0x67, 0xfd, 0x6f, 0xdf, 0x9b,
-    0xa5, 0xf6, 0xfe, 0x36, 0xcc, 0xc1, 0xdb, 0x58, 0xcb, 0x68, 0x32, 0x9c, 0x25, 0x0b, 0x6b, 0x84, 0xbf, 0x22, 0x01, 0xd3,
-    0x7c, 0x88, 0xd6, 0x3b, 0xd7, 0x5a, 0x91, 0xb2, 0x5c, 0x71, 0x73, 0x3e, 0x33, 0xb1, 0xca, 0x0d, 0x5c, 0x6d, 0x94, 0xa5,
-    0x66, 0xc1, 0xb8, 0x0d, 0x79, 0xb9, 0x11, 0x26, 0x5f, 0xc7, 0x4a, 0x12, 0x37, 0xeb, 0x2c, 0xbe, 0xc3, 0xd3, 0xc8, 0x89,
-    0x38, 0x74, 0x27, 0x91, 0xec, 0x12, 0xb0, 0x05, 0x2f, 0x0b, 0xb2, 0x66, 0xf9, 0x8b, 0x96, 0xcc, 0xa8, 0xf1, 0x6f, 0xbf,
-    0x21, 0xb3, 0xf0, 0xdb, 0x65, 0xed, 0xaa, 0x54, 0x99, 0xaa, 0x4f, 0x52, 0x4f, 0xbd, 0x87, 0x46, 0xdc, 0x5d, 0xc0, 0xd5,
-    0x18, 0xc5, 0x48, 0xd3, 0xd5, 0x62, 0xa8, 0x64, 0x20, 0x9c, 0xfb, 0x90, 0xd0, 0x42, 0x6f, 0xbb, 0x70, 0x8e, 0xfd, 0x22,
-    0x9d, 0x15, 0xd9, 0x30, 0x91, 0xb3, 0x27, 0xb7, 0x5f, 0xcb, 0x2d, 0x09, 0x42, 0x29, 0x62, 0x21, 0xb2, 0xc8, 0x45, 0x7f,
-    0x5f, 0x4b, 0x6a, 0xd5, 0xcb, 0xef, 0x32, 0x4f, 0x62, 0x01, 0x61, 0x10, 0x40, 0x7b, 0xb2, 0x4f, 0x77, 0xb7, 0xaa, 0x16,
-    0xb3, 0xe6, 0x83, 0x48, 0xcb, 0x77, 0x9b, 0x07, 0x8f, 0xcf, 0xbc, 0xd2, 0xf8, 0x71, 0xee, 0xf8, 0xff, 0x15, 0xc5, 0x27,
-    0x7f, 0xf0, 0x60, 0x9d, 0xac, 0xc6, 0xff, 0xb7, 0x08, 0x72, 0x7e, 0x82, 0xb1, 0x3f, 0x18, 0xa6, 0xbc, 0x5a, 0x76, 0x61,
-    0x62, 0x85, 0xc0, 0xa6, 0x3f, 0x50, 0xf5, 0x47, 0xea, 0xe9, 0x21, 0xe3, 0x76, 0x66, 0x4c, 0x52, 0x58, 0x1b, 0x02, 0xe7,
-    0x3f, 0xf9, 0xa9, 0xf3, 0x2b, 0xc1, 0xb7, 0x7c, 0x47, 0x90, 0x67, 0x5e, 0x1f, 0x15, 0x31, 0x0c, 0x3b, 0x7c, 0xd5, 0xd2,
-    0xa6, 0x17, 0xc4, 0x33, 0xb9, 0x5e, 0xd5, 0xb3, 0x3b, 0x96, 0x20, 0x2c, 0xfe, 0x85, 0xc4, 0x9e, 0xa7, 0x08, 0x6a, 0xa3,
-    0x1a, 0xae, 0x62, 0x18, 0x30, 0x17, 0xaa, 0xa2, 0x1d, 0x06, 0xa3, 0x3e, 0xc7, 0x63, 0x2e, 0x7c, 0xfb, 0x9c, 0x6f, 0x2d,
-    0xa9, 0xda, 0x24, 0xdf, 0x6a, 0x95, 0x59, 0xf8, 0xe5, 0xb0, 0xc6, 0xbe, 0xba, 0xdd, 0xcc, 0x7a, 0xe6, 0x1c, 0xb2, 0x1d,
-    0x9f, 0x62, 0x32, 0x06, 0x62, 0x00, 0x26, 0x62, 0x1e, 0xbe, 0xb5, 0xad, 0x0f, 0x7b, 0x15, 0xd7, 0xe8, 0xa0, 0x3d, 0xf0,
-    0x1a, 0xc9, 0x3e, 0xa4, 0xac, 0x20, 0xbf, 0xf6, 0x4e, 0x05, 0xcb, 0x9a, 0xbb, 0x6d, 0x72, 0x7e, 0xd8, 0xe4, 0x8c, 0xcf,
-    0x32, 0xf1, 0x81, 0x1a, 0x93, 0x13, 0xa1, 0x9b, 0xa8, 0xb8, 0xbb, 0x5d, 0x6a, 0x63, 0x83, 0x1a, 0xe8, 0xe6, 0x86, 0xeb,
-    0xb9, 0x58, 0xee, 0x83, 0x7f, 0x64, 0x11, 0xc1, 0x6a, 0x9d, 0xcc, 0xa1, 0x37, 0x7b, 0x8a, 0xf8, 0x90, 0x97, 0x73, 0xce,
-    0xbd, 0xe4, 0x91, 0xff, 0xbf, 0x56, 0x78, 0xea, 0x00, 0x9e, 0xf2, 0x94, 0x75, 0x5b, 0x55, 0xfe, 0x5f, 0x02, 0xcf, 0x62,
-    0x25, 0x63, 0xd7, 0xc6, 0x66, 0xfd, 0x9a, 0xae, 0xe9, 0xf3, 0x5a, 0x03, 0x9b, 0x88, 0x44, 0x27, 0xa8, 0x3d, 0x98, 0x28,
-    0x89, 0x0c, 0xe4, 0x8f, 0xf5, 0x7f, 0x10, 0xb5, 0x48, 0xd4, 0x11, 0xde, 0xf5, 0x2f, 0xba, 0x3b, 0x4a, 0x31, 0x17, 0x85,
-    0x9c, 0xfa, 0xb7, 0x60, 0x74, 0x18, 0x64, 0xc6, 0xf1, 0x57, 0xe4, 0xac, 0x1f, 0xce, 0xc8, 0x96, 0xd4, 0xf3, 0xa2, 0x8c,
-    0x20, 0xcf, 0x8d, 0x4b, 0x17, 0xbf, 0xb4, 0x3c, 0x5e, 0xc3, 0x60, 0x1f, 0x3d, 0xf1, 0xfd, 0xc6, 0x35, 0x82, 0x8c, 0xbf,
-    0xfc, 0x95, 0xec, 0x5e, 0xa5, 0x3a, 0xf3, 0x58, 0xe7, 0xed, 0x44, 0x07, 0x89, 0x5f, 0x26, 0x0c, 0xb7, 0xad, 0x3d, 0x89,
-    0x78, 0x15, 0x59, 0x95, 0xde, 0x92, 0x1d, 0x43, 0xb0, 0x39, 0x64, 0x2d, 0xbe, 0x84, 0xd5, 0xe8, 0xc9, 0xf1, 0x53, 0x9a,
-    0x48, 0x7c, 0x83, 0x4a, 0x68, 0xf7, 0x52, 0x30, 0x9b, 0xc7, 0x6c, 0x8d, 0xa7, 0xae, 0x23, 0x5a, 0xd5, 0x5c, 0x86, 0xeb,
-    0xb9, 0x67, 0xf7, 0x4b, 0xda, 0xd1, 0xf9, 0xf8, 0x3a, 0xa1, 0x9e, 0x9c, 0x35, 0xff, 0x28, 0xc6, 0x86, 0x21, 0xaf, 0x5a,
-    0x36, 0x4d, 0x3b, 0xa3, 0xf3, 0x9c, 0x51, 0xdf, 0x1c, 0xd3, 0x6d, 0xd6, 0x75, 0x2c, 0x3f, 0x0d, 0x88, 0x70, 0x3e, 0xb8,
-    0x5c, 0xa8, 0x89, 0xde, 0x98, 0x81, 0xcf, 0xb0, 0x1e, 0x3b, 0xf0, 0x29, 0x26, 0xa2, 0x2b, 0xea, 0xe3, 0x3a, 0x97, 0x99,
-    0xd1, 0x32, 0xa3, 0x32, 0xda, 0xe1, 0x75, 0xac, 0xc5, 0x46, 0x2c, 0xc2, 0x64, 0xb4, 0x8c, 0x78, 0x76, 0xbb, 0x5c, 0x98,
-    0x22, 0xd0, 0x6c, 0x24, 0x60, 0xb2, 0x24, 0x5b, 0x44, 0x10, 0xef, 0x25, 0x49, 0x8e, 0xf6, 0x63, 0x0b, 0x96, 0x62, 0x0c,
-    0x1a, 0xba, 0xd6, 0xc3, 0x18, 0xf0, 0x59, 0x67, 0xa7, 0x25, 0xf5, 0xeb, 0xaa, 0xf5, 0x5d, 0xf7, 0x90, 0x6f, 0x39, 0x30,
-    0x2c, 0x91, 0x37, 0xae, 0x2c, 0x3c, 0x28, 0xdc, 0xfb, 0xdb, 0xaf, 0x75, 0x9e, 0x73, 0x54, 0x8b, 0x58, 0xb2, 0x0d, 0x26,
-    0x60, 0x25, 0xd6, 0xe0, 0x35, 0xb4, 0x53, 0xcc, 0xfd, 0x1a, 0x44, 0x21, 0xd4, 0xc7, 0x63, 0xe8, 0x8e, 0xe7, 0xd1, 0x15,
-    0x0f, 0xa0, 0x7a, 0x98, 0xbc, 0xb1, 0x9b, 0x10, 0x1d, 0xa6, 0xfa, 0x6e, 0xb5, 0x33, 0xb1, 0x3f, 0x33, 0x23, 0x8d, 0x87,
-    0x5e, 0x84, 0xab, 0x33, 0x79, 0xac, 0x2b, 0x0e, 0x75, 0x30, 0x1e, 0x0b, 0xb0, 0x1e, 0x5b, 0xf0, 0x09, 0x5e, 0x47, 0x4b,
-    0x8d, 0x13, 0x67, 0x5a, 0x20, 0x16, 0xd7, 0xa3, 0x15, 0x5e, 0xc2, 0x07, 0x58, 0x8e, 0x6d, 0x58, 0x8f, 0xb9, 0x18, 0x8e,
-    0xb6, 0xa8, 0x81, 0xa2, 0x66, 0x55, 0xf3, 0x05, 0xd9, 0xd1, 0x00, 0x2f, 0xe3, 0x7d, 0x2c, 0xc3, 0x56, 0x6c, 0xc0, 0x5c,
-    0x0c, 0x43, 0x1b, 0x54, 0x53, 0xe2, 0xfe, 0x64, 0xfb, 0xe4, 0x2b, 0x4f, 0x2f, 0x1f, 0xd9, 0xd1, 0x5f, 0x13, 0xd3, 0xd1,
-    0x45, 0xfb, 0x5c, 0x74, 0x1d, 0xf1, 0xa8, 0x0a, 0xc4, 0x02, 0xca, 0x67, 0xfa, 0xd2, 0xf3, 0x19, 0xec, 0x39, 0xfc, 0xea,
-    0xc0, 0xfd, 0xbf, 0xe3, 0x99, 0x08, 0x65, 0xaf, 0x8b, 0x4e, 0xe4, 0x24, 0x7a, 0xcd, 0x07, 0x95, 0x47, 0xf8, 0x0e, 0x89,
-    0x9f, 0xa6, 0x41, 0x00, 0x1b, 0xa5, 0x99, 0xe5, 0x0d, 0x0c, 0x0c, 0x0c, 0x58, 0x54, 0xc1, 0x19, 0xc6, 0x42, 0xb6, 0x91,
-    0xd9, 0x2f, 0x7b, 0x46, 0x1c, 0xee, 0x44, 0x37, 0xcc, 0xc4, 0x3a, 0xec, 0xc1, 0xbf, 0x44, 0x23, 0xf0, 0x27, 0xa6, 0xe2,
-    0x71, 0xe5, 0x8c, 0x6c, 0x97, 0x33, 0x82, 0x3e, 0x80, 0xdf, 0x2a, 0x3e, 0x51, 0x87, 0xc8, 0x1c, 0x4b, 0x99, 0x1e, 0xe4,
-    0x80, 0xe6, 0x78, 0xaf, 0x69, 0xfa, 0xc3, 0xc0, 0xc0, 0x40, 0x49, 0x1a, 0x7b, 0xc1, 0x66, 0xcb, 0xf9, 0xd0, 0x15, 0x6a,
-    0x47, 0x11, 0x1e, 0xdc, 0x43, 0x62, 0x68, 0x98, 0xde, 0x48, 0xc6, 0x6d, 0xda, 0x31, 0xa3, 0x83, 0x31, 0xcf, 0xe6, 0x9a,
-    0xfe, 0xe3, 0x62, 0x08, 0xb1, 0x76, 0xbb, 0x92, 0xa5, 0x4b, 0x06, 0x06, 0x06, 0x7a, 0x32, 0x80, 0x3d, 0x21, 0x9e, 0xb2,
-    0xef, 0xa0, 0xb5, 0xc0, 0xd2, 0xb5, 0x08, 0x1a, 0xf8, 0xe8, 0x7d, 0x7f, 0xf9, 0xa3, 0x86, 0xe1, 0x7f, 0x69, 0x34, 0x87,
-    0x59, 0x4a, 0x91, 0x48, 0x2e, 0x59, 0x16, 0x8d, 0x15, 0x4c, 0xef, 0x71, 0xb1, 0xcb, 0xe4, 0x46, 0x30, 0x30, 0x30, 0x70,
-    0x81, 0x1c, 0x4c, 0x6e, 0x0f, 0x9a, 0xe7, 0x7d, 0x07, 0x56, 0xe2, 0x43, 0x4c, 0xc7, 0x87, 0x58, 0x81, 0x6d, 0x38, 0x90,
-    0xe2, 0x33, 0x98, 0x18, 0x71, 0x1b, 0x54, 0xc3, 0xff, 0x97, 0x17, 0xee, 0x26, 0x16, 0xdd, 0xce, 0x5e, 0xc9, 0xaf, 0x08,
-    0xf3, 0x55, 0x19, 0x24, 0xa3, 0x32, 0x99, 0xb5, 0xb7, 0x9b, 0xfe, 0x30, 0x30, 0x30, 0xd0, 0x42, 0xb3, 0x90, 0xa8, 0xcc,
-    0xb2, 0xeb, 0x66, 0xd3, 0x63, 0x86, 0xff, 0x3d, 0xe1, 0x5b, 0xe5, 0x28, 0x48, 0x85, 0x49, 0x3c, 0xb7, 0x2b, 0x31, 0xbb,
-    0x87, 0x0a, 0xc6, 0x5a, 0x3d, 0xb4, 0xc7, 0xf4, 0x86, 0x81, 0x81, 0x81, 0xab, 0x58, 0x0f, 0x8b, 0x14, 0xe3, 0x71, 0x34,
-    0x31, 0xbd, 0x65, 0xf8, 0xdf, 0x13, 0xee, 0x27, 0xfe, 0xfc, 0x15, 0xa5, 0x25, 0x3f, 0xd0, 0xb6, 0x16, 0xbc, 0xf2, 0x2c,
-    0x4e, 0x83, 0x51, 0xfb, 0x86, 0x9b, 0xfe, 0x30, 0x30, 0x30, 0x70, 0xed, 0x41, 0xde, 0x0b, 0x0b, 0x48, 0xae, 0xdd, 0xd0,
-    0x2b, 0x11, 0x3b, 0x95, 0x32, 0x4f, 0x18, 0x18, 0xfe, 0x97, 0x79, 0xf4, 0x6d, 0xb2, 0x7a, 0x66, 0xb3, 0x24, 0x0e, 0xc0,
-    0xff, 0xc8, 0xc8, 0xab, 0x6f, 0xfa, 0xcd, 0xc1, 0xc6, 0x14, 0xb8, 0xc9, 0xf4, 0x87, 0x81, 0x81, 0x81, 0x47, 0x94, 0xc6,
-    0xc3, 0xe8, 0x85, 0x17, 0x31, 0x19, 0xf3, 0xf1, 0x39, 0xde, 0xc3, 0x1b, 0x18, 0x8e, 0x1e, 0x68, 0x8d, 0xea, 0x11, 0x8c,
-    0xf9, 0x6b, 0xf8, 0xff, 0x72, 0x46, 0x25, 0x12, 0xdb, 0x74, 0x80, 0xa0, 0x4c, 0x3e, 0xb2, 0x13, 0x9d, 0x67, 0xfa, 0x4c,
-    0x80, 0x37, 0xad, 0x3e, 0xda, 0x6a, 0x7a, 0xc3, 0xc0, 0xc0, 0xc0, 0x20, 0x4a, 0x10, 0xc8, 0x95, 0x90, 0x8c, 0xe2, 0xa6,
-    0x37, 0x6c, 0x18, 0x68, 0xf1, 0xd6, 0x7f, 0x82, 0x8c, 0xbe, 0x33, 0x88, 0x57, 0x9b, 0x89, 0x4e, 0xc5, 0x47, 0x46, 0x92,
-    0xa5, 0xab, 0x9f, 0xe9, 0x0f, 0x03, 0x03, 0x03, 0x03, 0x83, 0xa8, 0x47, 0x3c, 0xc9, 0x0c, 0xba, 0x9a, 0xe3, 0xb5, 0x5e,
-    0x9f, 0xe8, 0x9c, 0xea, 0x99, 0xfe, 0x12, 0xa0, 0x11, 0xe9, 0xa5, 0x6b, 0x4c, 0x7f, 0x18, 0x18, 0x18, 0x18, 0x18, 0xa4,
-    0x0b, 0x6b, 0x93, 0x53, 0x29, 0x99, 0x2b, 0x9e, 0xe6, 0x44, 0x9e, 0xbc, 0xda, 0xca, 0xee, 0xf6, 0x86, 0xe9, 0x2b, 0x21,
-    0xde, 0x25, 0xf9, 0x21, 0x4d, 0x6f, 0x18, 0x18, 0x18, 0x18, 0x18, 0xa4, 0x0f, 0x74, 0x48, 0xca, 0xe8, 0x53, 0x4a, 0x68,
-    0x25, 0xd8, 0x15, 0x67, 0xb0, 0xdb, 0x21, 0xbf, 0xf8, 0x95, 0x8c, 0xec, 0x38, 0x6d, 0xf1, 0x7f, 0x57, 0xd3, 0x1f, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0xe9, 0xc6, 0x0f, 0xe0, 0x41, 0x87, 0x78, 0xb5, 0x65, 0x50, 0xc9, 0xf4, 0x93, 0x10, 0x37, 0x60,
-    0x82, 0x85, 0x42, 0xa6, 0x3f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
-    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x2e, 0x23, 0x74, 0xc1, 0xc4,
-    0x14, 0x3c, 0xe4, 0xe2, 0xe9, 0xa2, 0xa8, 0x8f, 0xde, 0x98, 0x88, 0xf7, 0xb1, 0x0a, 0xdb, 0xb0, 0x0f, 0x87, 0x71, 0x1c,
-    0xa7, 0xf0, 0x3b, 0xb6, 0xe0, 0x4b, 0xbc, 0x8b, 0x89, 0x78, 0x0e, 0xb5, 0x10, 0xef, 0x43, 0x2b, 0x4b, 0xa2, 0x3a, 0xfe,
-    0x87, 0x4e, 0xe8, 0x8d, 0xb6, 0x68, 0x84, 0xaa, 0x28, 0x85, 0x58, 0x87, 0x27, 0x0a, 0xe0, 0x4e, 0xb4, 0xc6, 0x0b, 0x98,
-    0x8b, 0x95, 0xd8, 0x88, 0x9d, 0xd8, 0x8f, 0xa3, 0x38, 0x89, 0x3f, 0xb0, 0x1d, 0xab, 0xf0, 0x31, 0xc6, 0xa1, 0x05, 0x8a,
-    0x6b, 0xb6, 0x21, 0xa7, 0xd5, 0x53, 0xaa, 0xc8, 0xea, 0x43, 0x2d, 0xdd, 0x35, 0x5b, 0x59, 0x1c, 0x55, 0xd1, 0x0c, 0x1d,
-    0xf0, 0x2c, 0xda, 0xe1, 0x7f, 0xb8, 0x07, 0xb7, 0x20, 0xa7, 0xc6, 0xef, 0xaa, 0xa9, 0xf4, 0x8e, 0x12, 0xe4, 0x89, 0x4a,
-    0x3e, 0xd4, 0x67, 0xc7, 0xc3, 0xd6, 0xf3, 0x23, 0x3c, 0xd6, 0xde, 0x99, 0x94, 0x1e, 0x86, 0x8c, 0xbe, 0xfc, 0x7a, 0x3e,
-    0x6e, 0xb2, 0x6a, 0xe9, 0xea, 0xe2, 0xe9, 0x78, 0x8c, 0xb2, 0x9e, 0xcf, 0xe6, 0xf0, 0x95, 0x9a, 0x6a, 0xd4, 0xdb, 0xdd,
-    0x7a, 0xaa, 0x8d, 0x8b, 0x36, 0xdd, 0x80, 0x16, 0xe8, 0x86, 0x7b, 0x51, 0xd0, 0x55, 0x8f, 0xf0, 0x66, 0xe0, 0x71, 0xec,
-    0xc2, 0xd7, 0x98, 0x89, 0x11, 0xe8, 0x84, 0xc6, 0xa8, 0xe8, 0x38, 0x8b, 0xd3, 0xb2, 0x9d, 0xcb, 0x30, 0x0b, 0x23, 0xd1,
-    0x05, 0xcd, 0x50, 0xd9, 0x63, 0x3b, 0x33, 0xa2, 0x34, 0xea, 0xe0, 0x69, 0x74, 0x43, 0x13, 0x54, 0x40, 0x6e, 0x85, 0x27,
-    0x72, 0x68, 0xaf, 0x35, 0x13, 0xa5, 0x73, 0xf2, 0x0e, 0x72, 0xb7, 0xb0, 0x52, 0x9b, 0x87, 0x48, 0x46, 0x4e, 0x05, 0x52,
-    0x5b, 0x0f, 0xcd, 0xbe, 0x28, 0x24, 0x7d, 0xb6, 0x32, 0xb9, 0x5b, 0xc7, 0x47, 0x96, 0xbb, 0x9e, 0xd4, 0x5b, 0x25, 0xe4,
-    0x6e, 0x26, 0x8c, 0x26, 0xf7, 0xab, 0x2b, 0xd5, 0xd8, 0xcc, 0xa1, 0x0f, 0xea, 0x93, 0xfb, 0x2f, 0x71, 0x57, 0x1e, 0x1e,
-    0x1a, 0x90, 0xa7, 0x1e, 0x8b, 0x00, 0xfb, 0x5f, 0x8d, 0x0b, 0x48, 0xbd, 0xfe, 0xe6, 0xf2, 0x95, 0x0c, 0x85, 0xad, 0x67,
-    0x65, 0xd7, 0x41, 0xbc, 0x82, 0xea, 0x2e, 0x67, 0x50, 0x26, 0xd4, 0xc7, 0x2b, 0xd8, 0xcb, 0xa9, 0xf5, 0x08, 0x16, 0xe1,
-    0x59, 0x94, 0xf5, 0xd4, 0xb2, 0x3f, 0x30, 0x43, 0xf1, 0x6b, 0xab, 0xd7, 0x49, 0xaf, 0xdc, 0x3e, 0xd4, 0xb2, 0x46, 0xb9,
-    0xa7, 0xea, 0x61, 0x22, 0x7e, 0xe6, 0xd4, 0x90, 0x80, 0xad, 0x98, 0x8c, 0xc7, 0x90, 0x4b, 0xe1, 0x77, 0xf5, 0x52, 0x7a,
-    0x57, 0x65, 0xf2, 0x44, 0x4b, 0x1f, 0xea, 0xb3, 0x63, 0x2a, 0xf9, 0xca, 0x5e, 0x6a, 0xef, 0x4d, 0xca, 0xfe, 0x27, 0x60,
-    0x77, 0xef, 0xad, 0x4d, 0x46, 0x5b, 0xab, 0x96, 0x4b, 0x9c, 0xf5, 0xd7, 0x09, 0x4f, 0x93, 0x56, 0x5c, 0xe7, 0xd0, 0xce,
-    0x73, 0xb8, 0x5b, 0xb9, 0xde, 0x35, 0xd6, 0x53, 0xf3, 0x14, 0x9f, 0xc8, 0x8a, 0x7b, 0xd1, 0x03, 0xd3, 0xb0, 0x11, 0x67,
-    0x49, 0x9b, 0xfe, 0xc4, 0x12, 0x8c, 0xc6, 0xc3, 0x28, 0xed, 0xf3, 0x6c, 0xf9, 0x09, 0x1d, 0x04, 0xfb, 0x9d, 0x68, 0x6b,
-    0x67, 0x47, 0x57, 0xed, 0xbc, 0x1d, 0x0b, 0xf1, 0x1b, 0x12, 0x6c, 0xb5, 0x1d, 0xc3, 0x56, 0x7c, 0x88, 0x8e, 0x28, 0x26,
-    0x61, 0x49, 0x2f, 0x57, 0x2b, 0xc9, 0xe8, 0x04, 0x6e, 0x54, 0x6a, 0xf9, 0x7e, 0xc9, 0xc8, 0xc9, 0x4f, 0x58, 0xe3, 0x3c,
-    0xf2, 0x6b, 0xf5, 0x48, 0x57, 0xd2, 0x92, 0xa1, 0x21, 0x77, 0x6f, 0x25, 0x77, 0xa7, 0xf9, 0xc8, 0x73, 0x1d, 0x49, 0xbd,
-    0x77, 0x39, 0xac, 0x14, 0xfb, 0x1c, 0x4f, 0x4c, 0x01, 0xde, 0x3c, 0x69, 0x95, 0x4f, 0x44, 0x2d, 0xee, 0xc9, 0xf8, 0x34,
-    0xa9, 0xb3, 0x9d, 0x52, 0x2b, 0x33, 0xe3, 0x77, 0xb2, 0x8a, 0xdc, 0x16, 0x01, 0xfe, 0x1f, 0xc7, 0x8c, 0x9b, 0x0e, 0x61,
-    0xe1, 0xff, 0xe4, 0xeb, 0x77, 0x6d, 0xf9, 0x42, 0x3c, 0x1e, 0xc7, 0x6f, 0x8e, 0xf5, 0xae, 0x45, 0x1b, 0x8e, 0x84, 0x41,
-    0xa7, 0x65, 0xdb, 0xd1, 0x05, 0xd9, 0xd3, 0x35, 0xff, 0xab, 0xf5, 0xd4, 0x19, 0xcc, 0x42, 0xe5, 0x2b, 0x88, 0xff, 0xdb,
-    0x20, 0xd1, 0x2a, 0x79, 0x51, 0x78, 0x6a, 0xf6, 0x8b, 0xff, 0x9f, 0x23, 0xf5, 0x2c, 0xd3, 0x96, 0x2c, 0x1d, 0x22, 0x4f,
-    0x57, 0x73, 0x6c, 0xe7, 0x51, 0x94, 0x09, 0x0b, 0xff, 0x67, 0x46, 0x57, 0xfc, 0x29, 0x1d, 0x43, 0x97, 0x30, 0x5f, 0x91,
-    0x3f, 0xd4, 0xc7, 0xf9, 0x51, 0x8c, 0x40, 0x51, 0xad, 0xfe, 0x4a, 0xab, 0x76, 0x8e, 0x94, 0x30, 0x76, 0x28, 0x6e, 0xc1,
-    0x42, 0x32, 0x02, 0x79, 0x57, 0x22, 0xbe, 0x12, 0xec, 0xe5, 0xa2, 0x9b, 0xff, 0x63, 0xb0, 0x98, 0xd4, 0xf7, 0xb4, 0xd6,
-    0xb7, 0x5b, 0x4d, 0x9e, 0x0c, 0x1d, 0xc5, 0x59, 0xc8, 0xce, 0x62, 0xb3, 0x8f, 0x3c, 0x37, 0x99, 0x8c, 0x8c, 0x1c, 0x9c,
-    0xfb, 0x71, 0xf8, 0x86, 0xb4, 0xeb, 0x0d, 0xc7, 0xfa, 0x3e, 0x27, 0xa5, 0x5f, 0x15, 0x94, 0x79, 0x9e, 0xd9, 0x53, 0x64,
-    0x52, 0x68, 0xe5, 0x33, 0xe4, 0x89, 0x59, 0x11, 0x60, 0xff, 0xdc, 0x38, 0xc1, 0x8c, 0x9b, 0x9f, 0x11, 0x17, 0x36, 0xfe,
-    0x0f, 0xf4, 0x7c, 0x27, 0x8d, 0xba, 0xeb, 0xe0, 0x47, 0xe5, 0x9a, 0x47, 0x7a, 0x66, 0xd9, 0x3d, 0x82, 0x55, 0x37, 0x3d,
-    0xf0, 0xbf, 0x4e, 0x4f, 0x25, 0x72, 0x76, 0x95, 0x97, 0x27, 0xff, 0x37, 0x24, 0x2b, 0x49, 0x22, 0x9e, 0x50, 0xfa, 0xaa,
-    0xbd, 0x7c, 0x59, 0x61, 0x02, 0x57, 0x23, 0xad, 0x67, 0x87, 0x33, 0xcf, 0x36, 0x53, 0x18, 0x7d, 0x3f, 0x2b, 0x9e, 0xba,
-    0x74, 0xf8, 0xff, 0x01, 0x72, 0xfa, 0x90, 0x5d, 0x09, 0x98, 0x21, 0x94, 0x25, 0xb9, 0x1d, 0xe7, 0xe7, 0xd1, 0x45, 0xb9,
-    0xb7, 0xd2, 0xb2, 0x9d, 0x17, 0x14, 0xa5, 0xb2, 0xb1, 0x98, 0x82, 0x4b, 0x4a, 0x35, 0x2e, 0x4b, 0x97, 0xfc, 0xff, 0x30,
-    0xa9, 0x6f, 0x85, 0x96, 0xbc, 0x39, 0xb8, 0x23, 0x5a, 0xc7, 0x2d, 0xb1, 0x9d, 0xc8, 0xb9, 0x32, 0xfa, 0xc6, 0x74, 0x6b,
-    0xad, 0x5a, 0x77, 0x09, 0x4a, 0x94, 0x26, 0xe7, 0xf5, 0x44, 0xd4, 0x56, 0x94, 0xf5, 0x05, 0x98, 0x43, 0x74, 0x76, 0xcc,
-    0x86, 0x3f, 0x48, 0x39, 0x67, 0xee, 0xcb, 0x46, 0x4e, 0x01, 0x67, 0xb4, 0xb5, 0xd3, 0x6e, 0xf0, 0x6c, 0xc8, 0xc8, 0x69,
-    0xea, 0x9a, 0xff, 0x0f, 0x63, 0x13, 0x96, 0x62, 0x31, 0x3e, 0xc2, 0xfb, 0x58, 0x82, 0x4d, 0xf8, 0x1d, 0xff, 0x71, 0x46,
-    0xe6, 0xf3, 0xca, 0x7a, 0xcb, 0x04, 0x8d, 0xf1, 0x5e, 0xd3, 0x61, 0x56, 0x27, 0xe0, 0x38, 0x8e, 0xe2, 0x2f, 0x1c, 0xc0,
-    0xbf, 0xc2, 0x59, 0x99, 0x80, 0xd1, 0xc8, 0x9c, 0x0e, 0xf9, 0x5f, 0xaf, 0xa7, 0x7e, 0x77, 0x90, 0x95, 0x5c, 0x2e, 0xfc,
-    0x5f, 0x03, 0x67, 0x48, 0xb9, 0x3e, 0x8a, 0x5f, 0xd5, 0x0b, 0xff, 0x7f, 0xc2, 0xf4, 0xf3, 0x4e, 0x64, 0xd0, 0xb0, 0xd8,
-    0x38, 0xa3, 0x20, 0x85, 0xb3, 0x8f, 0x9b, 0x95, 0x4a, 0x27, 0x0a, 0x55, 0xfe, 0x8f, 0xc3, 0x08, 0x87, 0xb3, 0x2a, 0x7b,
-    0xfd, 0xe0, 0x28, 0x61, 0x2f, 0x6c, 0xdb, 0xfb, 0x9f, 0xc0, 0x11, 0x1c, 0xc2, 0x01, 0x1c, 0x17, 0xbc, 0x27, 0x01, 0x4d,
-    0x14, 0x7e, 0x4f, 0xda, 0xb7, 0xf3, 0x9c, 0x92, 0xc6, 0x70, 0x80, 0x72, 0x0b, 0x1f, 0x4e, 0x97, 0xfc, 0x9f, 0x1d, 0xa7,
-    0x48, 0x9f, 0xa9, 0x4b, 0x45, 0xfa, 0x90, 0x76, 0x74, 0xe3, 0x96, 0x98, 0x45, 0x4a, 0xdc, 0xe2, 0x13, 0xcf, 0xc5, 0x91,
-    0xd6, 0x8a, 0xe7, 0x41, 0x27, 0xf2, 0xe6, 0x5f, 0xb9, 0x52, 0x82, 0x64, 0x5c, 0x85, 0x7f, 0xc9, 0x6f, 0xbf, 0x4b, 0xf2,
-    0xde, 0xd6, 0x8c, 0xae, 0x39, 0x8b, 0x06, 0x1b, 0xbf, 0x10, 0x01, 0xf6, 0xcf, 0xc4, 0xec, 0x4f, 0x92, 0xaf, 0x6f, 0x5d,
-    0xf3, 0x7f, 0x3b, 0xce, 0x1e, 0xf8, 0x0e, 0x8c, 0xc5, 0x3e, 0xdb, 0x1b, 0x5e, 0x50, 0xb0, 0x96, 0x99, 0xc2, 0x3d, 0x21,
-    0x7c, 0x8f, 0x69, 0xe8, 0x8e, 0x5e, 0x18, 0x8b, 0x77, 0xf1, 0x33, 0x99, 0x9d, 0x07, 0x38, 0x52, 0x0b, 0xda, 0xb2, 0xfe,
-    0x8c, 0xed, 0x41, 0x1c, 0xf2, 0xe1, 0x06, 0xb4, 0xc6, 0x14, 0xec, 0x0a, 0x79, 0xc7, 0x17, 0xd2, 0x35, 0x95, 0xd6, 0x39,
-    0x16, 0xe5, 0x14, 0x10, 0xef, 0x43, 0x2d, 0xa5, 0xb4, 0x7b, 0xea, 0x2c, 0xd6, 0x63, 0x32, 0xba, 0xe0, 0x79, 0xcc, 0xc0,
-    0x2a, 0xfc, 0xc1, 0xec, 0x78, 0x86, 0x5f, 0x11, 0xf2, 0xff, 0x3b, 0x18, 0xb9, 0xd6, 0x50, 0xe5, 0x31, 0xec, 0x85, 0xff,
-    0x37, 0xdb, 0xbe, 0x42, 0x67, 0xe5, 0x27, 0x67, 0xda, 0x9e, 0x1c, 0xac, 0xb8, 0xfb, 0x9c, 0xa9, 0x60, 0x53, 0xa3, 0xc6,
-    0xff, 0xd9, 0x19, 0x79, 0x6e, 0xea, 0xf5, 0x2f, 0x96, 0x62, 0x04, 0x7a, 0xe1, 0x5d, 0xec, 0xe1, 0x70, 0xe1, 0x51, 0x07,
-    0x2b, 0x04, 0x76, 0x06, 0xc6, 0x31, 0xeb, 0x4e, 0x51, 0x54, 0x40, 0x5b, 0x7c, 0x6d, 0xdb, 0x8b, 0x9f, 0xc6, 0xad, 0x0e,
-    0xbf, 0x26, 0xd2, 0xed, 0x2c, 0x86, 0x8a, 0x68, 0x87, 0x65, 0xb6, 0x76, 0x1e, 0xc6, 0xb5, 0x0e, 0xed, 0xac, 0x69, 0xdb,
-    0x93, 0x1f, 0xc2, 0x34, 0x0c, 0xc5, 0x53, 0x78, 0x1c, 0x2f, 0x60, 0x0e, 0xd6, 0xe2, 0x6f, 0xd2, 0xba, 0x2c, 0x82, 0x99,
-    0x5d, 0x5d, 0x80, 0x2f, 0xc9, 0xdc, 0x10, 0x95, 0x29, 0x10, 0x76, 0xfe, 0x8f, 0xc1, 0x1c, 0x57, 0xf3, 0x66, 0x13, 0xd1,
-    0xc8, 0x15, 0xe2, 0x96, 0xe8, 0x45, 0xea, 0x6d, 0xed, 0xc0, 0xea, 0x5b, 0xb1, 0x3f, 0x05, 0xd7, 0x3a, 0x58, 0xff, 0x05,
-    0xaf, 0x67, 0x25, 0x32, 0x9b, 0xa5, 0x0a, 0x52, 0xfd, 0x18, 0x2c, 0x24, 0xa5, 0xc6, 0x39, 0xb4, 0x70, 0xa3, 0xe3, 0x7e,
-    0x27, 0xa8, 0x03, 0x3c, 0x42, 0xac, 0x58, 0xb2, 0x47, 0x80, 0xff, 0xdb, 0x10, 0x6e, 0x0d, 0x5e, 0x77, 0xfa, 0xc6, 0xff,
-    0xa9, 0xbd, 0xda, 0x09, 0x17, 0x99, 0x59, 0x9e, 0xc7, 0xa1, 0xd6, 0x57, 0x6d, 0x33, 0x78, 0x2f, 0xda, 0xa1, 0x72, 0xc8,
-    0xd9, 0xbc, 0x10, 0x5a, 0xe2, 0xe3, 0xa4, 0x96, 0x8f, 0x73, 0xbd, 0xaa, 0xd7, 0x22, 0xb3, 0x29, 0xf9, 0x7a, 0x4f, 0xa2,
-    0x01, 0xf1, 0x87, 0x29, 0xfc, 0xe2, 0x1b, 0x5e, 0x4f, 0xed, 0x44, 0x5b, 0x94, 0x0f, 0x39, 0x79, 0x66, 0xc1, 0xdd, 0x98,
-    0x9d, 0x24, 0x8d, 0x49, 0xe4, 0xee, 0x26, 0x2e, 0x37, 0xfe, 0xaf, 0x48, 0xf6, 0xe7, 0xc0, 0x98, 0x08, 0x7d, 0x8f, 0xbf,
-    0x6c, 0xdf, 0xe2, 0x6f, 0xc5, 0x39, 0x5c, 0x3e, 0x44, 0x22, 0xf5, 0xaa, 0xb2, 0xf4, 0x69, 0xb0, 0x2f, 0xfc, 0x1f, 0x8b,
-    0x0f, 0x6c, 0xf5, 0x7e, 0x8a, 0x47, 0x71, 0x3d, 0xb3, 0xbb, 0xc8, 0x87, 0x7a, 0x18, 0x89, 0x73, 0x4c, 0xa9, 0xe3, 0xb8,
-    0xde, 0x63, 0xbf, 0x16, 0xc3, 0x70, 0x86, 0xb1, 0x0f, 0xe2, 0x6a, 0xa9, 0x4c, 0x3d, 0xad, 0xda, 0x59, 0x14, 0x63, 0x98,
-    0x1a, 0x7f, 0x94, 0xda, 0xf0, 0x17, 0x61, 0xac, 0x39, 0x76, 0xe3, 0x31, 0xce, 0xa9, 0x22, 0x3f, 0xba, 0x62, 0x1b, 0x80,
-    0x89, 0xda, 0xe3, 0x6c, 0x36, 0x61, 0x09, 0x37, 0xd6, 0xa9, 0x7e, 0xf1, 0x7f, 0x03, 0x52, 0xe3, 0x46, 0xc5, 0x56, 0x94,
-    0x21, 0xcf, 0x7c, 0x26, 0x28, 0x53, 0x9b, 0x94, 0x79, 0x59, 0x5a, 0x5b, 0x0d, 0x45, 0x09, 0x5f, 0x0c, 0x5a, 0x90, 0x92,
-    0x75, 0xa4, 0x7e, 0x4d, 0xc7, 0xc9, 0xc9, 0xfe, 0x1e, 0x6e, 0x99, 0x96, 0x8c, 0x55, 0xa8, 0x93, 0xc5, 0x7c, 0x0d, 0x66,
-    0x74, 0xcb, 0x4a, 0x0f, 0x26, 0x25, 0x9f, 0x88, 0x00, 0xfb, 0xc7, 0x26, 0x8d, 0xbf, 0xd4, 0x75, 0x24, 0x68, 0x4d, 0xb3,
-    0xc0, 0x67, 0xfe, 0x0f, 0xe0, 0x3e, 0x1c, 0x23, 0x25, 0x9f, 0x91, 0xd6, 0xf9, 0x98, 0x6d, 0x8e, 0xcf, 0x95, 0xea, 0xf0,
-    0x0a, 0x61, 0x0c, 0x2a, 0x7a, 0x5a, 0xd5, 0x6b, 0xda, 0x56, 0xee, 0xd7, 0xd3, 0x0d, 0xff, 0xdb, 0x7b, 0x6a, 0x86, 0x94,
-    0x71, 0xf2, 0xa3, 0x27, 0xde, 0xbe, 0x02, 0xec, 0xff, 0x6f, 0xc2, 0x61, 0x52, 0x62, 0x52, 0x84, 0xbe, 0x47, 0x26, 0xce,
-    0xc9, 0xb3, 0x8f, 0xd2, 0x93, 0x1f, 0x84, 0x3c, 0x37, 0x5f, 0x99, 0xff, 0x13, 0xd1, 0xdc, 0x07, 0xfe, 0xef, 0xcf, 0xd4,
-    0x79, 0x11, 0x7d, 0x84, 0x72, 0x85, 0x2a, 0x84, 0x15, 0x92, 0xa5, 0xeb, 0x39, 0x3c, 0xf7, 0x6b, 0x3b, 0x66, 0xff, 0xf3,
-    0xae, 0xa4, 0x64, 0xda, 0xb6, 0xb3, 0x1f, 0x53, 0x63, 0x3f, 0x49, 0xc9, 0x6e, 0x8c, 0x1c, 0x59, 0x26, 0x1b, 0xbf, 0x13,
-    0xd7, 0xa4, 0x5b, 0xfe, 0xcf, 0xc8, 0xcc, 0x33, 0x35, 0x7b, 0x54, 0xca, 0x71, 0x8f, 0x08, 0xca, 0xe4, 0x23, 0x65, 0xbe,
-    0x92, 0xd6, 0x36, 0x91, 0x94, 0xfc, 0x4e, 0x5a, 0xf2, 0x45, 0x52, 0x32, 0xbf, 0x72, 0x3f, 0xed, 0xe5, 0xac, 0xa7, 0x05,
-    0x88, 0xec, 0x26, 0x81, 0xe3, 0x49, 0x18, 0x8a, 0x05, 0x4a, 0xe3, 0x2b, 0x2f, 0x61, 0xc8, 0x2d, 0x9a, 0x56, 0x78, 0xee,
-    0x50, 0x97, 0x78, 0x46, 0x15, 0xc0, 0x50, 0xf2, 0xab, 0x4a, 0xfb, 0xce, 0xff, 0x31, 0xa4, 0xfe, 0x80, 0xdc, 0x52, 0x76,
-    0x1a, 0x3a, 0xc3, 0xc8, 0x0a, 0x9e, 0x8a, 0x00, 0xcb, 0x96, 0x20, 0x52, 0xa9, 0xc0, 0x55, 0x3b, 0x5d, 0xf0, 0xbf, 0xbd,
-    0xa7, 0xda, 0x44, 0xb0, 0x45, 0xd1, 0xcb, 0xff, 0x65, 0x70, 0x90, 0xdc, 0x9f, 0xa2, 0x20, 0x21, 0xf7, 0xe7, 0x7b, 0x5c,
-    0xc3, 0x61, 0xe7, 0xbf, 0x14, 0x3c, 0xc6, 0x6e, 0xe6, 0xd8, 0xa3, 0xac, 0xd4, 0xb0, 0x3e, 0x39, 0xee, 0xb0, 0xf2, 0x3a,
-    0xf3, 0xff, 0xbd, 0x8c, 0xac, 0xfa, 0x80, 0x54, 0x9f, 0x19, 0x58, 0xff, 0x96, 0x32, 0xef, 0x9f, 0xe7, 0x43, 0xbf, 0x3e,
-    0xce, 0xac, 0xb9, 0x31, 0x51, 0xdb, 0xce, 0x41, 0xa4, 0xe4, 0x07, 0x92, 0x72, 0xd3, 0xc8, 0xfe, 0xac, 0x8c, 0xef, 0xeb,
-    0x76, 0xb4, 0xf0, 0x7f, 0x0c, 0x5e, 0xd7, 0x92, 0x44, 0x05, 0xf0, 0x83, 0x55, 0xfe, 0x94, 0xe4, 0xac, 0xb2, 0x5f, 0x32,
-    0xfb, 0xe9, 0xf9, 0x75, 0x3f, 0xb3, 0x13, 0x2e, 0x21, 0x29, 0xbb, 0x98, 0xd8, 0xe1, 0xeb, 0xd8, 0xf1, 0x84, 0x4a, 0x67,
-    0xe6, 0x4a, 0xad, 0xce, 0xf9, 0x76, 0x85, 0xe7, 0x14, 0x64, 0x82, 0x23, 0xa4, 0xd6, 0x6c, 0xe1, 0xc0, 0x12, 0xc6, 0xcf,
-    0xb2, 0x18, 0x91, 0xd1, 0x4f, 0x0c, 0x03, 0xff, 0x57, 0x55, 0xb4, 0x17, 0x5d, 0xce, 0xd8, 0xaa, 0xdd, 0x18, 0x21, 0x4e,
-    0x2b, 0xcc, 0xc8, 0x27, 0x36, 0x0b, 0xf6, 0x5f, 0xd1, 0xc5, 0xff, 0x6c, 0x4f, 0x95, 0xf5, 0x50, 0xd3, 0xe5, 0xc3, 0xff,
-    0xa5, 0x19, 0x8b, 0x96, 0x99, 0x4a, 0xfb, 0x68, 0x7f, 0xbe, 0x47, 0x35, 0xa2, 0x4b, 0x0b, 0xfa, 0xa3, 0x3b, 0xc7, 0x46,
-    0x99, 0x47, 0x98, 0x3c, 0xa8, 0xc5, 0x71, 0x6a, 0xe7, 0x87, 0x44, 0xda, 0xb0, 0x4d, 0xba, 0xcb, 0x70, 0xe2, 0xff, 0x38,
-    0x22, 0x05, 0x0c, 0x58, 0x64, 0x17, 0x52, 0xf0, 0x35, 0x65, 0x7d, 0x86, 0xef, 0xf4, 0xa1, 0x5f, 0xf7, 0x90, 0x75, 0x3c,
-    0x5f, 0xd4, 0xb6, 0x33, 0x3b, 0x59, 0x23, 0x7f, 0x93, 0x94, 0xfb, 0x9e, 0xe8, 0x09, 0x62, 0x2e, 0x63, 0xfe, 0xaf, 0xce,
-    0x68, 0x1e, 0x55, 0xfc, 0x21, 0x83, 0xd7, 0x6c, 0x49, 0xb9, 0x45, 0xa4, 0x5c, 0x71, 0x49, 0x64, 0x05, 0xf6, 0x92, 0xc5,
-    0x49, 0x0b, 0xae, 0x0a, 0x0b, 0x1d, 0x5b, 0x59, 0x04, 0x47, 0x85, 0xd6, 0x7d, 0x4d, 0x18, 0xaf, 0xf1, 0xcc, 0x8a, 0x7d,
-    0xff, 0xb2, 0xa3, 0xdc, 0xa8, 0x20, 0xb1, 0x4f, 0xfc, 0x38, 0x22, 0xec, 0x7f, 0x1d, 0x39, 0x77, 0x54, 0xb2, 0xc9, 0x29,
-    0x8e, 0x29, 0x47, 0xba, 0x50, 0xe7, 0xff, 0x78, 0xc2, 0xb0, 0xdb, 0x85, 0xa5, 0xee, 0x61, 0xbe, 0xe8, 0x23, 0x11, 0xe4,
-    0xb4, 0xae, 0xcc, 0x9b, 0x5b, 0x47, 0x3d, 0xff, 0xdf, 0xa3, 0xd0, 0xde, 0x2b, 0x8d, 0xff, 0xaf, 0x65, 0x4e, 0x04, 0xef,
-    0x2a, 0xc6, 0x9d, 0xf4, 0xe7, 0x7b, 0x34, 0x23, 0xab, 0xf2, 0x58, 0xf2, 0x6f, 0xb9, 0xcd, 0x6f, 0x59, 0x72, 0xa6, 0xed,
-    0x4a, 0x6c, 0xc2, 0x9c, 0xda, 0xd9, 0x82, 0x39, 0x2f, 0xcc, 0xf2, 0xc0, 0xff, 0x0f, 0x32, 0x67, 0x28, 0xb5, 0xb8, 0x45,
-    0x19, 0xb0, 0x9b, 0x3c, 0xb5, 0xc4, 0x87, 0x7e, 0x9d, 0x46, 0xca, 0xde, 0x17, 0xc5, 0xed, 0xdc, 0xa8, 0x20, 0x47, 0xce,
-    0x4c, 0xac, 0xa9, 0xa6, 0x5c, 0xd6, 0xfc, 0x1f, 0xcb, 0xc4, 0x1c, 0xa9, 0xe8, 0x58, 0x23, 0x1d, 0xb3, 0xf5, 0x24, 0xe5,
-    0x5e, 0x70, 0xf4, 0x85, 0x0d, 0x60, 0xb4, 0x8d, 0xff, 0xbf, 0x91, 0x30, 0xba, 0x9e, 0xff, 0x59, 0x4b, 0xc6, 0x7a, 0x23,
-    0xc8, 0x85, 0x79, 0x88, 0x96, 0xfc, 0x02, 0x37, 0x92, 0x0a, 0x1f, 0x79, 0x88, 0x65, 0xdf, 0x31, 0xee, 0xce, 0x75, 0x32,
-    0x39, 0x3d, 0x94, 0x89, 0x08, 0xff, 0x8f, 0x0b, 0xb1, 0xf8, 0xaf, 0xad, 0x1d, 0xad, 0x48, 0x87, 0xff, 0x73, 0x12, 0x6f,
-    0xec, 0xcf, 0x85, 0xa5, 0x56, 0x2a, 0x9c, 0xc2, 0xc3, 0xc3, 0x69, 0xf1, 0xd8, 0xc2, 0x78, 0x57, 0x47, 0x3b, 0xff, 0xaf,
-    0x64, 0x76, 0xa2, 0x71, 0x86, 0xff, 0x71, 0x0d, 0xe3, 0x69, 0x32, 0x4f, 0x39, 0xea, 0xb4, 0x3f, 0xdf, 0xa3, 0xbd, 0x55,
-    0xc7, 0x0e, 0xe4, 0x27, 0x67, 0xf9, 0xae, 0x8a, 0x6b, 0xf9, 0x2a, 0x64, 0x27, 0xfc, 0x96, 0xd1, 0x91, 0xff, 0xe3, 0xf0,
-    0x31, 0xf9, 0x7f, 0x47, 0x97, 0xfc, 0x1f, 0x87, 0x1d, 0xa4, 0x96, 0x05, 0x1a, 0xf1, 0x99, 0xe9, 0x75, 0xbb, 0xe7, 0x7e,
-    0xa5, 0xec, 0x34, 0x30, 0x8a, 0xdb, 0x49, 0x35, 0xce, 0x75, 0x05, 0x65, 0x6e, 0x20, 0x65, 0xe6, 0x5c, 0xd6, 0xfc, 0x1f,
-    0x83, 0x91, 0x1a, 0x76, 0xb6, 0xb1, 0x24, 0x8a, 0xeb, 0x21, 0xa9, 0x77, 0x6c, 0x33, 0x52, 0xeb, 0x8b, 0xc2, 0x52, 0xbb,
-    0x43, 0xa2, 0xcb, 0x5c, 0x25, 0x28, 0xd9, 0x88, 0x94, 0x6a, 0xa8, 0xf4, 0xdb, 0xe7, 0x73, 0x2d, 0xfc, 0xa7, 0x2a, 0xfb,
-    0x14, 0x85, 0xc6, 0xd8, 0x97, 0x45, 0x35, 0xac, 0x4c, 0x4e, 0x01, 0x13, 0x22, 0xc2, 0xfe, 0xd9, 0x88, 0x85, 0xf4, 0x43,
-    0xd6, 0xf7, 0xf9, 0x49, 0x3b, 0xf2, 0x92, 0x3a, 0xff, 0x37, 0x54, 0x88, 0xae, 0x54, 0x85, 0xf9, 0x9e, 0xf7, 0x46, 0x98,
-    0xd3, 0xee, 0x64, 0x34, 0xb1, 0x37, 0x44, 0x35, 0xff, 0x57, 0xf1, 0x10, 0x6b, 0xe6, 0xf2, 0xe4, 0xff, 0xab, 0xf1, 0x2b,
-    0xf9, 0xfb, 0xfb, 0x1a, 0xde, 0xf7, 0xfe, 0x7c, 0xd5, 0x01, 0x84, 0xc9, 0xa9, 0x9d, 0xd3, 0x1f, 0x12, 0x29, 0x61, 0x19,
-    0x32, 0xef, 0xab, 0x22, 0x86, 0xe8, 0x09, 0x8b, 0x3a, 0xf2, 0x7f, 0x60, 0x47, 0x4d, 0x23, 0xa5, 0xdc, 0xee, 0x8a, 0xff,
-    0xef, 0x63, 0xd6, 0xcf, 0x72, 0x1a, 0xfe, 0xd4, 0xdb, 0x1c, 0xe5, 0x0f, 0x3a, 0xfd, 0x7a, 0xb3, 0x83, 0xf5, 0x63, 0xb4,
-    0xb4, 0xb3, 0x3d, 0x29, 0xdb, 0x43, 0x18, 0x97, 0x38, 0x41, 0x43, 0xdb, 0x9c, 0xbe, 0xf9, 0xff, 0x46, 0x52, 0xeb, 0x7e,
-    0x07, 0x5b, 0x1b, 0x2a, 0xaf, 0x1f, 0x2f, 0x2d, 0x79, 0x15, 0xe3, 0x91, 0xed, 0xac, 0x4b, 0x70, 0xf2, 0xb8, 0x1d, 0x4a,
-    0x76, 0xd6, 0x6a, 0x51, 0xb3, 0xf2, 0x13, 0x0f, 0x8e, 0x4b, 0x29, 0x91, 0xe1, 0xea, 0x12, 0x9d, 0xdb, 0x16, 0xcd, 0xc8,
-    0x44, 0x19, 0xc8, 0x38, 0x4c, 0x4c, 0x9a, 0xeb, 0x74, 0x5f, 0xb4, 0x86, 0x58, 0x0c, 0xe5, 0x8d, 0x08, 0xff, 0xb7, 0x23,
-    0x76, 0x34, 0x19, 0xb9, 0xd1, 0x07, 0xab, 0xf8, 0xcc, 0xff, 0x93, 0x14, 0x4a, 0x52, 0x1b, 0xc1, 0xcf, 0x23, 0xce, 0x69,
-    0x31, 0x98, 0x4e, 0x9e, 0xe9, 0x19, 0xd5, 0xfc, 0x3f, 0x54, 0x49, 0xee, 0x75, 0xe5, 0xf0, 0x7f, 0x09, 0xfc, 0xc2, 0x9c,
-    0x0f, 0x33, 0x46, 0x5c, 0x1e, 0x33, 0x9e, 0xd1, 0x30, 0xe6, 0x26, 0xda, 0xae, 0x0e, 0x0a, 0x52, 0xef, 0xaf, 0x93, 0xfe,
-    0x7f, 0x50, 0x2a, 0x4b, 0xb5, 0xf3, 0x7f, 0x0c, 0x4a, 0x91, 0x5d, 0xfc, 0x3e, 0xc1, 0xca, 0x26, 0xe7, 0xff, 0xb1, 0x8c,
-    0x9f, 0x8d, 0xce, 0xef, 0x6d, 0xc2, 0xd8, 0x39, 0xc6, 0x7a, 0xec, 0xd7, 0x26, 0x0e, 0xd6, 0xc1, 0xd1, 0xd2, 0xce, 0x09,
-    0xd2, 0x18, 0x3b, 0xa9, 0xa0, 0xd1, 0x38, 0x6f, 0xbe, 0xac, 0xf9, 0x9f, 0x8e, 0x2f, 0x38, 0x58, 0x64, 0x8e, 0xd3, 0x88,
-    0xeb, 0xb3, 0xcf, 0x41, 0x17, 0x46, 0x57, 0xc0, 0x6f, 0xad, 0x7f, 0x2d, 0x17, 0x94, 0xfd, 0xd4, 0x31, 0xf6, 0x9f, 0x7c,
-    0xdc, 0xec, 0x42, 0x56, 0xe4, 0x20, 0x6d, 0x3a, 0xef, 0x22, 0x2e, 0x51, 0x55, 0x72, 0xba, 0xdc, 0xc2, 0xc8, 0x26, 0xdb,
-    0x90, 0x37, 0x3d, 0x1a, 0x11, 0xf6, 0x8f, 0x21, 0xb2, 0xee, 0x41, 0x8c, 0x9e, 0xe2, 0x34, 0xf1, 0x25, 0xf3, 0x93, 0xff,
-    0x1f, 0x27, 0x96, 0x33, 0x87, 0x84, 0x5e, 0x90, 0x74, 0x2c, 0xdd, 0x9a, 0x06, 0xfc, 0xdf, 0xd2, 0xc1, 0xf3, 0x24, 0x7a,
-    0xf8, 0x9f, 0xf6, 0x54, 0xad, 0x2b, 0x9e, 0xff, 0x4b, 0x31, 0x7a, 0xc8, 0x8f, 0x34, 0xf7, 0xe6, 0xfe, 0x7c, 0xd5, 0xe0,
-    0xaa, 0x3c, 0xd5, 0xb6, 0x3e, 0xed, 0x11, 0x68, 0x22, 0x8a, 0x11, 0x3d, 0x71, 0x6d, 0x9b, 0x75, 0x74, 0x5d, 0x25, 0xfe,
-    0x8f, 0x41, 0x53, 0x72, 0x26, 0xf9, 0x82, 0xab, 0x05, 0x92, 0xf3, 0xff, 0x16, 0x6d, 0x56, 0xe0, 0x45, 0x72, 0x01, 0x57,
-    0x1f, 0xaf, 0xd3, 0xaf, 0x54, 0x8e, 0x3c, 0x3a, 0x8a, 0xdb, 0xb9, 0x4e, 0x69, 0x85, 0x9a, 0xcb, 0xf8, 0x33, 0x14, 0xb9,
-    0xac, 0xf9, 0xff, 0x29, 0x25, 0xcf, 0xe9, 0x80, 0x24, 0x26, 0x68, 0x83, 0xb7, 0xc9, 0xf1, 0xdd, 0xef, 0x91, 0x5a, 0xaf,
-    0x95, 0x46, 0x09, 0xbe, 0x84, 0xeb, 0x2c, 0xd6, 0x4a, 0x10, 0xe4, 0x7f, 0x0c, 0xfa, 0x77, 0x4f, 0xd7, 0xe8, 0xb1, 0xe9,
-    0x4c, 0x9c, 0xb6, 0xd7, 0x1c, 0x34, 0x54, 0xce, 0x98, 0xc2, 0x95, 0x54, 0xe4, 0x22, 0x92, 0x86, 0xaf, 0x23, 0xc4, 0xfe,
-    0xd5, 0x88, 0xdc, 0xb0, 0x90, 0xa0, 0x8d, 0x67, 0x95, 0x24, 0x25, 0x2a, 0xfc, 0x9f, 0x19, 0xfd, 0x18, 0xdf, 0xe8, 0x5e,
-    0xc2, 0x5c, 0x04, 0x17, 0x49, 0xbb, 0xe2, 0xd3, 0x80, 0xff, 0x2b, 0x31, 0xd1, 0x06, 0xe3, 0xa3, 0x96, 0xff, 0x69, 0x4f,
-    0x25, 0xba, 0xcc, 0x9e, 0x76, 0xf9, 0xf0, 0x7f, 0x59, 0x1c, 0x60, 0xfc, 0xb2, 0x32, 0xa6, 0x89, 0x3d, 0xc6, 0xe7, 0x64,
-    0xad, 0x48, 0xf6, 0xe7, 0x0d, 0xda, 0x00, 0x3c, 0xc0, 0x7d, 0xe2, 0xa5, 0x10, 0xdf, 0xe5, 0x60, 0x06, 0x92, 0xc7, 0x14,
-    0xf9, 0x9f, 0xb5, 0x2d, 0xee, 0xaf, 0xc9, 0xff, 0x05, 0xc9, 0x99, 0xe4, 0x5f, 0xed, 0x5f, 0xfc, 0x8a, 0xc3, 0x9b, 0x75,
-    0xfa, 0x75, 0x99, 0x34, 0x4a, 0x5a, 0xb4, 0xb4, 0x33, 0x0b, 0x13, 0x57, 0x28, 0xb7, 0x52, 0x8c, 0x5b, 0x60, 0xab, 0x34,
-    0xfa, 0x50, 0x7a, 0xe7, 0xff, 0x9c, 0xc4, 0x72, 0xfd, 0xb0, 0x44, 0xeb, 0x76, 0x37, 0x79, 0xbf, 0x73, 0xa6, 0x87, 0x9e,
-    0xdc, 0xb1, 0xce, 0x8b, 0xe7, 0xb7, 0x82, 0xd1, 0xd6, 0xb7, 0xe7, 0x7a, 0x77, 0xbb, 0xcb, 0x54, 0x94, 0x9b, 0x64, 0x99,
-    0x48, 0x20, 0x23, 0x70, 0xbd, 0x86, 0x6e, 0x91, 0x8d, 0x6b, 0x70, 0x98, 0x8c, 0xe2, 0x82, 0x21, 0x52, 0x91, 0x73, 0x5c,
-    0x9d, 0x73, 0x38, 0xf0, 0xae, 0xd0, 0x92, 0x86, 0xea, 0x95, 0x7b, 0x7b, 0xe2, 0xff, 0x58, 0xe4, 0x41, 0x69, 0x34, 0xc3,
-    0x6c, 0xb2, 0x0e, 0x26, 0x5b, 0xc4, 0xc6, 0x29, 0x58, 0x08, 0xfc, 0x94, 0x06, 0x9c, 0x16, 0xc8, 0xb9, 0x4d, 0xf7, 0x29,
-    0x85, 0xa4, 0x75, 0x3e, 0x87, 0xbc, 0x0e, 0x08, 0x1f, 0xdf, 0x34, 0x64, 0x3c, 0xff, 0x62, 0x7c, 0xed, 0x2b, 0xe7, 0xdf,
-    0x15, 0x40, 0xcd, 0xa8, 0xe1, 0xff, 0xf2, 0x4c, 0xf4, 0xa6, 0xf9, 0x2e, 0xe6, 0xa6, 0x3f, 0xfc, 0x1f, 0x3c, 0x65, 0x0e,
-    0x08, 0x89, 0x39, 0xb2, 0x8e, 0xbb, 0xba, 0x1c, 0x0f, 0xb1, 0xdf, 0xf8, 0x58, 0x3a, 0xf7, 0xf8, 0xfc, 0x9f, 0x91, 0x64,
-    0x36, 0xb9, 0xc0, 0xb1, 0x02, 0x90, 0xf1, 0x7f, 0x53, 0x52, 0xe3, 0x06, 0xed, 0x5f, 0xfc, 0x8c, 0x83, 0x6d, 0xbd, 0x7a,
-    0xbf, 0x16, 0x21, 0xb9, 0x54, 0x79, 0x12, 0xf3, 0x68, 0x69, 0x67, 0x07, 0xc5, 0x76, 0xe4, 0xb4, 0x65, 0xe1, 0x3e, 0x8f,
-    0x09, 0x02, 0xaf, 0xc6, 0xf4, 0xcf, 0xff, 0xac, 0xef, 0x46, 0x7d, 0x61, 0xa9, 0x37, 0x08, 0xcf, 0xe5, 0x53, 0x90, 0x96,
-    0xcb, 0xed, 0x0a, 0xfb, 0x33, 0xda, 0xb5, 0xff, 0x59, 0xff, 0xfb, 0x92, 0x53, 0xb6, 0xb9, 0xeb, 0x7c, 0x02, 0xf7, 0x71,
-    0x62, 0x7a, 0xfd, 0xe7, 0xc1, 0x27, 0x9d, 0x4a, 0xfa, 0xa7, 0xa6, 0xc4, 0x2a, 0xbb, 0x10, 0xd1, 0x88, 0xff, 0xc9, 0xe3,
-    0x3d, 0x28, 0x77, 0x6c, 0x22, 0x89, 0xd0, 0xb0, 0x47, 0xc1, 0xaa, 0xbc, 0x30, 0x93, 0xd3, 0xfa, 0x80, 0x85, 0xc3, 0x4c,
-    0xc4, 0xdf, 0xe0, 0x2e, 0xea, 0x65, 0x49, 0x9d, 0xed, 0x99, 0xb8, 0x9e, 0x69, 0xc1, 0xff, 0x31, 0x8c, 0xf7, 0x78, 0x39,
-    0x8f, 0x99, 0x7b, 0x62, 0x15, 0x5a, 0x76, 0x9c, 0xf4, 0x19, 0x0f, 0x73, 0x1c, 0x7b, 0xea, 0x6b, 0x9f, 0xf9, 0x5f, 0xff,
-    0x4a, 0x4b, 0xfe, 0x7f, 0x97, 0xf8, 0xea, 0x06, 0x34, 0xc3, 0x19, 0xd2, 0xcc, 0x1f, 0x63, 0x5f, 0x88, 0xbe, 0xbf, 0x10,
-    0x89, 0x03, 0x70, 0xb7, 0x24, 0xd7, 0xc7, 0x36, 0x6b, 0xa4, 0x4c, 0x93, 0xae, 0x79, 0x85, 0x05, 0x67, 0xa2, 0x12, 0xa4,
-    0x0f, 0xf6, 0x84, 0xc4, 0xb9, 0x93, 0xf1, 0x7f, 0x07, 0xd7, 0x5a, 0x75, 0x7b, 0xfc, 0xd7, 0x2d, 0x1e, 0xfa, 0xb5, 0x08,
-    0x76, 0x92, 0x92, 0xdb, 0x1c, 0x78, 0x37, 0xed, 0xda, 0xd9, 0x9b, 0x61, 0x83, 0xfb, 0x1d, 0x24, 0x89, 0xf6, 0xdc, 0x67,
-    0x27, 0xf0, 0xba, 0x4f, 0xd9, 0x6c, 0xa2, 0x8d, 0xff, 0xef, 0x52, 0x88, 0xec, 0x96, 0x81, 0x44, 0xcd, 0x9b, 0xaf, 0xf0,
-    0xee, 0x2c, 0x84, 0xa3, 0x78, 0xf9, 0x11, 0x37, 0x58, 0x31, 0x20, 0x0b, 0x24, 0x59, 0x5c, 0x9e, 0xb4, 0x76, 0xc0, 0xf9,
-    0x24, 0x5e, 0x87, 0x27, 0xb4, 0xfd, 0xa4, 0xde, 0x08, 0x59, 0xed, 0x7a, 0x7b, 0x8a, 0xb8, 0xbb, 0x82, 0x58, 0x15, 0x06,
-    0xe2, 0x51, 0x7c, 0x4d, 0x66, 0x6e, 0x96, 0x08, 0xf1, 0xff, 0x00, 0x22, 0xaf, 0xc9, 0xc8, 0x19, 0xe5, 0x4e, 0x9e, 0xb8,
-    0x6e, 0x99, 0x63, 0xb9, 0x83, 0x2d, 0xcc, 0x00, 0x69, 0xdc, 0xa5, 0xc8, 0xac, 0xea, 0xcb, 0xa4, 0x7a, 0x75, 0xff, 0xf9,
-    0xdf, 0xe9, 0xfa, 0xdc, 0xb1, 0xa7, 0xde, 0xb8, 0xa2, 0xf9, 0x1f, 0x2e, 0xfc, 0xfd, 0xc3, 0xc3, 0xff, 0x67, 0x38, 0xdc,
-    0x1c, 0x8c, 0x8f, 0xb6, 0x38, 0x24, 0x5a, 0xf0, 0x01, 0x8e, 0x1d, 0xd9, 0xcb, 0x52, 0x3d, 0x65, 0x61, 0xa1, 0x4c, 0xb4,
-    0x21, 0x61, 0xa6, 0xe9, 0x1a, 0xfc, 0x3f, 0xd0, 0x21, 0x2f, 0x94, 0x1c, 0x37, 0x30, 0xb9, 0xcd, 0xdc, 0xf6, 0x2b, 0xcb,
-    0xfe, 0xfc, 0x28, 0x2e, 0x69, 0xdf, 0xce, 0x9b, 0x99, 0x58, 0x77, 0x2a, 0x39, 0xb9, 0x3b, 0x0b, 0x72, 0x79, 0xb6, 0xf2,
-    0x9c, 0xd3, 0x36, 0xda, 0xf8, 0x3f, 0x96, 0x48, 0x3b, 0x4e, 0x0b, 0x62, 0xb5, 0x37, 0x51, 0x92, 0x11, 0x50, 0xac, 0x27,
-    0xac, 0x6d, 0x9f, 0xd7, 0x25, 0xad, 0xf1, 0xfe, 0x45, 0x88, 0x44, 0xbb, 0x6d, 0x48, 0x4d, 0x5f, 0x59, 0xf7, 0x96, 0x6a,
-    0xf7, 0x75, 0x0e, 0xe2, 0xb3, 0x18, 0xb8, 0xd6, 0x7a, 0xf4, 0xb4, 0xbe, 0x91, 0xec, 0x6b, 0x36, 0x31, 0xf6, 0x66, 0x75,
-    0x23, 0xc4, 0xfe, 0xb1, 0xc4, 0x6f, 0x72, 0x12, 0x77, 0x36, 0x5c, 0x20, 0xb9, 0x70, 0xfc, 0x64, 0x8e, 0x13, 0x78, 0x45,
-    0xaa, 0xe1, 0x18, 0xa7, 0x9c, 0x29, 0x29, 0x7c, 0xab, 0x3a, 0xdd, 0xef, 0x3d, 0x14, 0xb5, 0xfc, 0x3f, 0xce, 0xc1, 0x4f,
-    0xe1, 0xca, 0xe4, 0xff, 0x4d, 0xd2, 0x08, 0xa0, 0xe1, 0xe5, 0xff, 0x6c, 0x5c, 0xbf, 0xd5, 0x52, 0x96, 0x27, 0x58, 0x22,
-    0x6e, 0x12, 0x44, 0xbc, 0xa5, 0xd6, 0x81, 0x03, 0xa5, 0xb9, 0x51, 0x0a, 0x4b, 0x74, 0xa2, 0x93, 0x84, 0xdf, 0x43, 0xc6,
-    0xff, 0xe3, 0xc9, 0x53, 0x8f, 0xbb, 0xc8, 0x78, 0x90, 0x40, 0xa4, 0xa2, 0xfa, 0xfd, 0x9a, 0x0d, 0x0f, 0x60, 0x1e, 0x23,
-    0xf9, 0x0f, 0x68, 0x4a, 0x32, 0x48, 0x7d, 0x2b, 0xc2, 0xdd, 0xce, 0xfe, 0xc8, 0x96, 0x84, 0x9c, 0x28, 0x8a, 0xb2, 0xb8,
-    0x03, 0x75, 0xf0, 0x30, 0xde, 0xb2, 0xe5, 0x12, 0x00, 0xfe, 0x51, 0x88, 0x75, 0x13, 0xf0, 0x62, 0x3f, 0x24, 0xc8, 0xc0,
-    0xdd, 0xcf, 0x93, 0x36, 0x20, 0xda, 0xf8, 0x9f, 0xcd, 0xcb, 0xf0, 0xb4, 0x43, 0x4c, 0xdd, 0x03, 0x8a, 0xbb, 0x74, 0x3a,
-    0xa2, 0x2b, 0xd8, 0xee, 0xf5, 0x08, 0x61, 0xfb, 0x26, 0x42, 0xc9, 0x71, 0x1c, 0xc9, 0x04, 0xaa, 0x2f, 0x61, 0x8f, 0x23,
-    0xde, 0x05, 0xc9, 0xdf, 0x2e, 0xb7, 0xc7, 0xb5, 0x76, 0x04, 0x93, 0x49, 0x5a, 0xb5, 0x87, 0xfd, 0x43, 0x0d, 0x47, 0x0b,
-    0xd6, 0x8f, 0x49, 0xfb, 0xf2, 0xfb, 0xcc, 0x1c, 0x89, 0x98, 0x2d, 0x8c, 0x80, 0x3c, 0x4b, 0x59, 0xba, 0x16, 0xbe, 0x55,
-    0x7d, 0x8c, 0x34, 0xa6, 0x5e, 0xb4, 0xf0, 0xff, 0x2c, 0xed, 0x78, 0x16, 0x57, 0x02, 0xff, 0x07, 0xfc, 0xbb, 0xaa, 0xa7,
-    0x11, 0xff, 0x17, 0x15, 0xd8, 0x98, 0xcf, 0xb3, 0xe9, 0xfb, 0x52, 0xf7, 0xe0, 0x3b, 0xb8, 0x56, 0x33, 0x1d, 0xa5, 0x16,
-    0x03, 0x32, 0xfe, 0xcf, 0x42, 0x62, 0x01, 0x1c, 0x43, 0x49, 0x45, 0xfe, 0xa7, 0xe3, 0xc8, 0x4d, 0xcf, 0xd1, 0x88, 0x0b,
-    0x39, 0xa5, 0xed, 0x5d, 0x80, 0x4e, 0x49, 0xe8, 0x8c, 0xfe, 0x18, 0x83, 0x29, 0xf8, 0x00, 0xcb, 0x89, 0xaf, 0x51, 0xf0,
-    0x84, 0x50, 0xd6, 0x71, 0xbc, 0x87, 0xb7, 0x9d, 0x2a, 0xd7, 0x5f, 0x28, 0xaf, 0x6c, 0xf1, 0x35, 0x4b, 0x50, 0xc7, 0x69,
-    0x4c, 0x72, 0xcd, 0x24, 0xd1, 0xc7, 0xff, 0x57, 0x11, 0x6d, 0xef, 0x7a, 0xae, 0xa7, 0xcb, 0x45, 0xcd, 0x98, 0xf9, 0x6c,
-    0xe4, 0xa6, 0xce, 0x02, 0xd9, 0xc0, 0x39, 0x2b, 0x93, 0x6c, 0x66, 0xcb, 0x9a, 0xe6, 0xbc, 0x2d, 0xf7, 0x71, 0x39, 0x6d,
-    0xc9, 0x03, 0x45, 0xaf, 0x90, 0x2f, 0x37, 0xdd, 0xe3, 0x5a, 0x9b, 0x95, 0xf1, 0x54, 0x4e, 0xd5, 0x02, 0x5f, 0x15, 0x31,
-    0xfe, 0x9f, 0x46, 0x72, 0x62, 0xf1, 0x4b, 0x34, 0x55, 0x8c, 0xa9, 0x6c, 0x9f, 0x3b, 0x5f, 0x61, 0x02, 0xc1, 0x24, 0xcc,
-    0xc2, 0x12, 0x6c, 0xc0, 0x6f, 0x21, 0x36, 0x14, 0xdb, 0x04, 0x19, 0xed, 0xe7, 0x2b, 0x7b, 0x92, 0x86, 0x6f, 0x55, 0xff,
-    0x48, 0xba, 0x07, 0xa1, 0x75, 0xae, 0x62, 0x7e, 0x2d, 0x0f, 0x2a, 0xfc, 0xbf, 0x1f, 0xeb, 0xa5, 0x98, 0xe8, 0x5b, 0x4f,
-    0xf5, 0x40, 0xbf, 0x14, 0xd4, 0x93, 0xb6, 0xe8, 0x67, 0x2c, 0x55, 0xc0, 0xba, 0x28, 0xe1, 0xff, 0x0f, 0x99, 0x6c, 0x3f,
-    0x81, 0xd9, 0xdf, 0x3e, 0x4d, 0xf8, 0x9f, 0xc6, 0x41, 0x29, 0xc9, 0xe8, 0x81, 0x13, 0xad, 0xb5, 0x2a, 0xe8, 0x07, 0x76,
-    0x3f, 0x39, 0x0d, 0xd1, 0xcc, 0xb0, 0x0f, 0x49, 0xed, 0x5f, 0x0b, 0x4b, 0x6d, 0xa2, 0xcb, 0x11, 0x8d, 0xf3, 0xb7, 0xe4,
-    0x8c, 0x25, 0xe3, 0xff, 0xf9, 0x92, 0x33, 0x96, 0x0a, 0xb6, 0x93, 0xe7, 0x0b, 0x78, 0xe6, 0xd5, 0xfd, 0x42, 0xfd, 0xb8,
-    0x9f, 0xed, 0x2c, 0xe8, 0xb1, 0x9d, 0x3f, 0x6b, 0x5a, 0x69, 0x57, 0xc3, 0xac, 0x10, 0x5b, 0x80, 0xd4, 0xb3, 0xe4, 0xfd,
-    0x97, 0x09, 0xff, 0xd3, 0xfc, 0x3a, 0xe0, 0xec, 0x8e, 0x9e, 0x23, 0xe7, 0x3f, 0x55, 0x5f, 0x88, 0x6b, 0x84, 0x51, 0x14,
-    0xcb, 0x72, 0x23, 0xe5, 0xcf, 0x14, 0x64, 0x97, 0x6d, 0x4f, 0xac, 0xcf, 0xf2, 0x68, 0xcf, 0xea, 0xb3, 0x9c, 0xef, 0xd6,
-    0xd8, 0x23, 0x33, 0x35, 0x08, 0xa9, 0xb1, 0x4b, 0xc4, 0xd8, 0x9f, 0x7a, 0x6b, 0xf4, 0x15, 0x94, 0xc9, 0x48, 0x2c, 0xaa,
-    0xb7, 0xfb, 0xe0, 0xff, 0x77, 0x0d, 0xfa, 0x91, 0x8c, 0x18, 0xc9, 0xe3, 0x36, 0x27, 0xa7, 0xdc, 0x9b, 0x3e, 0x45, 0xfe,
-    0xf7, 0xb2, 0xaa, 0xff, 0x40, 0x9e, 0xba, 0x2d, 0x6a, 0xfd, 0xff, 0xdc, 0xf4, 0x54, 0xd0, 0xda, 0xfc, 0xcd, 0xcb, 0xca,
-    0xff, 0xaf, 0x10, 0xc9, 0x63, 0x95, 0x7c, 0xbd, 0x96, 0x06, 0xfe, 0xff, 0x55, 0x85, 0x27, 0xcc, 0x2f, 0x38, 0x9a, 0xeb,
-    0xa5, 0x82, 0x39, 0x58, 0x87, 0x64, 0x0a, 0xd7, 0xe5, 0x7f, 0x36, 0xeb, 0xec, 0x60, 0x25, 0xfe, 0xa7, 0xda, 0xae, 0xe6,
-    0x2e, 0x34, 0x89, 0xa7, 0xc8, 0xda, 0x1a, 0xef, 0x89, 0x57, 0xcf, 0x60, 0xa6, 0xc4, 0x4f, 0x7e, 0xb2, 0x6f, 0xed, 0xe4,
-    0x45, 0x56, 0x56, 0x6f, 0xe7, 0x8f, 0x78, 0xd4, 0x95, 0x8d, 0x49, 0x3e, 0xf4, 0xb4, 0x59, 0x39, 0x04, 0x4f, 0x93, 0xb9,
-    0x2f, 0x0b, 0xfe, 0x6f, 0x22, 0xc9, 0xb8, 0x1d, 0x47, 0x4e, 0xbc, 0x3a, 0xb1, 0xca, 0x76, 0x91, 0x1c, 0xca, 0xfc, 0x58,
-    0x11, 0x0f, 0x73, 0x59, 0x75, 0xb3, 0x60, 0x25, 0x59, 0xab, 0xd9, 0xcf, 0x19, 0x88, 0x0d, 0x02, 0xbd, 0x0e, 0x29, 0xc6,
-    0x10, 0x14, 0x63, 0x01, 0x53, 0xdf, 0x06, 0xcf, 0xbe, 0xee, 0xea, 0x78, 0x92, 0xcc, 0x58, 0x71, 0x5e, 0x6a, 0xea, 0x53,
-    0x7c, 0x87, 0x4f, 0xf1, 0xff, 0xda, 0x32, 0xd1, 0x75, 0x47, 0x39, 0xc4, 0x00, 0x19, 0x98, 0x26, 0xfc, 0x1f, 0xcf, 0xf8,
-    0xf7, 0x96, 0x8c, 0x5a, 0xfe, 0x77, 0xd3, 0x53, 0x97, 0x2b, 0xff, 0x07, 0xd6, 0xf7, 0xde, 0xc4, 0xaa, 0x26, 0x59, 0x6b,
-    0x92, 0x25, 0xc2, 0xfc, 0x5f, 0x9f, 0xf8, 0xe0, 0xb1, 0x72, 0x9f, 0xda, 0xe4, 0x97, 0x64, 0x4d, 0x89, 0x5c, 0x9a, 0x2a,
-    0x13, 0x38, 0x69, 0x3b, 0x91, 0xdc, 0x4a, 0xa2, 0x6f, 0xe8, 0xf3, 0x7f, 0x2c, 0x3e, 0x23, 0xad, 0xa8, 0xa0, 0xc0, 0xff,
-    0xc3, 0x48, 0x8d, 0x7d, 0xb4, 0x7f, 0x33, 0xcd, 0xaa, 0x72, 0xc4, 0x83, 0x56, 0x69, 0x13, 0x3a, 0x39, 0xb0, 0xe0, 0x70,
-    0xdf, 0xda, 0x79, 0xd2, 0x43, 0x3b, 0x5f, 0xf5, 0x68, 0xfb, 0x55, 0x0d, 0x53, 0xc9, 0x4e, 0x24, 0x38, 0x56, 0x63, 0x2f,
-    0x03, 0xfe, 0x8f, 0x27, 0xbe, 0xf2, 0xff, 0xd8, 0x66, 0x5f, 0x1d, 0xf2, 0xe6, 0x87, 0x5d, 0x65, 0xa8, 0xa1, 0xf1, 0xb0,
-    0xe3, 0xac, 0x37, 0x9d, 0x61, 0x7c, 0x5d, 0x32, 0xe1, 0x1f, 0xae, 0x04, 0x62, 0xa7, 0x66, 0x86, 0x62, 0x9e, 0xd4, 0x22,
-    0x20, 0xed, 0xfd, 0x48, 0x29, 0x97, 0xb4, 0x1a, 0x8a, 0x13, 0xab, 0x97, 0x04, 0x8d, 0x3c, 0x42, 0xde, 0xb1, 0x5a, 0xea,
-    0x29, 0xc9, 0x8b, 0xc6, 0xfd, 0xa6, 0x4f, 0xfc, 0xcf, 0xee, 0x00, 0xce, 0xe1, 0x1a, 0x89, 0x47, 0x94, 0x1f, 0x79, 0xb3,
-    0xdc, 0xac, 0xea, 0xa5, 0x98, 0x99, 0x99, 0x35, 0x6a, 0xf9, 0xbf, 0x8f, 0x8b, 0x9e, 0xba, 0x7c, 0xf9, 0x3f, 0x39, 0xb6,
-    0x38, 0xab, 0x55, 0xfb, 0x42, 0x63, 0x07, 0xe0, 0xc7, 0x57, 0x6d, 0x25, 0x69, 0xef, 0x06, 0x9b, 0x67, 0xe0, 0x34, 0x4e,
-    0x66, 0x91, 0x64, 0x94, 0x26, 0x2d, 0xc9, 0xa4, 0xcd, 0xff, 0x81, 0x12, 0x47, 0xc8, 0x29, 0x28, 0x83, 0x23, 0xff, 0x3f,
-    0xa3, 0x3c, 0xcf, 0x9d, 0xfc, 0xbe, 0x76, 0x6a, 0xf2, 0xea, 0x45, 0x1c, 0xc4, 0x16, 0x7c, 0x8e, 0xf1, 0x4a, 0xf2, 0xfc,
-    0x1e, 0xbe, 0xb5, 0x73, 0xbf, 0x43, 0x3b, 0x97, 0x61, 0x14, 0xc1, 0x30, 0x22, 0x55, 0x0e, 0xc4, 0x6c, 0xb9, 0xd6, 0x07,
-    0xf9, 0xeb, 0x20, 0x9b, 0xc5, 0xa3, 0xb3, 0x8e, 0xd5, 0x7f, 0xfe, 0xbf, 0x59, 0xd3, 0x17, 0x5a, 0x85, 0xef, 0x06, 0x09,
-    0x65, 0x92, 0xef, 0x91, 0xec, 0xf7, 0x99, 0x35, 0x5a, 0x7c, 0x2f, 0xa9, 0xf1, 0x41, 0xce, 0x6e, 0xc2, 0xee, 0x47, 0xf8,
-    0x0e, 0x67, 0x5e, 0xe5, 0x25, 0xda, 0xe7, 0xdb, 0xb5, 0x7a, 0xb9, 0x02, 0x39, 0x53, 0x9c, 0xc0, 0x35, 0x28, 0xc8, 0x58,
-    0x73, 0xb6, 0xf0, 0x4d, 0x02, 0xf0, 0x4b, 0x04, 0xd9, 0xff, 0x06, 0xd2, 0x1b, 0x3b, 0xb0, 0x40, 0x82, 0x73, 0xe4, 0xb7,
-    0x67, 0xf7, 0x89, 0xff, 0xd9, 0x08, 0x88, 0x4f, 0x4a, 0x64, 0x13, 0xf2, 0xdd, 0x49, 0xf8, 0x56, 0xf5, 0xfa, 0x0e, 0x19,
-    0x00, 0xa3, 0x85, 0xff, 0xdd, 0xf4, 0xd4, 0xe5, 0xcd, 0xff, 0x81, 0xbf, 0x6e, 0x71, 0xb9, 0x03, 0xf0, 0xe3, 0xab, 0x76,
-    0x94, 0x64, 0x7c, 0x79, 0x80, 0x68, 0xf5, 0xe3, 0x50, 0xc4, 0x9a, 0x5b, 0x17, 0x70, 0xb5, 0xe4, 0xa4, 0x5a, 0xd0, 0x05,
-    0xff, 0xb3, 0x59, 0x72, 0xfb, 0x3b, 0xf2, 0xff, 0x23, 0x0e, 0xf1, 0xae, 0xe5, 0x78, 0x9c, 0x39, 0x1f, 0xc9, 0xfb, 0x75,
-    0x06, 0x1e, 0x48, 0x41, 0x1d, 0xdc, 0x82, 0x82, 0x9a, 0x27, 0xe9, 0xc7, 0x7c, 0x6b, 0xe7, 0x3a, 0xcd, 0xef, 0x1f, 0x4b,
-    0x2c, 0xd7, 0x03, 0x92, 0xda, 0x4c, 0x3e, 0xac, 0xc2, 0x85, 0xf0, 0x3a, 0x63, 0x13, 0x75, 0x4e, 0xd3, 0xa6, 0xc1, 0x1d,
-    0xff, 0x3f, 0xa4, 0xe5, 0xd7, 0x1d, 0x90, 0x7e, 0x5f, 0xe0, 0xda, 0xae, 0x8a, 0x6d, 0x00, 0x2f, 0x70, 0x3d, 0xf6, 0x0b,
-    0x10, 0x2e, 0x19, 0xa5, 0xe9, 0xb7, 0x71, 0x92, 0x93, 0x2f, 0x28, 0x68, 0x51, 0xf9, 0x3f, 0x5b, 0xf9, 0xba, 0xc4, 0x42,
-    0x33, 0x43, 0xc8, 0x8a, 0xfe, 0xb7, 0xd6, 0x98, 0xcb, 0xc4, 0xe4, 0x8d, 0x4a, 0xf6, 0x32, 0x68, 0xc4, 0xc8, 0xbb, 0x0a,
-    0x7b, 0x1a, 0x03, 0x1f, 0xa4, 0x09, 0xff, 0x8f, 0x76, 0x65, 0xdf, 0xfd, 0xb8, 0x6f, 0xfc, 0x4f, 0xe7, 0x71, 0xa8, 0x1d,
-    0x68, 0x15, 0xc7, 0xfc, 0xbb, 0xe1, 0x66, 0xd9, 0xbe, 0xe4, 0x99, 0x09, 0x51, 0xcc, 0xff, 0xb7, 0xbb, 0xe8, 0xa9, 0xf4,
-    0xc5, 0xff, 0xd3, 0x5c, 0xe4, 0xff, 0xcd, 0xcd, 0xe4, 0x44, 0x56, 0xdf, 0x01, 0xf8, 0xf1, 0x55, 0xfb, 0x11, 0x1d, 0x71,
-    0xa8, 0x0f, 0xd1, 0x6e, 0xe2, 0xad, 0x31, 0x4c, 0x92, 0x1b, 0x36, 0x27, 0x69, 0x49, 0x19, 0x57, 0xfc, 0x4f, 0x3d, 0xa1,
-    0xff, 0x4b, 0xb2, 0xa6, 0x97, 0xf1, 0x3f, 0xcd, 0xa1, 0xf6, 0x9b, 0xf6, 0x6f, 0xa6, 0x52, 0xf9, 0x57, 0xc2, 0x36, 0x5b,
-    0x58, 0x8b, 0x2f, 0xaf, 0xed, 0x9c, 0xa4, 0xdd, 0xce, 0x3c, 0x8c, 0x07, 0xf8, 0x44, 0x9f, 0x56, 0xe2, 0x9e, 0xcc, 0x48,
-    0x5d, 0x11, 0x01, 0xfe, 0xbf, 0x4d, 0x33, 0x0a, 0xee, 0xb5, 0xa4, 0xfc, 0x00, 0xa5, 0x37, 0xbc, 0x4f, 0xac, 0x2c, 0x4a,
-    0x73, 0x7e, 0xe9, 0x25, 0x6d, 0xf9, 0xc9, 0x47, 0x21, 0x3a, 0xfd, 0x1c, 0x96, 0xd7, 0xc8, 0x89, 0x90, 0xd9, 0x9d, 0x81,
-    0x48, 0xbf, 0x1a, 0x87, 0x78, 0xdb, 0xcd, 0x72, 0xed, 0xa5, 0xf7, 0x11, 0xf7, 0xfc, 0xba, 0x30, 0xdd, 0xf1, 0x7f, 0x06,
-    0xfc, 0xe9, 0x8a, 0xff, 0xbf, 0xf1, 0x8d, 0xff, 0x4b, 0x31, 0x19, 0x5a, 0x43, 0xed, 0x0e, 0x4f, 0x93, 0xb5, 0x2b, 0x73,
-    0xc4, 0xf9, 0x3f, 0x0f, 0x13, 0x49, 0xb6, 0x6e, 0x14, 0xf3, 0x7f, 0x06, 0xa2, 0x47, 0x54, 0xed, 0xa9, 0xf4, 0xc5, 0xff,
-    0x9f, 0x48, 0x22, 0xb6, 0x88, 0x6b, 0xcf, 0xc2, 0xe4, 0xc4, 0x57, 0xdd, 0x01, 0xf8, 0xf1, 0x55, 0x47, 0x49, 0xe3, 0xc2,
-    0x76, 0x25, 0x96, 0xf9, 0xc1, 0x35, 0xaa, 0x32, 0x67, 0xa7, 0x90, 0xa8, 0x68, 0x7d, 0x2a, 0xe6, 0xff, 0xbc, 0x24, 0xb2,
-    0xd0, 0x6a, 0xc4, 0x49, 0xf9, 0x3f, 0x96, 0xc8, 0x34, 0x13, 0x84, 0x59, 0xb9, 0x62, 0x14, 0xac, 0xf2, 0x1b, 0x85, 0x95,
-    0xff, 0x63, 0xc8, 0xca, 0xe5, 0xad, 0x9d, 0x0f, 0xb9, 0x68, 0x67, 0x05, 0x62, 0xbf, 0x9f, 0xe8, 0xc2, 0x87, 0x8c, 0x8f,
-    0x17, 0xc9, 0x5b, 0x4f, 0x69, 0x9d, 0x4d, 0xdd, 0xf1, 0x7f, 0x5e, 0x07, 0xeb, 0x2b, 0x99, 0xf4, 0xfd, 0x01, 0xa5, 0x37,
-    0xd4, 0x26, 0x4f, 0x8c, 0xe0, 0x58, 0x54, 0x7f, 0xa6, 0xdd, 0x47, 0xed, 0xc8, 0xde, 0xa1, 0x80, 0x4d, 0x8b, 0x31, 0x5d,
-    0x1a, 0xbd, 0x25, 0x35, 0xae, 0xfd, 0x77, 0xae, 0x2c, 0xca, 0xab, 0x10, 0x7f, 0xc5, 0xbf, 0x89, 0x24, 0x2e, 0x07, 0xa3,
-    0x65, 0x6c, 0x9d, 0xce, 0xf8, 0xbf, 0xa1, 0x4b, 0xff, 0x6e, 0x99, 0xcf, 0x86, 0x1e, 0xff, 0xc7, 0x91, 0x99, 0xb4, 0xc2,
-    0x21, 0xfa, 0x5e, 0x97, 0x88, 0xf3, 0xff, 0x2b, 0x8c, 0x7f, 0x6e, 0xe6, 0x28, 0xe6, 0x7f, 0x6a, 0x41, 0xae, 0xda, 0x53,
-    0xe9, 0x8b, 0xff, 0x37, 0x4b, 0xac, 0x76, 0x65, 0xb5, 0x67, 0x60, 0xb2, 0x76, 0x05, 0xe2, 0xbd, 0x67, 0x8c, 0xc8, 0xf7,
-    0x78, 0x43, 0x3a, 0xae, 0x73, 0x90, 0x6c, 0xc0, 0xf2, 0x5c, 0xa5, 0x41, 0x7f, 0xa3, 0x3a, 0x2e, 0xf9, 0x3f, 0x20, 0xf3,
-    0x4c, 0x24, 0xbe, 0x50, 0xf2, 0xfc, 0x7f, 0x73, 0x5c, 0xeb, 0xa1, 0x4b, 0x90, 0xb9, 0x7c, 0x3e, 0x24, 0xea, 0xb0, 0xdf,
-    0xfc, 0x3f, 0xdb, 0x97, 0x76, 0x02, 0xc5, 0x5d, 0xb5, 0xb3, 0x1b, 0x63, 0xfd, 0x5d, 0xd0, 0xa7, 0x38, 0x6c, 0xf4, 0x34,
-    0x76, 0x5d, 0xd8, 0xf9, 0x3f, 0x86, 0x44, 0x89, 0x56, 0xd1, 0xe7, 0xb7, 0xd7, 0x8e, 0x9a, 0x1f, 0x8b, 0x9f, 0x48, 0xcb,
-    0x32, 0xa4, 0xd8, 0x3c, 0x7a, 0xf1, 0x9b, 0x2b, 0x4a, 0x46, 0x72, 0xf2, 0xce, 0x6d, 0xb9, 0xf5, 0xff, 0x1a, 0x9c, 0xf2,
-    0xb7, 0xda, 0x22, 0xd7, 0xe4, 0xb2, 0x78, 0x3c, 0x81, 0xe3, 0x9f, 0x2a, 0xf6, 0xd0, 0xff, 0x49, 0xb8, 0x63, 0xac, 0x4d,
-    0x5a, 0xf4, 0xaf, 0xc4, 0x82, 0x3e, 0x1a, 0xf9, 0x7f, 0x3e, 0xb1, 0x0e, 0x3e, 0xe0, 0x88, 0xc3, 0xa4, 0x0f, 0x5e, 0xf4,
-    0x89, 0xff, 0x6f, 0x73, 0x90, 0xc4, 0x0d, 0x65, 0x22, 0x75, 0x66, 0x8e, 0x28, 0xff, 0x57, 0x60, 0x32, 0x16, 0xbc, 0x15,
-    0xc6, 0x48, 0xb1, 0x7e, 0xd4, 0x32, 0x58, 0xbb, 0xa7, 0xd2, 0x17, 0xff, 0xff, 0x2d, 0x89, 0x41, 0x29, 0xaf, 0x3d, 0x96,
-    0xd9, 0xc7, 0x89, 0xbe, 0xa4, 0xdf, 0xdf, 0x63, 0xae, 0x30, 0xd2, 0x6f, 0xa8, 0x47, 0x8d, 0x2c, 0x6e, 0xd3, 0x11, 0xc9,
-    0x99, 0xab, 0xb0, 0xb2, 0xfd, 0xd1, 0x9b, 0xe4, 0x64, 0xf9, 0x9b, 0x74, 0xd5, 0x6f, 0xcb, 0xc4, 0xb5, 0xc9, 0xae, 0xf1,
-    0x8b, 0xdf, 0x71, 0xdc, 0xcb, 0xf8, 0xc9, 0xff, 0xfe, 0xb4, 0xf3, 0x5b, 0x97, 0xed, 0x8c, 0x25, 0x19, 0xe4, 0x81, 0x45,
-    0xbe, 0xe7, 0xf1, 0x09, 0xd5, 0x65, 0x87, 0x83, 0xff, 0x83, 0xde, 0x6c, 0x1b, 0x15, 0x4a, 0xbf, 0x44, 0xce, 0xde, 0x59,
-    0x95, 0x63, 0x8c, 0xd8, 0xd9, 0x7e, 0x2a, 0xb1, 0x8b, 0x71, 0xe3, 0xe5, 0xb6, 0x85, 0xb1, 0x73, 0x2e, 0x69, 0x59, 0x90,
-    0xff, 0x2c, 0xf0, 0x9a, 0xd8, 0x6a, 0x95, 0xef, 0x8a, 0x18, 0x34, 0x0e, 0xc9, 0xb0, 0xa9, 0x82, 0xf1, 0x4c, 0x7c, 0x11,
-    0x99, 0xef, 0xf5, 0x92, 0x74, 0xc4, 0xff, 0x79, 0xc8, 0x3e, 0x78, 0x8a, 0x92, 0xbc, 0xe8, 0x3c, 0xf9, 0x76, 0x71, 0xbe,
-    0xf0, 0x3f, 0x65, 0xad, 0x47, 0x39, 0xf7, 0x6f, 0x62, 0xec, 0x62, 0xba, 0x44, 0x90, 0xff, 0x63, 0x89, 0x67, 0x44, 0xc0,
-    0x4b, 0xa8, 0x48, 0x94, 0xf3, 0x7f, 0x19, 0x12, 0xd3, 0x54, 0xad, 0xa7, 0xd2, 0x13, 0xff, 0x67, 0x26, 0xe3, 0xe0, 0x25,
-    0xed, 0xda, 0xe3, 0x98, 0x53, 0xad, 0x73, 0x84, 0x64, 0x3f, 0xbe, 0xc7, 0x62, 0x87, 0x98, 0xd9, 0xd7, 0x30, 0xdf, 0x2b,
-    0x60, 0x2f, 0xcf, 0x5f, 0xbf, 0x7e, 0x93, 0xd8, 0xc7, 0xaa, 0xf3, 0x7f, 0x2e, 0xe2, 0x8d, 0x25, 0xf7, 0x5a, 0xca, 0xcf,
-    0x58, 0xa3, 0xf7, 0xd3, 0xb0, 0x24, 0xbe, 0xe8, 0x38, 0xf3, 0xfd, 0xe4, 0xff, 0xec, 0x4c, 0x9e, 0x27, 0xb7, 0xed, 0xac,
-    0xe1, 0xba, 0x9d, 0x85, 0x18, 0xeb, 0xef, 0xf6, 0xbe, 0xac, 0xc8, 0x4f, 0x90, 0x1a, 0x87, 0x46, 0x80, 0xff, 0xe7, 0x12,
-    0x89, 0xae, 0x53, 0xd4, 0xb0, 0x5c, 0x64, 0x07, 0xbe, 0x4f, 0x43, 0xc7, 0x70, 0x86, 0xd9, 0x25, 0xe5, 0x22, 0x1a, 0xdd,
-    0xe7, 0x3c, 0x6a, 0x49, 0x7e, 0x65, 0x3c, 0xf2, 0x44, 0x23, 0xa0, 0x1b, 0xb3, 0xc7, 0x99, 0x60, 0xfd, 0x6f, 0x88, 0xf2,
-    0x1b, 0xcb, 0x93, 0x99, 0xfa, 0x0f, 0x87, 0x07, 0x72, 0x31, 0xd1, 0xa0, 0x9b, 0xa7, 0x1b, 0xfe, 0xa7, 0x39, 0xb4, 0xee,
-    0x51, 0x7a, 0x62, 0x91, 0x34, 0x17, 0x8e, 0x1b, 0xfe, 0x5f, 0x2b, 0xb5, 0x6f, 0xb2, 0xbf, 0xd3, 0x9b, 0x04, 0x40, 0x6f,
-    0xf5, 0x61, 0x33, 0x76, 0x0f, 0x0a, 0x6b, 0xa6, 0x18, 0x7f, 0x6a, 0x79, 0x5f, 0xb3, 0xa7, 0xd2, 0x13, 0xff, 0x37, 0x90,
-    0xee, 0x6d, 0x9c, 0x6b, 0xcf, 0x48, 0xb2, 0xf1, 0x07, 0x64, 0x7f, 0x0d, 0xc3, 0xfe, 0x3d, 0x56, 0x3a, 0xda, 0x4a, 0x7f,
-    0xc0, 0x8c, 0xb0, 0x0e, 0x8e, 0xf1, 0xa7, 0x7a, 0x79, 0xe0, 0x7f, 0xd6, 0x56, 0x59, 0x2e, 0xf5, 0x1d, 0xc9, 0xc4, 0xb5,
-    0xcf, 0xed, 0x62, 0xf4, 0xed, 0x13, 0x58, 0xc5, 0xfb, 0xc9, 0xff, 0x31, 0x18, 0xe2, 0xb9, 0x9d, 0x9f, 0x79, 0xfa, 0xfe,
-    0x0d, 0x99, 0x4c, 0xa7, 0x45, 0x7c, 0x58, 0x91, 0x1b, 0xbb, 0xcc, 0x6a, 0xe4, 0x96, 0xff, 0xa9, 0xcd, 0xe1, 0x7a, 0x87,
-    0xa8, 0x03, 0x23, 0xa5, 0x96, 0x5a, 0x2a, 0xd2, 0x96, 0x8b, 0x28, 0x8a, 0xa7, 0x89, 0x3c, 0xbe, 0xb0, 0xcb, 0x98, 0x09,
-    0xc1, 0xab, 0xb4, 0x95, 0x67, 0xe8, 0xa2, 0xb0, 0xff, 0xf3, 0x91, 0x53, 0xee, 0xcd, 0xc4, 0x86, 0xff, 0x0e, 0xe5, 0x37,
-    0x2e, 0x27, 0x6f, 0x7c, 0xcc, 0xd1, 0x4b, 0xec, 0x57, 0x6d, 0x6b, 0x94, 0xb4, 0xe2, 0xff, 0x35, 0x24, 0xee, 0x64, 0x9c,
-    0xa6, 0x4f, 0xb3, 0x38, 0xea, 0xb1, 0x0e, 0xff, 0x3f, 0x4b, 0xfc, 0xff, 0xff, 0x15, 0x8c, 0xbf, 0xea, 0xcc, 0x8a, 0xd5,
-    0x2f, 0x22, 0xfc, 0x9f, 0x99, 0xb1, 0xeb, 0x04, 0xf6, 0x22, 0x5b, 0x3a, 0xe0, 0xff, 0xdb, 0x34, 0x7b, 0x2a, 0x3d, 0xf1,
-    0xff, 0x3a, 0xa9, 0xaf, 0x92, 0x4a, 0xed, 0xd9, 0x89, 0xe5, 0x4f, 0x40, 0x9e, 0x53, 0x3e, 0xcc, 0xdf, 0x63, 0x93, 0xd4,
-    0x12, 0xde, 0xbe, 0x92, 0x1d, 0x13, 0x4a, 0xb0, 0xd7, 0x4b, 0x72, 0x95, 0x14, 0xd6, 0xf2, 0x3f, 0x9e, 0xa7, 0xc8, 0xff,
-    0xac, 0x04, 0x60, 0xb4, 0xd2, 0xaf, 0xad, 0xce, 0xc8, 0xe9, 0x3a, 0x86, 0x75, 0x9c, 0x07, 0xdb, 0x79, 0xda, 0x53, 0x3b,
-    0x2f, 0x09, 0x73, 0xf6, 0xa8, 0xb6, 0x73, 0xae, 0x8f, 0x11, 0x60, 0x02, 0x78, 0x81, 0xd4, 0xd7, 0x24, 0x02, 0xfc, 0x9f,
-    0x8d, 0x58, 0x86, 0xf2, 0xe5, 0xaf, 0xa9, 0xb8, 0x9a, 0xd8, 0xa1, 0x24, 0x28, 0x46, 0x0b, 0x48, 0x8d, 0x42, 0x9d, 0x48,
-    0xbc, 0x06, 0x36, 0x38, 0xe6, 0x05, 0x76, 0x8e, 0x2b, 0x74, 0x94, 0x70, 0x10, 0x2f, 0xee, 0xaf, 0xf8, 0x2b, 0xcd, 0xb0,
-    0xda, 0x72, 0x58, 0xd9, 0xbe, 0xf2, 0x41, 0x25, 0x4f, 0xd3, 0x79, 0xdc, 0x48, 0x9b, 0xd1, 0xcc, 0xff, 0x65, 0xc8, 0x77,
-    0x19, 0xa3, 0x2c, 0x73, 0x3b, 0x4d, 0x56, 0xd0, 0xec, 0x9e, 0xf8, 0x3f, 0x23, 0xa3, 0x87, 0xe3, 0xe9, 0x55, 0x52, 0xf1,
-    0x35, 0x53, 0x6e, 0x82, 0xeb, 0x6c, 0x99, 0x6a, 0xb3, 0x3a, 0x0e, 0xff, 0xb3, 0xc5, 0x26, 0xfe, 0x4b, 0x62, 0x8b, 0x13,
-    0x4d, 0xfc, 0xcf, 0xc6, 0xdc, 0x0e, 0xf0, 0x4e, 0xa6, 0x74, 0xc4, 0xff, 0x6d, 0x50, 0x55, 0x58, 0x77, 0x3d, 0x26, 0xe2,
-    0x6a, 0x9c, 0xcb, 0xd6, 0xe6, 0x67, 0x22, 0xae, 0xee, 0x93, 0x9c, 0x3f, 0xfc, 0xf8, 0x1e, 0x3f, 0x2b, 0xd8, 0x56, 0xaf,
-    0x13, 0xc6, 0xfd, 0xe1, 0x9d, 0x3e, 0x26, 0x79, 0xe4, 0xff, 0x42, 0x8c, 0xc4, 0x5c, 0xc6, 0x59, 0x2f, 0x30, 0xa5, 0x26,
-    0x3b, 0xca, 0x92, 0x5a, 0x31, 0x4c, 0xbc, 0x4f, 0x58, 0xde, 0x5f, 0xfe, 0x67, 0xb3, 0x00, 0xeb, 0xb7, 0x73, 0xae, 0xe7,
-    0xef, 0x5f, 0x88, 0x44, 0x98, 0x03, 0x27, 0x8b, 0x86, 0x2e, 0xa8, 0xb5, 0xf3, 0x55, 0x11, 0xe0, 0x7f, 0x56, 0xe3, 0xf0,
-    0x17, 0xc7, 0xc2, 0x34, 0x19, 0x25, 0x19, 0x5d, 0xa8, 0x6e, 0x24, 0xb6, 0x2f, 0xad, 0x27, 0xe9, 0xf8, 0x73, 0x1f, 0xe3,
-    0x6e, 0x0e, 0xd1, 0x5a, 0xa8, 0x58, 0x12, 0xde, 0xcb, 0x29, 0x3f, 0x47, 0xd9, 0xf2, 0xef, 0x37, 0x62, 0xd3, 0x5a, 0x56,
-    0x62, 0x97, 0x78, 0x82, 0x44, 0xae, 0xbe, 0x3a, 0x1d, 0xf0, 0xff, 0x30, 0x69, 0x7e, 0x06, 0x95, 0x1d, 0x6f, 0x6b, 0xd7,
-    0xfc, 0x7f, 0x1d, 0xba, 0x63, 0xa3, 0x2d, 0x87, 0x46, 0x7e, 0x89, 0xbd, 0x2e, 0xbb, 0x6e, 0x7d, 0xab, 0x30, 0x37, 0xf2,
-    0xbb, 0x98, 0xd5, 0x19, 0x51, 0x05, 0xcf, 0x92, 0x18, 0xd3, 0xa9, 0x5e, 0xa5, 0x95, 0xc3, 0xce, 0xdc, 0x7e, 0xad, 0x8b,
-    0x85, 0x6d, 0xb9, 0x6f, 0xbe, 0x93, 0xe6, 0xbf, 0x8d, 0x26, 0xfe, 0xcf, 0x85, 0x7f, 0x90, 0x88, 0x19, 0x1c, 0x4e, 0x8e,
-    0x43, 0x17, 0x32, 0xb7, 0xf8, 0xa7, 0x14, 0xd5, 0xd6, 0x96, 0x60, 0x2c, 0xac, 0x57, 0x0b, 0xed, 0x8f, 0xfc, 0xf8, 0x1e,
-    0x07, 0x1d, 0x75, 0x47, 0x81, 0xd3, 0xe8, 0x8b, 0x29, 0xb8, 0x5a, 0x61, 0x4f, 0x37, 0xc3, 0x23, 0xff, 0xb3, 0x71, 0x6f,
-    0x64, 0xfc, 0x9f, 0x89, 0xc8, 0x06, 0x93, 0x65, 0xc3, 0x57, 0x4b, 0x3c, 0x4f, 0xc7, 0xd9, 0xf2, 0x2d, 0x55, 0x0d, 0xfb,
-    0x38, 0x0f, 0x9e, 0x05, 0x57, 0xb8, 0x6e, 0xe7, 0x05, 0x5f, 0x76, 0xf5, 0x4f, 0x30, 0x52, 0xc2, 0xac, 0x92, 0x88, 0x83,
-    0x25, 0x1d, 0x7f, 0x4d, 0x2f, 0x46, 0x7f, 0x17, 0x13, 0x11, 0xfe, 0x8f, 0x67, 0xa2, 0xda, 0x24, 0xe2, 0x2d, 0x4e, 0xb6,
-    0xfe, 0x27, 0x99, 0xf9, 0x77, 0x4a, 0x3b, 0x33, 0x5d, 0x7d, 0x8e, 0xe6, 0x69, 0x95, 0x87, 0xaf, 0xfe, 0x48, 0x48, 0x6d,
-    0x07, 0xb9, 0x39, 0xa2, 0x83, 0x2b, 0xc8, 0xaf, 0x21, 0x4f, 0x3c, 0xea, 0xc2, 0xaa, 0x7a, 0xa4, 0xb2, 0x2e, 0x65, 0x7e,
-    0xd4, 0xf3, 0x7f, 0x2c, 0xd9, 0xd7, 0x6c, 0x77, 0xe9, 0x31, 0xf8, 0x95, 0xe3, 0xdc, 0x59, 0x88, 0xae, 0x78, 0x04, 0x0d,
-    0x51, 0x1f, 0xf5, 0xd1, 0x1c, 0x4f, 0xa0, 0x07, 0x86, 0xe2, 0x8d, 0x10, 0x86, 0x0d, 0x78, 0x54, 0x96, 0x72, 0x78, 0x6b,
-    0xa2, 0x2d, 0xdf, 0xc2, 0x7d, 0x92, 0xb5, 0xbb, 0x37, 0x76, 0x60, 0xb5, 0x43, 0xcb, 0xb6, 0xe2, 0x1d, 0x4c, 0xc4, 0xcb,
-    0x18, 0x8d, 0x17, 0x31, 0x0e, 0xd3, 0xb0, 0x10, 0x6b, 0x88, 0xa5, 0x0a, 0x48, 0x36, 0xb6, 0xbb, 0x94, 0x99, 0x7b, 0x37,
-    0xbe, 0x56, 0xc2, 0x63, 0x61, 0x5c, 0x17, 0x6b, 0xdb, 0xac, 0xca, 0x8e, 0x48, 0x34, 0xdd, 0xd1, 0xc4, 0xff, 0x03, 0xad,
-    0xbd, 0xf3, 0x37, 0x98, 0x84, 0xb6, 0xa8, 0x88, 0x6c, 0xb8, 0x0e, 0xf7, 0xe3, 0x19, 0x46, 0x6a, 0xcf, 0xe6, 0xc6, 0x77,
-    0xd3, 0xda, 0x5a, 0x4c, 0xff, 0x0c, 0x54, 0xf8, 0xaa, 0xbf, 0x63, 0xa3, 0x23, 0x78, 0x12, 0xfe, 0x53, 0xca, 0xd6, 0x86,
-    0x72, 0xbc, 0x27, 0x89, 0x2f, 0xa2, 0xcb, 0xff, 0xb1, 0x36, 0x59, 0xda, 0x3c, 0xc9, 0x79, 0xe6, 0x90, 0x6d, 0x1c, 0xd5,
-    0x13, 0xc4, 0x78, 0x5b, 0xa1, 0x91, 0xb9, 0xcc, 0x6f, 0xfe, 0x0f, 0xc4, 0x4d, 0x3f, 0xea, 0xaa, 0x9d, 0x17, 0xa5, 0x11,
-    0x6f, 0xd4, 0xdb, 0x19, 0xcb, 0xd4, 0xfb, 0xbc, 0xb0, 0xdc, 0x0e, 0x24, 0xe0, 0x13, 0xd4, 0x17, 0x4a, 0x9d, 0xb3, 0xa2,
-    0x3b, 0x93, 0x0d, 0x65, 0x4e, 0x84, 0xf8, 0x9f, 0x95, 0xad, 0x25, 0xef, 0x3c, 0xa6, 0xa0, 0x1b, 0x6a, 0xa1, 0x28, 0x2a,
-    0xe3, 0x31, 0x8c, 0xc0, 0x37, 0xb6, 0xfb, 0x43, 0x5c, 0x70, 0xcd, 0x8f, 0x21, 0xeb, 0x6a, 0x73, 0x4f, 0x7a, 0x9f, 0x04,
-    0x5b, 0x6d, 0xa3, 0x34, 0x58, 0x3c, 0x59, 0xf3, 0x53, 0x50, 0xd1, 0x53, 0xf4, 0x0c, 0x91, 0x6a, 0x65, 0x73, 0x88, 0xc0,
-    0x42, 0x73, 0x4a, 0xd6, 0x8c, 0x72, 0xfe, 0xaf, 0x19, 0x12, 0x15, 0x54, 0x35, 0xce, 0xcc, 0xdf, 0xa4, 0x17, 0x8b, 0x7b,
-    0xc8, 0x9d, 0x41, 0x3d, 0xeb, 0xef, 0xd0, 0xda, 0x87, 0xa5, 0xee, 0x43, 0x57, 0xe3, 0x15, 0xb4, 0x45, 0x79, 0x64, 0x42,
-    0x6e, 0x94, 0x40, 0x39, 0x34, 0xc7, 0x48, 0x2c, 0x4b, 0x89, 0x39, 0x79, 0x89, 0x73, 0x92, 0xd4, 0x6f, 0xd9, 0x2c, 0xe4,
-    0xd5, 0x38, 0xb9, 0xab, 0x5e, 0x83, 0xc2, 0xba, 0x2e, 0xf6, 0x08, 0xc9, 0xae, 0xfc, 0x1b, 0x26, 0xa2, 0x01, 0xca, 0xa3,
-    0x30, 0x32, 0x20, 0x27, 0x8a, 0xe1, 0x46, 0x54, 0x47, 0x27, 0x4c, 0x23, 0x76, 0xd0, 0x69, 0xcd, 0xff, 0x39, 0x88, 0x97,
-    0x9b, 0xfc, 0x7a, 0xc2, 0x33, 0xaf, 0x0c, 0x63, 0xce, 0xaa, 0x15, 0x7d, 0xf9, 0xaa, 0x9f, 0x4b, 0xe3, 0xf6, 0x3c, 0xed,
-    0xe9, 0x7b, 0x4e, 0x95, 0xc4, 0x11, 0x28, 0xac, 0x1d, 0x7f, 0xfc, 0x7a, 0x26, 0x9f, 0xd5, 0x3c, 0x69, 0x8c, 0x7c, 0x7b,
-    0x36, 0xfe, 0xa3, 0x58, 0x8a, 0xd1, 0x68, 0x81, 0xd2, 0xc8, 0x83, 0x5a, 0xe8, 0x83, 0x79, 0xd8, 0x1d, 0x32, 0xd6, 0xde,
-    0x89, 0x88, 0x9c, 0x8b, 0xa2, 0x12, 0xd1, 0xb4, 0xa8, 0xb6, 0xf3, 0x14, 0x1a, 0xf8, 0xd6, 0x4e, 0x6a, 0x1d, 0x7e, 0x42,
-    0xc0, 0x2b, 0x15, 0x49, 0xb6, 0x81, 0x99, 0x78, 0x1a, 0x95, 0x50, 0x2c, 0x49, 0x7b, 0x1a, 0x8b, 0xfc, 0x28, 0x87, 0xba,
-    0x18, 0x8f, 0x7f, 0x6d, 0xf6, 0x46, 0x05, 0x22, 0xc6, 0xff, 0x31, 0x98, 0x14, 0xf2, 0x15, 0xc5, 0xd7, 0x72, 0x6e, 0x5c,
-    0x07, 0x9d, 0xc8, 0x01, 0xc9, 0x36, 0x72, 0xf1, 0x3e, 0x59, 0xae, 0x25, 0x4b, 0x2d, 0xca, 0x38, 0xf2, 0x78, 0x82, 0x4d,
-    0x4e, 0xa4, 0xf6, 0x9e, 0x79, 0x5a, 0xf3, 0xab, 0x26, 0x93, 0xd1, 0x3e, 0x3e, 0xaa, 0xf9, 0x7f, 0x1a, 0x61, 0x71, 0x3d,
-    0x6d, 0xc5, 0x44, 0x87, 0x9d, 0x83, 0xee, 0xda, 0xf9, 0xa3, 0xd0, 0x93, 0xc0, 0x1e, 0xf9, 0xe9, 0x82, 0x56, 0xbd, 0xed,
-    0x3c, 0xb6, 0xec, 0x07, 0x34, 0xd5, 0x94, 0xdc, 0x47, 0x07, 0xff, 0x07, 0xe2, 0x7a, 0xff, 0xa7, 0xd9, 0xa2, 0xb4, 0xe6,
-    0xff, 0x47, 0x14, 0x33, 0xc2, 0xfa, 0x61, 0x57, 0x96, 0x81, 0x39, 0xd1, 0x6c, 0x77, 0x8c, 0xea, 0xe4, 0x8e, 0xff, 0x73,
-    0xba, 0x90, 0x35, 0x3a, 0xc5, 0xa0, 0xda, 0xe2, 0x03, 0xff, 0xb3, 0xba, 0xfd, 0x79, 0x0e, 0xcc, 0xb6, 0x57, 0xab, 0x17,
-    0x2e, 0x61, 0xa0, 0x83, 0x0d, 0x79, 0x38, 0xf8, 0x3f, 0xb0, 0x7b, 0x9c, 0xa9, 0xd5, 0xce, 0x3f, 0x51, 0xc9, 0x57, 0x7d,
-    0x1c, 0xf5, 0xff, 0x1e, 0xaf, 0x18, 0xeb, 0x21, 0x79, 0xf7, 0x79, 0x9e, 0xfb, 0xf7, 0x63, 0x12, 0x3d, 0x73, 0x38, 0xf8,
-    0x3f, 0x20, 0x5f, 0x3d, 0xa4, 0xd0, 0x6f, 0xff, 0xa1, 0x97, 0xcb, 0x7c, 0x87, 0x59, 0x99, 0xd8, 0x31, 0x5e, 0x25, 0x62,
-    0x6c, 0x1e, 0x3e, 0x60, 0xa5, 0xc2, 0x13, 0x6c, 0x46, 0x70, 0x35, 0xdf, 0xca, 0xbb, 0xc8, 0xbe, 0x68, 0x9d, 0x52, 0x4e,
-    0xc6, 0xc5, 0x1e, 0x7c, 0xd5, 0x23, 0xc9, 0xff, 0xd9, 0x88, 0x85, 0xef, 0x2a, 0x0f, 0x56, 0xe6, 0x3b, 0x3d, 0xad, 0x9d,
-    0x89, 0xd8, 0x80, 0xd6, 0x1a, 0xfb, 0xa4, 0x3a, 0x21, 0xf6, 0x4b, 0xb2, 0xeb, 0x53, 0xd7, 0x2d, 0x3b, 0x8f, 0xf7, 0x70,
-    0xb7, 0x0b, 0xcd, 0x7d, 0xb4, 0xf0, 0x7f, 0x20, 0xf7, 0xfc, 0x1f, 0xe9, 0x8a, 0xff, 0x03, 0xbb, 0xbb, 0x7f, 0x1c, 0xda,
-    0xb8, 0x15, 0x37, 0xf9, 0xb4, 0x5e, 0x97, 0x60, 0xde, 0x35, 0x26, 0x2c, 0xfc, 0x5f, 0x94, 0xdc, 0x6d, 0xe6, 0xe9, 0x5b,
-    0x8e, 0x92, 0xac, 0x0b, 0x6e, 0xf8, 0x3f, 0x0b, 0xf6, 0x28, 0xdb, 0xac, 0xe7, 0x63, 0xbc, 0x26, 0xe5, 0xd7, 0x71, 0x6e,
-    0xc4, 0xdf, 0x48, 0xf0, 0x7f, 0x00, 0xad, 0x43, 0x72, 0xe8, 0x89, 0xae, 0xed, 0x52, 0x9b, 0x18, 0x37, 0xed, 0x2c, 0x44,
-    0x34, 0x69, 0xff, 0x71, 0x4e, 0x53, 0xf1, 0x36, 0xab, 0x1c, 0xf9, 0x75, 0x51, 0x68, 0x85, 0x17, 0x3e, 0xfe, 0x8f, 0x41,
-    0x41, 0x26, 0x9b, 0x2d, 0xef, 0xfa, 0x1e, 0xe5, 0x7c, 0xb2, 0x36, 0x3b, 0xa9, 0xec, 0xab, 0x29, 0x42, 0x45, 0xa6, 0x65,
-    0xad, 0x35, 0xad, 0xf8, 0x81, 0x3b, 0x15, 0x9e, 0x88, 0x23, 0x11, 0x47, 0x45, 0x71, 0x22, 0xec, 0xb8, 0x99, 0x89, 0x14,
-    0x90, 0x3f, 0x6a, 0xf9, 0xff, 0x51, 0xcd, 0xcc, 0x0f, 0x2c, 0xa8, 0x15, 0xf5, 0x1d, 0x9c, 0xbd, 0xde, 0x40, 0xcc, 0xc7,
-    0x0f, 0x64, 0x4e, 0x84, 0xee, 0x6f, 0xd7, 0x63, 0x36, 0x9e, 0xd2, 0xb6, 0x23, 0x09, 0xe4, 0x73, 0x79, 0x31, 0x44, 0x2a,
-    0x29, 0xe2, 0xf0, 0x09, 0x9c, 0x96, 0xf5, 0xc5, 0x54, 0xac, 0x16, 0xee, 0x22, 0x4e, 0x24, 0xe5, 0xfa, 0x6c, 0xae, 0x15,
-    0xcd, 0x33, 0x3a, 0xf9, 0x3f, 0xf0, 0x5b, 0x9f, 0x75, 0x64, 0xd4, 0x68, 0xe2, 0xff, 0x80, 0x6f, 0x49, 0x17, 0x46, 0x83,
-    0x46, 0xaf, 0xb3, 0x18, 0x2f, 0xb5, 0xed, 0xd6, 0x6d, 0x6d, 0x53, 0xb2, 0xb3, 0x4f, 0xe0, 0x58, 0x78, 0x78, 0xe7, 0xff,
-    0xeb, 0x35, 0x73, 0xab, 0x89, 0x31, 0x88, 0xac, 0x28, 0x7e, 0xf0, 0x3f, 0xd5, 0xf8, 0xce, 0x53, 0xd0, 0xdd, 0x36, 0x66,
-    0xd6, 0x41, 0x91, 0x06, 0x6f, 0x8c, 0x92, 0xc4, 0x3a, 0x7c, 0xfc, 0x1f, 0xf0, 0x67, 0x72, 0x6e, 0xe7, 0x2e, 0x3c, 0xc7,
-    0xb1, 0x6f, 0xf3, 0xde, 0x4e, 0x1a, 0x2b, 0x64, 0x1a, 0x87, 0x49, 0xda, 0x84, 0xe8, 0x28, 0x44, 0xdc, 0xff, 0xae, 0xd0,
-    0x27, 0x31, 0xbc, 0xfc, 0x9f, 0x1c, 0x51, 0xf1, 0x07, 0x41, 0xbb, 0x0e, 0x60, 0x98, 0xc7, 0x3c, 0x87, 0x45, 0x88, 0xde,
-    0xe9, 0x15, 0x1f, 0xac, 0xd7, 0x0e, 0x90, 0x7d, 0x67, 0x36, 0x85, 0x27, 0x32, 0x11, 0x09, 0xc4, 0x51, 0xa5, 0x33, 0x67,
-    0x7b, 0x57, 0xf1, 0x1d, 0xdf, 0x61, 0xfc, 0x51, 0xa2, 0x3d, 0xfe, 0x6f, 0x78, 0x91, 0x03, 0xa5, 0x50, 0x19, 0xb5, 0xd1,
-    0x08, 0xcd, 0xd1, 0x02, 0x4d, 0x70, 0x2f, 0xee, 0x4c, 0xca, 0xf4, 0xe9, 0x35, 0x8a, 0xff, 0x08, 0x6c, 0x93, 0x68, 0xac,
-    0xce, 0xe0, 0x0b, 0x74, 0x72, 0xd8, 0x5b, 0x14, 0x40, 0x05, 0x54, 0xc1, 0x3d, 0xa8, 0x8f, 0x66, 0x78, 0x10, 0x75, 0x71,
-    0x3b, 0xca, 0xa0, 0x80, 0x4b, 0xd9, 0x56, 0xf4, 0x22, 0x0f, 0xfa, 0xe2, 0x1b, 0x26, 0xda, 0x59, 0xe8, 0x99, 0x6d, 0x25,
-    0xc6, 0xa3, 0x29, 0xf2, 0x44, 0x4d, 0x9b, 0x8b, 0xe1, 0x09, 0x4c, 0xc6, 0x02, 0xac, 0xc4, 0x0f, 0xd8, 0x8c, 0xa5, 0x78,
-    0x0f, 0xa3, 0x71, 0x9f, 0xcb, 0x88, 0x1a, 0x06, 0x7e, 0xd9, 0x0a, 0x37, 0xc3, 0x6c, 0x6c, 0xe3, 0x4a, 0xab, 0xff, 0xc2,
-    0x52, 0x0c, 0x43, 0xa1, 0xa8, 0x68, 0x67, 0x26, 0xd4, 0xc7, 0x48, 0xac, 0xe6, 0xb6, 0xf3, 0x08, 0x5e, 0xd3, 0x88, 0xf8,
-    0x12, 0x8e, 0x3e, 0xac, 0x8a, 0x89, 0x1c, 0x3b, 0x74, 0xba, 0x87, 0x9a, 0x84, 0x6b, 0xd2, 0xbc, 0x0f, 0x4b, 0xa2, 0x23,
-    0xde, 0xc4, 0x87, 0xf8, 0x06, 0x3f, 0x62, 0x1d, 0x16, 0x63, 0x1a, 0x06, 0xa2, 0x92, 0x92, 0xec, 0xdb, 0xc0, 0x20, 0x92,
-    0x3c, 0xf1, 0x14, 0x26, 0xe0, 0x5d, 0x7c, 0x85, 0x6d, 0xd8, 0x86, 0x55, 0xf8, 0x18, 0x33, 0x30, 0x06, 0x8f, 0xe2, 0x26,
-    0x8f, 0x96, 0x25, 0x97, 0x1f, 0xf2, 0xe0, 0x41, 0xbc, 0x80, 0xc9, 0x49, 0x73, 0x7a, 0x2d, 0xbe, 0xc2, 0xc7, 0x78, 0x17,
-    0xe3, 0xd0, 0x19, 0x75, 0x71, 0xad, 0x99, 0xd7, 0x06, 0x1a, 0xc8, 0x88, 0x5b, 0xf0, 0x08, 0x46, 0xe1, 0x33, 0x6c, 0xc6,
-    0x1c, 0x3c, 0x8b, 0xba, 0xbe, 0xc4, 0xbc, 0x0b, 0x87, 0x76, 0xb3, 0x36, 0x86, 0x32, 0x7e, 0x23, 0x63, 0x7d, 0xc9, 0xd2,
-    0xef, 0x07, 0x0a, 0xa3, 0x31, 0x86, 0x25, 0xf9, 0x1b, 0xad, 0xc4, 0x56, 0x7c, 0x8f, 0x4f, 0xf0, 0x3a, 0xfa, 0xe1, 0x11,
-    0xd4, 0x70, 0xb4, 0x34, 0x36, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x50, 0xd1, 0x80, 0xfd, 0xa5, 0x95, 0xdd, 0xc6, 0xc0,
-    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xe0, 0x72, 0x40, 0x7f, 0x22, 0x01, 0x78, 0xd0, 0xf4, 0x87, 0x81, 0x81, 0x81, 0x81, 0x81,
-    0xc1, 0x15, 0x81, 0xdc, 0xc4, 0x06, 0xf9, 0x12, 0xa6, 0xbb, 0xb0, 0x37, 0x36, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x48,
-    0x7f, 0x18, 0xc9, 0x58, 0xd8, 0x9d, 0xc4, 0x4b, 0xb8, 0xcb, 0xd8, 0x07, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x5c, 0xf6,
-    0x36, 0x00, 0x6f, 0x73, 0x3c, 0x01, 0x66, 0xa1, 0x3d, 0xaa, 0x23, 0x9f, 0xe9, 0x1f, 0x03, 0x03, 0x03, 0x03, 0x03, 0x83,
-    0xcb, 0x16, 0x8f, 0x92, 0x4c, 0x0c, 0x76, 0xdf, 0xc5, 0xb2, 0xa6, 0x7f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x2e, 0x53,
-    0x94, 0xb5, 0xe5, 0x90, 0x0a, 0x66, 0x1d, 0xbb, 0xdc, 0x22, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x50, 0xdc,
-    0x8c, 0x51, 0xd8, 0x6f, 0xe3, 0xff, 0x69, 0xa6, 0x5f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x2e, 0x7b, 0xc4, 0xa1, 0x26,
-    0x26, 0x62, 0xa5, 0x15, 0x17, 0xbb, 0xb9, 0xe9, 0x13, 0x03, 0x03, 0x03, 0x03, 0x03, 0x83, 0x2b, 0x08, 0x25, 0xd0, 0x10,
-    0x03, 0x5c, 0x65, 0xb2, 0x35, 0x30, 0x48, 0xb7, 0xf8, 0x3f, 0x7b, 0x67, 0x1e, 0x6f, 0x43, 0xfd, 0xff, 0xf1, 0x73, 0xaf,
-    0x9d, 0x64, 0x8f, 0x08, 0x89, 0xa4, 0x08, 0xdd, 0x8a, 0xe2, 0x47, 0x14, 0x65, 0x49, 0x49, 0x3b, 0x11, 0x15, 0x51, 0xa1,
-    0xd5, 0x17, 0x59, 0x43, 0x52, 0x76, 0xb2, 0xb6, 0xab, 0x14, 0x21, 0x84, 0x92, 0x6f, 0xbe, 0xdf, 0xaf, 0x96, 0xaf, 0xb4,
-    0xa9, 0xbe, 0x29, 0xa5, 0xa8, 0xec, 0xa9, 0xd0, 0x62, 0xbb, 0xf7, 0xf5, 0x7b, 0x1c, 0xf7, 0x9a, 0xf3, 0x9e, 0x73, 0x66,
-    0x3e, 0xf3, 0x99, 0x39, 0x33, 0x73, 0xee, 0xe5, 0x75, 0x9e, 0xff, 0x70, 0xe7, 0x33, 0x9f, 0xd9, 0xe7, 0xf5, 0x99, 0xf7,
-    0xe7, 0xbd, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08,
-    0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08,
-    0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08,
-    0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08,
-    0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08,
-    0x21, 0xc7, 0x19, 0xc5, 0x31, 0xd1, 0x13, 0xf9, 0x13, 0x7a, 0xea, 0x8c, 0xa5, 0x36, 0x34, 0x4e, 0x68, 0x5b, 0xc7, 0x58,
-    0xb6, 0x04, 0xc5, 0x3d, 0xee, 0x79, 0x37, 0xdb, 0xed, 0x35, 0xd0, 0xec, 0xa1, 0x91, 0x71, 0x34, 0x37, 0x6a, 0xae, 0xd1,
-    0x10, 0xfb, 0x3c, 0xd2, 0xce, 0xa6, 0xc7, 0xd2, 0x16, 0x67, 0x52, 0x45, 0x41, 0x9c, 0x86, 0x0c, 0xb4, 0xc2, 0xad, 0xb8,
-    0x15, 0x0d, 0x51, 0xc2, 0xc5, 0x9a, 0xa5, 0x70, 0x7e, 0x20, 0x77, 0x50, 0x45, 0xb4, 0x43, 0x77, 0xb4, 0x47, 0x23, 0xd4,
-    0x40, 0x41, 0x1f, 0xfb, 0x2d, 0x86, 0x0b, 0x51, 0x40, 0xbb, 0x75, 0x09, 0x5c, 0x82, 0xdb, 0xd0, 0x14, 0xa5, 0x3c, 0x6f,
-    0xef, 0x64, 0x5c, 0x80, 0x96, 0xa8, 0x8f, 0x8a, 0x2e, 0xb6, 0x7a, 0x8c, 0x7c, 0x38, 0x07, 0xad, 0x71, 0x21, 0xaa, 0xa2,
-    0x70, 0xca, 0xaf, 0x87, 0x57, 0xfc, 0xd8, 0x9f, 0x53, 0x50, 0xd7, 0x45, 0xeb, 0x22, 0xa8, 0x84, 0xba, 0x68, 0x8e, 0xcb,
-    0x51, 0x15, 0x69, 0x8a, 0x56, 0x67, 0xa1, 0x25, 0x2e, 0x43, 0x5d, 0x9c, 0xaa, 0x68, 0x65, 0x4d, 0x61, 0x54, 0xc4, 0xb9,
-    0x68, 0x86, 0xb6, 0x68, 0x84, 0x9a, 0xae, 0x9e, 0x96, 0x78, 0xd2, 0x51, 0x0b, 0x9d, 0xd0, 0x16, 0xe5, 0x3d, 0xf7, 0x50,
-    0x08, 0x95, 0x71, 0x3e, 0x5a, 0x21, 0xc3, 0xc5, 0x3d, 0xe2, 0x74, 0xb6, 0x9b, 0xa3, 0x39, 0x6a, 0xa3, 0x2c, 0xd2, 0x5d,
-    0xaf, 0x5b, 0x00, 0x95, 0xd1, 0x00, 0x6d, 0xd1, 0x14, 0x67, 0xa2, 0x90, 0xf6, 0xd9, 0xac, 0x85, 0x36, 0xe8, 0x81, 0x2e,
-    0xb8, 0x12, 0xe7, 0xe3, 0x64, 0x87, 0xa3, 0xad, 0x87, 0x4e, 0x18, 0x8d, 0xa5, 0xb8, 0x5f, 0x7b, 0x9f, 0x1e, 0xc3, 0xa2,
-    0x1c, 0xba, 0xd8, 0xb6, 0x29, 0x63, 0xb4, 0x59, 0x84, 0x1a, 0x16, 0xcf, 0xe1, 0x2b, 0xc6, 0xd2, 0xc1, 0x0e, 0x5b, 0x9b,
-    0x64, 0xb4, 0xec, 0x9b, 0xb0, 0x6c, 0xa6, 0xb1, 0x6c, 0x82, 0xa2, 0x87, 0x39, 0x39, 0x6d, 0xfa, 0xd8, 0xb6, 0xa8, 0x25,
-    0xf6, 0xf6, 0x6c, 0x8b, 0xe5, 0x2d, 0xc4, 0xf2, 0x5e, 0x8a, 0x2d, 0x3d, 0x60, 0xb4, 0x7a, 0x11, 0x45, 0x7d, 0x7d, 0xea,
-    0xcb, 0xc3, 0xdb, 0x2f, 0xf1, 0x1e, 0x1e, 0x69, 0xdb, 0xf6, 0x5a, 0x0b, 0x15, 0xdb, 0x63, 0x2c, 0xbd, 0xc5, 0xe3, 0x9e,
-    0x3f, 0x61, 0xbb, 0xbd, 0x76, 0x5a, 0xeb, 0xe7, 0xc7, 0x97, 0xc6, 0x1a, 0xfb, 0x70, 0xaa, 0xe6, 0x88, 0xc1, 0xeb, 0xef,
-    0x1a, 0x9b, 0x27, 0xf8, 0x73, 0x4c, 0xd1, 0xda, 0x72, 0x59, 0x74, 0xc2, 0x6c, 0x7c, 0x8b, 0xac, 0xb8, 0x7e, 0xb7, 0x62,
-    0x15, 0x46, 0x29, 0xc7, 0x50, 0xf5, 0x30, 0x16, 0x6f, 0xe2, 0x67, 0x00, 0x9b, 0x7d, 0xbc, 0x6f, 0xd2, 0xd0, 0x0a, 0x43,
-    0xb0, 0x04, 0x5b, 0x4d, 0x7b, 0xb3, 0x1f, 0x4b, 0xd0, 0x0b, 0xd5, 0x92, 0x1c, 0x4f, 0x8c, 0xc4, 0xeb, 0xf8, 0x0e, 0x99,
-    0x80, 0xc6, 0x1b, 0xbb, 0x20, 0xfa, 0x62, 0x1e, 0xbe, 0x13, 0xe7, 0xe5, 0x47, 0x2c, 0xc3, 0x23, 0x28, 0xa9, 0xbd, 0xbd,
-    0x8b, 0x31, 0x13, 0xab, 0xb1, 0x4d, 0x1c, 0x45, 0x16, 0x36, 0x61, 0xb6, 0xd6, 0x28, 0xf2, 0x42, 0xf4, 0xc2, 0x4c, 0xac,
-    0xc5, 0x5f, 0x62, 0xed, 0xbd, 0xd8, 0x88, 0x35, 0x98, 0x86, 0x6e, 0x38, 0x17, 0xf9, 0x02, 0xba, 0x1e, 0x85, 0x70, 0x33,
-    0xde, 0xc1, 0x66, 0x0c, 0x46, 0xc5, 0xa4, 0x5b, 0xfb, 0xb1, 0x3f, 0x4d, 0x30, 0x09, 0xff, 0xc4, 0x4e, 0x00, 0xff, 0x71,
-    0x50, 0xfc, 0x8b, 0x71, 0x0f, 0x9e, 0xc3, 0xc7, 0xf8, 0x11, 0x7f, 0x9a, 0xee, 0x9c, 0x7d, 0x58, 0x8b, 0x67, 0x70, 0xa9,
-    0x69, 0xaf, 0xdb, 0x60, 0x06, 0xb6, 0x98, 0xee, 0xf8, 0x9f, 0xf0, 0xa4, 0xc3, 0x75, 0x29, 0x82, 0x8b, 0x70, 0x37, 0x9e,
-    0xc1, 0x3a, 0x6c, 0xc1, 0x1f, 0x71, 0xcf, 0x4a, 0x16, 0x3e, 0xc6, 0x23, 0x16, 0xaa, 0xa1, 0xd6, 0xfd, 0x6b, 0xf1, 0x04,
-    0x56, 0x63, 0xaf, 0xb8, 0xbf, 0x16, 0x62, 0x20, 0x2e, 0xd0, 0x1a, 0x15, 0x9e, 0x8b, 0x6e, 0x98, 0x86, 0x35, 0xd8, 0x88,
-    0xdf, 0xc5, 0x7e, 0x1c, 0xc1, 0x06, 0xcc, 0xc3, 0x60, 0xb4, 0x47, 0x11, 0x0f, 0xe7, 0xfa, 0x0c, 0x74, 0xc3, 0x78, 0xbc,
-    0x8d, 0x1d, 0xa2, 0xc7, 0xc3, 0xd8, 0x8e, 0xcf, 0xb0, 0x14, 0xc3, 0x70, 0x25, 0x2a, 0x28, 0xf6, 0xe7, 0x22, 0x0c, 0xc2,
-    0x1b, 0xf8, 0x14, 0x3b, 0x8f, 0x3e, 0x5d, 0xc7, 0x7e, 0x99, 0xf8, 0x06, 0xaf, 0xa2, 0xa1, 0x62, 0x9b, 0xe5, 0xf0, 0x38,
-    0xb6, 0x5a, 0xbc, 0x7b, 0x5e, 0xc7, 0x43, 0x38, 0xc3, 0x72, 0x8d, 0xf7, 0x8c, 0x56, 0x8f, 0x69, 0x1f, 0xd9, 0xfb, 0x1a,
-    0xeb, 0x54, 0x12, 0xdb, 0xb7, 0xba, 0x06, 0x4b, 0x8d, 0xa5, 0x7b, 0x2c, 0x9f, 0xbe, 0xd8, 0x38, 0xe2, 0x88, 0xd1, 0xb2,
-    0x53, 0xc2, 0xd2, 0xe7, 0x8c, 0x65, 0x07, 0x6d, 0xf5, 0xb6, 0x86, 0xd1, 0x66, 0xbd, 0xed, 0x56, 0x7a, 0x1b, 0x6d, 0xfe,
-    0xb0, 0x1c, 0xf5, 0xe5, 0xc7, 0x5a, 0xa3, 0xc5, 0x21, 0x64, 0xd8, 0xf4, 0xd2, 0x54, 0x5c, 0xad, 0x3b, 0x7d, 0x1e, 0xf5,
-    0xa7, 0x46, 0xff, 0x23, 0x98, 0x65, 0x2c, 0x5d, 0x96, 0x22, 0xfd, 0xbf, 0xdb, 0xb4, 0xce, 0x33, 0x29, 0xd0, 0xff, 0x0a,
-    0x39, 0x23, 0x90, 0x9e, 0x1a, 0x5b, 0xbe, 0x55, 0xd9, 0xfb, 0x66, 0xb4, 0xb4, 0x5d, 0xb3, 0x8f, 0x68, 0xe5, 0xdf, 0x5d,
-    0xf3, 0xa6, 0x62, 0x6f, 0x3e, 0x4b, 0xaa, 0xef, 0x66, 0xa2, 0x27, 0x27, 0xfd, 0x3f, 0x0f, 0xeb, 0x6d, 0xf6, 0xe1, 0x07,
-    0x34, 0xd2, 0xb2, 0x31, 0x4c, 0x30, 0xbd, 0x09, 0xe5, 0xef, 0x56, 0x87, 0x75, 0xcb, 0x61, 0xbe, 0xe3, 0x55, 0xff, 0x03,
-    0x1d, 0x03, 0xb9, 0x1e, 0x03, 0x5c, 0x9d, 0x6b, 0x75, 0x6b, 0x3f, 0xf6, 0x27, 0xf6, 0x2c, 0xfe, 0x47, 0x69, 0xb1, 0x3b,
-    0xec, 0x70, 0xbe, 0xb2, 0x30, 0xe5, 0xe8, 0xfb, 0xb6, 0x34, 0x06, 0x1d, 0x1d, 0x4d, 0x58, 0xfd, 0x0e, 0xe3, 0x2e, 0xdb,
-    0x2d, 0x74, 0x75, 0xdc, 0x42, 0x74, 0x8c, 0xda, 0x49, 0xfb, 0xb8, 0xaa, 0xe0, 0x5f, 0x36, 0xbd, 0x64, 0x62, 0xb4, 0x83,
-    0x9d, 0xa8, 0x63, 0xc2, 0xf8, 0x23, 0xf1, 0xf7, 0x0d, 0x9a, 0xb8, 0x3a, 0xcf, 0xf9, 0x31, 0x00, 0x07, 0x1c, 0x7b, 0xfd,
-    0x09, 0x27, 0x25, 0xac, 0xd9, 0x00, 0x0b, 0xf1, 0x9b, 0x72, 0xad, 0x2b, 0x6c, 0xed, 0x42, 0xa3, 0xb0, 0x5f, 0xb1, 0xde,
-    0x70, 0xcf, 0x5a, 0x1e, 0x84, 0xfe, 0x77, 0x15, 0xcb, 0x2f, 0x54, 0x6c, 0xeb, 0x06, 0xa3, 0xd5, 0x01, 0x0b, 0x4b, 0xc6,
-    0xf5, 0xa2, 0x97, 0x66, 0x36, 0x3d, 0xdc, 0x2e, 0xc6, 0x73, 0x76, 0xb6, 0x90, 0x57, 0x8d, 0x36, 0x8b, 0x6d, 0x5a, 0xd4,
-    0x14, 0x77, 0xc9, 0x17, 0x96, 0x96, 0x98, 0xe2, 0xf8, 0xde, 0x68, 0xf1, 0x86, 0x6b, 0x0b, 0x58, 0x6e, 0xd5, 0xff, 0xe6,
-    0x62, 0xdc, 0x53, 0x36, 0x05, 0xfa, 0x5f, 0x0a, 0xbb, 0xe3, 0x9e, 0xe7, 0x8c, 0x90, 0xf5, 0xbf, 0x22, 0x36, 0x18, 0x67,
-    0xe0, 0x52, 0xc7, 0x2d, 0x37, 0x76, 0x7c, 0x73, 0xce, 0xb6, 0xb1, 0x2b, 0xfa, 0xaf, 0xff, 0x2d, 0xb1, 0x5d, 0xb9, 0x2f,
-    0x63, 0x43, 0xd1, 0xff, 0x02, 0x18, 0x86, 0x43, 0x8a, 0xbd, 0x38, 0x8c, 0x41, 0xca, 0x2f, 0x80, 0xe8, 0xb8, 0x7a, 0x93,
-    0x62, 0xfd, 0xb3, 0x95, 0xeb, 0x76, 0xb0, 0xd5, 0x27, 0xf3, 0xaf, 0x4f, 0x00, 0xd7, 0x23, 0x0d, 0x1b, 0xc5, 0x16, 0x2e,
-    0x4e, 0xb2, 0x75, 0x78, 0xfa, 0xdf, 0x47, 0xeb, 0x8c, 0x7d, 0x83, 0x7e, 0x71, 0xcf, 0x66, 0xe2, 0xef, 0x49, 0x9b, 0x59,
-    0xb3, 0x3e, 0x9a, 0x4f, 0xe3, 0x2c, 0xad, 0x2f, 0xef, 0x8e, 0x0e, 0x8a, 0xf9, 0x21, 0xce, 0x4c, 0xfa, 0x68, 0x33, 0x31,
-    0x19, 0xc5, 0x34, 0xcf, 0x72, 0x5d, 0x7c, 0xa4, 0x79, 0x7c, 0x25, 0x3c, 0xec, 0x4d, 0x39, 0x1b, 0x9b, 0xff, 0x87, 0x0e,
-    0xeb, 0xb5, 0xcd, 0x55, 0xfa, 0x5f, 0x5a, 0xbc, 0x13, 0x06, 0x28, 0xb6, 0xf5, 0xb4, 0xd1, 0x6a, 0x89, 0xc5, 0xd2, 0x92,
-    0xa2, 0x97, 0x41, 0x36, 0x3d, 0xbc, 0x20, 0xf6, 0xc4, 0xee, 0xeb, 0x6b, 0xab, 0xc6, 0x77, 0x7b, 0x2f, 0xd1, 0xcf, 0x18,
-    0x8b, 0xe5, 0xb3, 0x8d, 0xa5, 0xbb, 0x14, 0xb6, 0x9d, 0x70, 0xf5, 0x3f, 0xd3, 0x62, 0xa4, 0x32, 0x52, 0x8c, 0x52, 0xfe,
-    0x61, 0xe2, 0x2c, 0x4b, 0xbb, 0x5a, 0xec, 0xdc, 0xf4, 0xf2, 0xa8, 0x13, 0xe6, 0xad, 0xac, 0x77, 0xa5, 0xff, 0x13, 0x12,
-    0x8e, 0xe9, 0xdf, 0x1a, 0x6b, 0x55, 0xc3, 0x04, 0x8f, 0x24, 0xce, 0x8b, 0x9e, 0x2d, 0x6c, 0xce, 0x7b, 0x1c, 0xad, 0x92,
-    0x3a, 0xd7, 0xe9, 0xa1, 0x10, 0xf4, 0xbf, 0x00, 0x1e, 0xb3, 0xfd, 0x62, 0x3e, 0xf6, 0x6b, 0x15, 0x82, 0xfe, 0x9f, 0x8c,
-    0x4f, 0x34, 0xce, 0xc8, 0x3c, 0xa5, 0x05, 0xf0, 0x57, 0xc5, 0x9a, 0xbf, 0x2b, 0xe6, 0x54, 0x4b, 0xe1, 0x45, 0xed, 0x27,
-    0x25, 0x08, 0xfd, 0xaf, 0x6e, 0xda, 0xc2, 0xc8, 0x24, 0x5b, 0xe7, 0x36, 0xfd, 0xd7, 0xfb, 0x2d, 0x4b, 0x72, 0x0b, 0x9f,
-    0x59, 0x7c, 0x23, 0x9b, 0xbf, 0xba, 0x5e, 0xd2, 0xe8, 0x65, 0x3f, 0xba, 0xfa, 0x70, 0xb4, 0x9b, 0x70, 0x89, 0xc6, 0x5c,
-    0xc2, 0x30, 0x1c, 0xd4, 0xee, 0xd1, 0xbd, 0xfe, 0x6f, 0xd1, 0x50, 0x39, 0x37, 0xe3, 0x86, 0x54, 0xe9, 0x7f, 0x04, 0x6f,
-    0x19, 0xcb, 0xff, 0xa9, 0xd8, 0xd6, 0x4f, 0x0e, 0x76, 0xbe, 0x98, 0xdd, 0xe7, 0x4d, 0x9b, 0x1e, 0xb6, 0x88, 0x3d, 0x19,
-    0x6a, 0x33, 0x53, 0x13, 0xfb, 0x55, 0x56, 0x8c, 0xcf, 0x97, 0x09, 0x4b, 0x42, 0xbc, 0xd5, 0xf2, 0x4a, 0xd1, 0x47, 0xfb,
-    0x00, 0xbc, 0x7e, 0xf2, 0xa3, 0x8e, 0x16, 0x57, 0x9a, 0xe6, 0x38, 0xad, 0x94, 0x26, 0xa6, 0xff, 0x7a, 0x1e, 0x1f, 0x13,
-    0xb4, 0xde, 0x19, 0xfa, 0xbc, 0xea, 0x42, 0xff, 0xcf, 0x12, 0xe3, 0xbb, 0xd8, 0xac, 0xd6, 0x75, 0x21, 0x7b, 0x5c, 0xd5,
-    0x14, 0x77, 0xe1, 0x57, 0x8e, 0xb6, 0xee, 0xbd, 0xd8, 0x83, 0x85, 0x18, 0x86, 0xbb, 0x70, 0x1d, 0x9a, 0xa2, 0x36, 0xda,
-    0x60, 0x20, 0xe6, 0x99, 0x66, 0x51, 0x7f, 0xb5, 0xf4, 0x7e, 0xf3, 0x57, 0xff, 0x1f, 0x37, 0x3d, 0xfb, 0x07, 0xf1, 0x09,
-    0x9e, 0xc7, 0x83, 0x68, 0x8b, 0x1b, 0x71, 0x1f, 0xc6, 0xe2, 0x3d, 0x64, 0xe2, 0xa0, 0xf6, 0xf7, 0x4c, 0x32, 0xfa, 0x3f,
-    0xd1, 0x64, 0xfb, 0xf8, 0x27, 0x1e, 0x41, 0x2b, 0x54, 0xc7, 0x55, 0x18, 0x8e, 0x2f, 0x4c, 0x7b, 0xd8, 0x48, 0xe1, 0xff,
-    0x23, 0x7f, 0x1f, 0x63, 0x26, 0xfa, 0xa2, 0x1d, 0xba, 0x60, 0x20, 0x66, 0x61, 0x0b, 0x56, 0x29, 0xf6, 0xf0, 0xb5, 0x04,
-    0x7b, 0xeb, 0x1b, 0x18, 0x85, 0x3b, 0x70, 0x2f, 0x86, 0x61, 0x22, 0x16, 0x63, 0xb3, 0xb8, 0xa7, 0xfa, 0x04, 0x72, 0x3d,
-    0xbe, 0x72, 0x7c, 0x0b, 0xea, 0xb7, 0x4e, 0x85, 0xfe, 0x67, 0x62, 0x3d, 0x16, 0x62, 0x32, 0x06, 0xa0, 0x27, 0xba, 0x61,
-    0x24, 0xde, 0xb4, 0xf9, 0xe2, 0x3f, 0x88, 0x2f, 0xf1, 0x2a, 0x86, 0xe2, 0x1e, 0xcc, 0xc6, 0x27, 0x71, 0xd6, 0x9e, 0x0c,
-    0x17, 0x5b, 0x18, 0x80, 0x39, 0xf8, 0xc8, 0xf4, 0x06, 0x03, 0xee, 0x55, 0x1e, 0xd1, 0xd4, 0x38, 0x9d, 0x5f, 0x8d, 0x31,
-    0xb8, 0x0e, 0x77, 0x60, 0x36, 0xd6, 0x8b, 0x99, 0xe3, 0xe8, 0xbd, 0x77, 0x91, 0xe3, 0xd1, 0x66, 0xe1, 0x07, 0x2c, 0xc2,
-    0x64, 0x3c, 0x8a, 0x81, 0xb8, 0x0f, 0xe3, 0xb1, 0x2a, 0xe1, 0x68, 0xf7, 0xa1, 0x92, 0xc3, 0x19, 0xee, 0x9b, 0xf0, 0x05,
-    0xf6, 0x0d, 0xe6, 0x63, 0x30, 0x1e, 0xc0, 0x50, 0x3c, 0x81, 0x59, 0x58, 0x23, 0x3c, 0x14, 0x9c, 0xf4, 0x7f, 0x17, 0x96,
-    0x61, 0x22, 0x1e, 0xc0, 0x8d, 0xe8, 0x86, 0xfe, 0x98, 0x88, 0x05, 0xd8, 0x8e, 0x45, 0x96, 0x5b, 0xed, 0x2e, 0xd6, 0xfa,
-    0x1b, 0xab, 0x31, 0x02, 0x57, 0xa0, 0x0c, 0xaa, 0xe1, 0x12, 0x74, 0xc6, 0xc3, 0x58, 0x8e, 0x43, 0xf8, 0x3e, 0x09, 0x2d,
-    0x0f, 0x46, 0xff, 0x7b, 0x88, 0x3d, 0xb6, 0xb3, 0xf2, 0xd4, 0x16, 0x77, 0x98, 0xb5, 0xc7, 0x70, 0x3f, 0xe1, 0xcf, 0x93,
-    0xcf, 0xf2, 0x4b, 0x50, 0xfe, 0xde, 0xb2, 0xec, 0xa3, 0x8b, 0xb1, 0xfc, 0x73, 0xe5, 0x71, 0x57, 0x10, 0xf7, 0xc3, 0xb7,
-    0xa6, 0xb7, 0x67, 0x59, 0x61, 0x69, 0x7d, 0x3a, 0x85, 0xbe, 0xc1, 0x27, 0x99, 0xe6, 0x59, 0x67, 0x5a, 0xb6, 0x71, 0xab,
-    0xff, 0x0d, 0xc4, 0xf3, 0x51, 0x25, 0x64, 0xfd, 0x8f, 0x79, 0x89, 0xac, 0x11, 0x3a, 0xf0, 0xbd, 0x6f, 0x9e, 0xb9, 0xfa,
-    0xbe, 0x3c, 0x9b, 0x8d, 0xad, 0xaf, 0x70, 0xb0, 0x56, 0xd7, 0xb4, 0xfc, 0x22, 0xad, 0x87, 0x6f, 0xc5, 0x95, 0x79, 0x3c,
-    0x60, 0xfd, 0x3f, 0xd3, 0xf4, 0x0d, 0xb2, 0xce, 0xc2, 0xfe, 0x59, 0x09, 0x1d, 0x92, 0xdc, 0x86, 0x8e, 0xfe, 0x67, 0x88,
-    0x77, 0xf0, 0xde, 0xb8, 0xb9, 0x95, 0x22, 0xa6, 0xaf, 0xf3, 0x55, 0xb6, 0x67, 0xf3, 0x90, 0x98, 0x29, 0x78, 0x28, 0x6e,
-    0x5e, 0x2d, 0x0d, 0xa7, 0x28, 0x66, 0x3f, 0xe4, 0x6f, 0x3d, 0xce, 0xb1, 0x68, 0xb3, 0x39, 0x60, 0xfd, 0xef, 0x27, 0xc6,
-    0x2d, 0xc9, 0xb6, 0x4e, 0x85, 0xfe, 0x6f, 0xb6, 0xf8, 0xbe, 0x7d, 0x2a, 0xe1, 0x0b, 0xbd, 0x4d, 0xdc, 0x0c, 0xfb, 0x59,
-    0xf8, 0x51, 0x2c, 0x9f, 0xea, 0xfa, 0x58, 0xaa, 0x08, 0x85, 0x89, 0xfa, 0xf1, 0xd9, 0xcf, 0xdf, 0xd7, 0x36, 0xf9, 0x11,
-    0xc4, 0xc7, 0x28, 0x65, 0x1c, 0xf5, 0x96, 0x8c, 0xcd, 0x02, 0xa4, 0x7b, 0xb0, 0xbb, 0xd5, 0xc0, 0x2a, 0xd3, 0xd1, 0xbe,
-    0xa2, 0x3c, 0xbf, 0x95, 0x4c, 0xea, 0x7e, 0x08, 0x0f, 0x5b, 0x8c, 0xb1, 0x9b, 0x69, 0xea, 0xff, 0x16, 0x1b, 0x7b, 0x9a,
-    0xd5, 0x5f, 0x57, 0x08, 0x5f, 0xbf, 0xba, 0x96, 0x36, 0xb4, 0x4b, 0x72, 0x9d, 0xfe, 0x9f, 0x22, 0xde, 0x0d, 0xad, 0x6d,
-    0x7a, 0x79, 0xd0, 0x68, 0xb1, 0xdc, 0x71, 0x84, 0x60, 0xbd, 0x9d, 0xdb, 0xe3, 0xfc, 0x7c, 0xac, 0x22, 0x9f, 0x9e, 0x31,
-    0x96, 0x8f, 0x76, 0x38, 0xf2, 0x0e, 0x36, 0xf7, 0xf5, 0x7c, 0x61, 0x23, 0x2a, 0x9e, 0x32, 0xf5, 0x4f, 0xc7, 0x62, 0xd3,
-    0x58, 0x27, 0xbf, 0x2f, 0xfa, 0x1f, 0x11, 0xca, 0xd5, 0x2f, 0x54, 0xfd, 0x6f, 0x29, 0x46, 0xd1, 0x17, 0xa0, 0x34, 0x7e,
-    0x31, 0xfe, 0xdf, 0x3f, 0xf4, 0x73, 0x5b, 0x15, 0xdf, 0x19, 0x5b, 0x9f, 0xe8, 0xa9, 0x87, 0x92, 0xa2, 0x87, 0xbf, 0x2c,
-    0xe6, 0x65, 0xfc, 0xd4, 0xff, 0xa5, 0xe2, 0xcc, 0x8d, 0xf1, 0x35, 0xda, 0xcf, 0x8d, 0xfe, 0xa7, 0x0b, 0xaf, 0xd9, 0x1f,
-    0x2c, 0x67, 0x97, 0xc6, 0x89, 0x3e, 0xac, 0xdf, 0x50, 0x2f, 0x3b, 0xc6, 0x66, 0xd8, 0xc5, 0x1b, 0x7c, 0x2d, 0xd6, 0x9c,
-    0x6e, 0xf3, 0x85, 0x11, 0xb4, 0xfe, 0x17, 0x40, 0x7b, 0x2c, 0xc2, 0x67, 0xb8, 0x5f, 0x31, 0x4e, 0xd1, 0x6d, 0x9d, 0x3b,
-    0xf4, 0x3f, 0x3a, 0xe6, 0x92, 0x16, 0x99, 0x97, 0x2c, 0x55, 0xb5, 0xaa, 0xf0, 0xd8, 0xd8, 0x63, 0x31, 0x5a, 0x77, 0x3a,
-    0x96, 0x02, 0x98, 0xa9, 0xe5, 0xe1, 0xb9, 0xd2, 0x34, 0x27, 0x9b, 0x6e, 0xe1, 0xbb, 0x23, 0x67, 0xe2, 0x6f, 0xf3, 0x34,
-    0xef, 0x96, 0x8e, 0xfb, 0xf0, 0xb7, 0xe8, 0xe5, 0x32, 0xc5, 0x99, 0x9b, 0x27, 0xda, 0x6d, 0xb0, 0xd1, 0x3d, 0x5d, 0xfd,
-    0x77, 0x73, 0x95, 0x63, 0xdf, 0xa5, 0x37, 0xbb, 0xbc, 0x23, 0x52, 0xa7, 0xff, 0x11, 0xac, 0x76, 0xf8, 0x52, 0x8d, 0xe0,
-    0x5d, 0x87, 0x6b, 0x67, 0x7e, 0x86, 0xff, 0x61, 0xb1, 0x74, 0x6e, 0xdc, 0x68, 0xf5, 0x12, 0xe5, 0x1c, 0x83, 0xb3, 0x97,
-    0xe7, 0xb3, 0xe2, 0x6b, 0xb8, 0x45, 0xce, 0xdf, 0x3a, 0x89, 0x79, 0x81, 0xff, 0x4b, 0xe1, 0xd7, 0xff, 0x18, 0x71, 0x9c,
-    0xf6, 0x76, 0x6a, 0xf7, 0xfa, 0x3f, 0xc2, 0x58, 0xe3, 0xd3, 0x10, 0xf5, 0x3f, 0xbf, 0xb0, 0x10, 0x3f, 0x7b, 0xf4, 0x2f,
-    0xf7, 0x08, 0x3b, 0x5c, 0x85, 0xd0, 0xcf, 0x6e, 0x25, 0xa1, 0x28, 0xdd, 0x3d, 0xf5, 0x20, 0x23, 0x19, 0x6a, 0x06, 0xa8,
-    0xff, 0xad, 0xc5, 0x76, 0x26, 0x04, 0x76, 0x3e, 0x9c, 0xf5, 0xff, 0x2e, 0xd1, 0xa2, 0x8d, 0x8d, 0xbd, 0x6a, 0x87, 0x83,
-    0x22, 0xc5, 0xc6, 0x4c, 0x1f, 0xb9, 0xda, 0xbb, 0x7f, 0x88, 0x6d, 0x4f, 0xd2, 0x78, 0x77, 0xf4, 0x09, 0x25, 0x1e, 0x23,
-    0x19, 0x72, 0x8b, 0xfe, 0x47, 0x50, 0x54, 0xf8, 0x42, 0xaf, 0xb4, 0xe9, 0xe3, 0x1e, 0x71, 0xfe, 0x6f, 0xf0, 0x70, 0x2c,
-    0xa5, 0x84, 0xe6, 0x7e, 0x69, 0xd3, 0xa6, 0x9d, 0xd8, 0xc6, 0x78, 0xdb, 0xc8, 0x91, 0x98, 0x2d, 0x62, 0xa7, 0xe5, 0x7d,
-    0xaa, 0x73, 0x5e, 0x9b, 0x8b, 0x99, 0xa2, 0x0d, 0xb6, 0xe3, 0xe9, 0x56, 0x26, 0xf5, 0x2f, 0xea, 0xe9, 0xb9, 0xf1, 0x72,
-    0x95, 0xa5, 0x8d, 0xbb, 0x4a, 0x1e, 0xd2, 0xff, 0x58, 0xd4, 0xdd, 0x0e, 0xcb, 0x51, 0x64, 0x05, 0xc3, 0x83, 0xe9, 0x10,
-    0xca, 0xd8, 0x6e, 0x69, 0x9a, 0xe2, 0x5e, 0x4c, 0xc7, 0xae, 0x38, 0xfd, 0x1f, 0x91, 0xd0, 0xe6, 0x1c, 0x31, 0x2f, 0x9b,
-    0x5f, 0x23, 0xfb, 0xc8, 0x0f, 0xc2, 0x42, 0x13, 0xbd, 0x7e, 0xa7, 0x09, 0xff, 0xa4, 0x47, 0x53, 0xf8, 0x7e, 0xe8, 0x68,
-    0x8a, 0x6d, 0xae, 0x65, 0xdb, 0xce, 0xbd, 0xfe, 0x9f, 0xa3, 0xed, 0x6d, 0xed, 0xa7, 0xfe, 0xf7, 0x12, 0xb3, 0x7a, 0x15,
-    0x73, 0x46, 0x04, 0xff, 0x33, 0xfe, 0xf6, 0x54, 0x0a, 0xce, 0x70, 0x05, 0x23, 0x13, 0xc1, 0x6e, 0x07, 0xaf, 0x24, 0xbb,
-    0x77, 0xd1, 0x3e, 0x63, 0xff, 0x2f, 0x0f, 0x4c, 0x6f, 0x0a, 0x18, 0xf1, 0x0a, 0x51, 0x7b, 0x57, 0xf9, 0x94, 0xe9, 0x7f,
-    0x21, 0xf1, 0x5c, 0xbc, 0xa1, 0x35, 0x26, 0x3a, 0xc5, 0x62, 0x0c, 0x78, 0xd8, 0xd3, 0x97, 0x4d, 0x19, 0x11, 0x09, 0xb5,
-    0xcf, 0xc6, 0xf3, 0x89, 0xfa, 0xef, 0x7d, 0x4b, 0x31, 0x7b, 0xe7, 0x6f, 0x36, 0x91, 0x4e, 0x55, 0x84, 0x62, 0x8e, 0xf6,
-    0x74, 0x2c, 0xf2, 0xcb, 0xed, 0x24, 0xcb, 0xef, 0x83, 0x8d, 0xc2, 0x9e, 0x56, 0x5e, 0xcb, 0x6f, 0x7b, 0xac, 0xe7, 0xf3,
-    0x3a, 0xcf, 0xd1, 0x7f, 0xb7, 0xa0, 0x18, 0xab, 0xda, 0x79, 0xdb, 0x07, 0xa3, 0xff, 0x75, 0x45, 0x8f, 0x0d, 0x3d, 0xeb,
-    0xff, 0x46, 0x91, 0xe3, 0x26, 0xc6, 0x98, 0x00, 0xf5, 0xbf, 0x92, 0xf0, 0x50, 0xb6, 0xfa, 0x6e, 0xbe, 0xd3, 0x71, 0x94,
-    0x69, 0xf6, 0xbc, 0xfb, 0x2b, 0xc1, 0xd2, 0x54, 0x5f, 0xbc, 0x09, 0xb3, 0x7f, 0x1f, 0x28, 0x3c, 0x36, 0x5e, 0xd1, 0x3a,
-    0x63, 0x32, 0xca, 0xff, 0x59, 0xa4, 0x09, 0x3f, 0xc6, 0x8f, 0x03, 0xb2, 0xb4, 0xea, 0x70, 0xb6, 0x78, 0xe3, 0x65, 0x29,
-    0x3d, 0x10, 0xdd, 0xeb, 0x7f, 0x44, 0x78, 0x15, 0x8c, 0x08, 0x49, 0xff, 0x4b, 0x0a, 0x9b, 0xd6, 0xc3, 0x16, 0x23, 0xec,
-    0x4c, 0x9c, 0x97, 0x82, 0xb3, 0x5c, 0x0e, 0x9f, 0x1e, 0x9d, 0x63, 0xab, 0xe7, 0x71, 0xfd, 0x98, 0x2f, 0x7c, 0x8f, 0xc0,
-    0xf4, 0xe6, 0x02, 0x07, 0x3f, 0x83, 0xb0, 0xf4, 0xbf, 0xb9, 0x58, 0xde, 0x40, 0xa1, 0xd4, 0xaa, 0x38, 0xe0, 0xea, 0x4a,
-    0x8b, 0x89, 0x3d, 0x2d, 0xc4, 0x7a, 0xc3, 0x14, 0xed, 0xa8, 0xff, 0xde, 0xb6, 0x74, 0xa3, 0x38, 0xbf, 0x35, 0x1c, 0xef,
-    0xf5, 0xa7, 0x3c, 0x1d, 0xcb, 0x15, 0x62, 0x1b, 0x56, 0x73, 0x47, 0x75, 0xb4, 0x2c, 0x3c, 0xd1, 0x71, 0xe8, 0x8f, 0x42,
-    0xe3, 0xbc, 0x9e, 0xd7, 0x6a, 0xc2, 0x1e, 0xf1, 0x2f, 0xcb, 0x16, 0xe7, 0x3a, 0xfa, 0x99, 0x05, 0xa5, 0xff, 0xf9, 0x85,
-    0xc7, 0xe4, 0x63, 0x9e, 0xf5, 0xdf, 0xfa, 0xf7, 0x41, 0x80, 0xfa, 0x2f, 0x7b, 0x1a, 0xaf, 0x8c, 0x10, 0xe8, 0xa1, 0x38,
-    0x82, 0xa2, 0xe2, 0xe8, 0x2f, 0xb5, 0xf1, 0x1f, 0xf8, 0x09, 0xd3, 0x0d, 0x1f, 0xa2, 0xf8, 0x73, 0x1e, 0xf3, 0xea, 0xef,
-    0xec, 0xc1, 0xce, 0xfe, 0xaa, 0x18, 0x7d, 0x9c, 0x93, 0xb2, 0x77, 0x43, 0x31, 0x91, 0x23, 0x0f, 0x18, 0xa5, 0x6c, 0xeb,
-    0x45, 0xff, 0xfb, 0x0b, 0xbf, 0xc7, 0xb4, 0x50, 0xf4, 0x7f, 0x9c, 0x78, 0x0e, 0xe4, 0xdc, 0xed, 0x72, 0x87, 0xa7, 0x30,
-    0x68, 0x4a, 0xe3, 0x65, 0x54, 0xf5, 0xbc, 0xf6, 0x12, 0xc5, 0x35, 0xf2, 0x4b, 0x6f, 0x6e, 0x11, 0xe3, 0xc0, 0x72, 0x29,
-    0xd4, 0xff, 0x47, 0xc5, 0xd8, 0x5b, 0x65, 0x57, 0xfb, 0x5d, 0x11, 0xd7, 0x71, 0xb9, 0x38, 0x96, 0xc2, 0x9e, 0xb4, 0xf2,
-    0x88, 0x32, 0xff, 0x29, 0xf5, 0xdf, 0xdb, 0x96, 0x6a, 0x89, 0x6b, 0xdf, 0xd8, 0xa6, 0xcd, 0xf3, 0x8a, 0x9c, 0x2a, 0x3a,
-    0xc7, 0x52, 0x51, 0x6c, 0xa3, 0xb9, 0xc5, 0xf2, 0xeb, 0xc5, 0xbd, 0x71, 0x9a, 0xf2, 0xa8, 0xef, 0x15, 0x77, 0x43, 0x61,
-    0xcf, 0xe7, 0x35, 0x16, 0x07, 0xb5, 0xdb, 0x21, 0x53, 0x0d, 0x50, 0x3f, 0x54, 0xfd, 0x97, 0x3a, 0x9a, 0x69, 0x91, 0xc9,
-    0x2a, 0xf7, 0xea, 0xff, 0x03, 0xc2, 0xa7, 0xdb, 0x3e, 0xb6, 0xff, 0x88, 0xc3, 0x7b, 0x6c, 0xb9, 0xed, 0x5b, 0xf5, 0xd8,
-    0x08, 0x62, 0x06, 0xda, 0xda, 0x44, 0xe7, 0x15, 0x34, 0x2c, 0x03, 0x99, 0xda, 0x6f, 0xcb, 0x82, 0xf8, 0xcc, 0xe2, 0x4c,
-    0xf5, 0x4d, 0xe1, 0xbb, 0x41, 0x46, 0x7f, 0xbe, 0xe9, 0xe0, 0x9f, 0xee, 0x45, 0xff, 0x4f, 0x17, 0xd6, 0xbc, 0x06, 0x21,
-    0xe8, 0x7f, 0x4d, 0xe1, 0xbf, 0x7e, 0x63, 0x9c, 0x9d, 0xe3, 0x90, 0x32, 0x5f, 0x51, 0xee, 0x23, 0x5d, 0x5c, 0x8f, 0x98,
-    0xa7, 0xe9, 0x94, 0xc0, 0xf4, 0x66, 0x84, 0x98, 0x55, 0x8b, 0xa4, 0x50, 0xff, 0x63, 0x99, 0x45, 0xdf, 0x51, 0xf6, 0xf3,
-    0xa9, 0xe2, 0x7e, 0xbc, 0xd3, 0xe3, 0xb1, 0x4c, 0x57, 0xbc, 0x57, 0xa8, 0xff, 0xc9, 0xeb, 0x7f, 0x05, 0x47, 0xcf, 0x0e,
-    0x19, 0xf9, 0xf9, 0x81, 0xa7, 0x63, 0x29, 0x20, 0xde, 0x39, 0x56, 0x99, 0x00, 0x87, 0x18, 0x4b, 0xb7, 0xb9, 0xc8, 0xc9,
-    0x55, 0xd7, 0xf3, 0x79, 0x95, 0x36, 0x0f, 0xab, 0xd9, 0x86, 0xa1, 0xe2, 0x4b, 0x30, 0x2d, 0x64, 0xfd, 0x1f, 0x66, 0x52,
-    0xa2, 0xa5, 0xa8, 0x9d, 0x47, 0xf4, 0xbf, 0x9a, 0xb8, 0xc6, 0x19, 0x09, 0x75, 0x6a, 0x74, 0xf2, 0x03, 0x98, 0x7d, 0x4d,
-    0x3e, 0x8c, 0xfb, 0x2a, 0xfe, 0xdb, 0x50, 0x9a, 0x22, 0x46, 0x04, 0xf6, 0x0c, 0x53, 0x9b, 0x4b, 0x8d, 0x75, 0xff, 0xeb,
-    0xe2, 0x7c, 0xd7, 0x31, 0x79, 0x84, 0x46, 0x7f, 0x6f, 0xfb, 0x9e, 0xf1, 0x4f, 0x9f, 0x1e, 0xa6, 0x68, 0x99, 0x32, 0x0e,
-    0xad, 0xbd, 0xe8, 0xbf, 0x7c, 0x9b, 0x4f, 0x0c, 0x41, 0xff, 0x63, 0x71, 0x0c, 0xef, 0x26, 0x9c, 0xd7, 0x49, 0x22, 0xd6,
-    0xa2, 0x50, 0x2e, 0xd5, 0xfc, 0x34, 0x5c, 0x86, 0x09, 0x98, 0x8f, 0xf7, 0xf1, 0x23, 0x0e, 0x21, 0x13, 0x7b, 0xf0, 0x11,
-    0x5e, 0xc6, 0x40, 0xe1, 0xf1, 0x1a, 0x9c, 0xfe, 0xcf, 0xf7, 0x74, 0x47, 0xfb, 0xaf, 0xff, 0x9b, 0xc5, 0xf1, 0x2c, 0x51,
-    0xb0, 0x4b, 0x61, 0xc5, 0xf5, 0x7a, 0x4e, 0xfe, 0x2d, 0x9e, 0xcb, 0x54, 0xea, 0xff, 0x95, 0xc6, 0x3c, 0xea, 0xac, 0xa4,
-    0x5b, 0xe7, 0x26, 0xfd, 0x2f, 0x2c, 0xae, 0x7d, 0x47, 0x47, 0x4d, 0xfa, 0xce, 0xe3, 0xb1, 0xfc, 0xaa, 0x9c, 0x71, 0x7f,
-    0x45, 0xa9, 0x51, 0x76, 0x96, 0x84, 0x1b, 0x3d, 0x9f, 0xd7, 0xf3, 0x45, 0x2f, 0x97, 0x2a, 0xfd, 0x15, 0xbe, 0x48, 0xe2,
-    0xb9, 0xf1, 0x76, 0x95, 0x0b, 0x8a, 0xf7, 0x73, 0xb6, 0x45, 0x64, 0x35, 0x3a, 0x6a, 0x59, 0xcc, 0xde, 0x17, 0xd9, 0x31,
-    0xd6, 0x58, 0x30, 0x33, 0x50, 0xfd, 0x8f, 0x88, 0xf8, 0x8c, 0xb1, 0xb6, 0x76, 0xf9, 0x5e, 0x8e, 0xd1, 0xd9, 0xb1, 0xe3,
-    0x96, 0xf9, 0x19, 0xda, 0x1b, 0xe3, 0xb1, 0xa2, 0x22, 0x26, 0xea, 0x47, 0x93, 0xa2, 0xc4, 0xd4, 0x64, 0xb0, 0xab, 0x27,
-    0xe9, 0x7e, 0xd3, 0xf9, 0xfe, 0xd5, 0xc1, 0x02, 0x15, 0x24, 0xe7, 0x8a, 0xb1, 0xc8, 0x61, 0x5b, 0x6b, 0x5c, 0xb2, 0xfa,
-    0xdf, 0x5b, 0x8c, 0xb6, 0xf3, 0x05, 0xac, 0xff, 0x2d, 0x4c, 0x71, 0x7f, 0x89, 0x16, 0xf8, 0x3d, 0xca, 0x88, 0x8f, 0x54,
-    0x73, 0x0a, 0xfa, 0x99, 0x62, 0xfd, 0xad, 0x7f, 0xba, 0xfa, 0x5f, 0x01, 0x4d, 0xd1, 0x01, 0x35, 0x5c, 0x8c, 0x2e, 0x3f,
-    0x17, 0x73, 0x53, 0xfe, 0x1d, 0x55, 0xb4, 0x5e, 0xcb, 0xb5, 0xa8, 0x27, 0xbc, 0x9a, 0x9d, 0xf4, 0xff, 0x0f, 0xd7, 0xb9,
-    0xe2, 0x16, 0xf9, 0xa6, 0x79, 0xbb, 0x1d, 0x23, 0x8b, 0xbc, 0xe8, 0x7f, 0x21, 0x9c, 0x8e, 0x46, 0xae, 0x6a, 0xd4, 0xb9,
-    0xdb, 0x7f, 0x75, 0xeb, 0xdc, 0xa4, 0xff, 0x11, 0xf1, 0xce, 0xe9, 0xe1, 0x68, 0x75, 0xff, 0xc5, 0xe3, 0xb1, 0x7c, 0xad,
-    0xf4, 0x63, 0x89, 0xf9, 0x24, 0xcd, 0x75, 0xb4, 0xc0, 0xfd, 0xad, 0xc8, 0x82, 0xaf, 0x7b, 0x5e, 0x4b, 0x8a, 0x3b, 0xb5,
-    0xb7, 0xc5, 0xf2, 0x98, 0x4d, 0xf8, 0xf5, 0xd0, 0xf5, 0x3f, 0xaa, 0xb7, 0xdb, 0x12, 0x9e, 0xa7, 0x5d, 0x78, 0xd4, 0x31,
-    0x1e, 0x20, 0x95, 0xfe, 0xff, 0xe6, 0x9a, 0x17, 0x5b, 0x4d, 0xba, 0x52, 0xce, 0xb0, 0xf3, 0x66, 0x6a, 0xc4, 0x7a, 0x7d,
-    0x65, 0x39, 0x56, 0x78, 0xda, 0x94, 0x83, 0xb2, 0xa7, 0x85, 0x0d, 0x28, 0x4d, 0xbc, 0x01, 0xce, 0xf7, 0xec, 0xcb, 0x1d,
-    0x1d, 0x53, 0x94, 0x4c, 0x91, 0xda, 0x14, 0x16, 0xef, 0x7b, 0xbd, 0xb8, 0x78, 0x6f, 0xfa, 0x5f, 0x5e, 0x64, 0x6b, 0xb8,
-    0x2c, 0x50, 0xfd, 0xcf, 0x27, 0x8e, 0xe8, 0x39, 0x87, 0xb1, 0xc8, 0xde, 0x00, 0xfd, 0xdb, 0xbd, 0x71, 0x79, 0x82, 0x65,
-    0xc8, 0x9b, 0xfe, 0x57, 0xc5, 0x58, 0xac, 0x13, 0xd9, 0x44, 0x7e, 0xc3, 0x2a, 0x8c, 0xc1, 0xf5, 0x8e, 0xf9, 0xd0, 0xf3,
-    0x89, 0xed, 0x8f, 0xf1, 0xe1, 0x78, 0x6a, 0x1d, 0xad, 0xd2, 0xb6, 0xde, 0xf0, 0xc3, 0xcf, 0xc2, 0x16, 0xbc, 0x85, 0x2e,
-    0x28, 0xe8, 0xf0, 0x1e, 0x2b, 0xec, 0x21, 0x57, 0xec, 0xc7, 0x8a, 0x73, 0xf2, 0xa7, 0xa5, 0x77, 0xf2, 0x22, 0xcb, 0x77,
-    0x4b, 0x09, 0xd1, 0xe7, 0x20, 0x1f, 0xf4, 0xff, 0x67, 0xb4, 0xc6, 0x04, 0x7c, 0x69, 0xaa, 0xab, 0xa6, 0x57, 0xa3, 0x2e,
-    0x5c, 0xfd, 0x7f, 0x50, 0x9c, 0x97, 0xae, 0x01, 0xeb, 0xff, 0x4e, 0xc7, 0x8c, 0xe9, 0xb7, 0x89, 0x0c, 0x00, 0xde, 0xce,
-    0x4b, 0xec, 0x9b, 0xf6, 0x09, 0xe5, 0x7d, 0x3e, 0xda, 0xf1, 0xcc, 0x7e, 0xad, 0xc8, 0x34, 0xad, 0x7f, 0x8d, 0x62, 0xa3,
-    0xca, 0x19, 0x16, 0x63, 0x8c, 0xbf, 0x34, 0xeb, 0x6a, 0x04, 0xa3, 0xff, 0xd1, 0x1c, 0x74, 0x73, 0x2c, 0xab, 0x6b, 0x2c,
-    0x50, 0xce, 0x06, 0x24, 0xa7, 0xff, 0x63, 0x92, 0xd6, 0xff, 0x9a, 0xa2, 0xdd, 0xe5, 0x96, 0xb1, 0xc3, 0x3a, 0xf9, 0xde,
-    0xc7, 0x5a, 0x64, 0x01, 0x4e, 0x37, 0x62, 0x8b, 0xb3, 0xeb, 0x50, 0x55, 0x36, 0x9e, 0xdf, 0x58, 0xbd, 0x81, 0xf3, 0x8c,
-    0xf5, 0xb6, 0xbb, 0xb4, 0xdf, 0x4f, 0x8f, 0x3b, 0xcf, 0x73, 0x53, 0xa4, 0x37, 0xe3, 0x4d, 0x33, 0xff, 0xe9, 0x81, 0xe9,
-    0xbf, 0xcc, 0xb5, 0xf1, 0x54, 0xa0, 0xfa, 0xdf, 0x33, 0x21, 0xee, 0x2f, 0x71, 0x66, 0x30, 0x36, 0xde, 0x9b, 0x9d, 0xab,
-    0xd4, 0xbf, 0x69, 0x5c, 0xb5, 0x54, 0x6f, 0xfa, 0xff, 0x0b, 0xe6, 0xda, 0xd6, 0x47, 0xfb, 0xdc, 0xd2, 0x17, 0x5a, 0x8e,
-    0x4b, 0xb3, 0x3c, 0x5a, 0xb4, 0xac, 0x23, 0xf8, 0xed, 0xaa, 0x98, 0x6d, 0x33, 0xc5, 0x67, 0x95, 0xb0, 0x88, 0xec, 0x77,
-    0xff, 0xfb, 0xc2, 0x43, 0x6e, 0xf6, 0xb6, 0x0e, 0x33, 0xc7, 0x53, 0x7d, 0xd0, 0x7f, 0xef, 0x35, 0xea, 0xc2, 0xd4, 0xff,
-    0x3b, 0xc5, 0x7e, 0xad, 0xb6, 0xb1, 0xfd, 0xfa, 0xa7, 0xff, 0xdb, 0x1d, 0xf5, 0xbf, 0x6b, 0xd2, 0xfa, 0xbf, 0x46, 0xa1,
-    0xff, 0x45, 0x44, 0x14, 0xd6, 0x10, 0xc7, 0x33, 0xfb, 0xa9, 0x22, 0x8f, 0x9c, 0xfe, 0x35, 0xfa, 0x56, 0x31, 0x8a, 0x28,
-    0xa6, 0x3d, 0xe6, 0x0c, 0x4a, 0xff, 0xb3, 0x63, 0x26, 0xd6, 0x5a, 0x66, 0x67, 0x1e, 0x61, 0x3b, 0x17, 0x90, 0x9c, 0xfe,
-    0xcf, 0x48, 0x5a, 0xff, 0x23, 0xf8, 0xd8, 0x68, 0xf7, 0x82, 0x65, 0xe6, 0x9f, 0x9e, 0xae, 0xe6, 0x22, 0x0f, 0x1a, 0xe7,
-    0xf4, 0x22, 0xe3, 0x6f, 0x55, 0xe3, 0x2c, 0x34, 0x6b, 0x2c, 0xe6, 0xa8, 0xdc, 0x69, 0xda, 0xd5, 0x16, 0x67, 0xb9, 0x73,
-    0x0a, 0xf4, 0xa6, 0x85, 0x78, 0xd3, 0x6d, 0xd5, 0xf4, 0x5f, 0xf4, 0xaa, 0xff, 0xdd, 0xc4, 0xb7, 0x68, 0xa1, 0xc0, 0xf4,
-    0xbf, 0x84, 0x98, 0x0f, 0x1e, 0xa4, 0x91, 0xe1, 0xe6, 0x88, 0xd2, 0xd7, 0x36, 0x5c, 0x1a, 0x9a, 0x6c, 0x42, 0xd1, 0x9c,
-    0xb3, 0x23, 0xd1, 0x05, 0xed, 0x70, 0x29, 0x3a, 0xa0, 0x3b, 0x06, 0x63, 0xb9, 0x88, 0xd1, 0x9c, 0xe2, 0x49, 0x6f, 0xb2,
-    0xe3, 0xd9, 0x6f, 0x52, 0xee, 0xc5, 0x36, 0x4d, 0xdb, 0xb7, 0x73, 0x2e, 0xe9, 0x97, 0x92, 0xa8, 0x63, 0x12, 0x11, 0x99,
-    0x7d, 0xd6, 0xe2, 0x49, 0x2d, 0xfa, 0xf9, 0xa4, 0xff, 0x32, 0xa6, 0xe0, 0xcd, 0x40, 0xf5, 0xdf, 0xa9, 0x46, 0x5d, 0x78,
-    0xfa, 0xdf, 0x56, 0x8c, 0x18, 0x3f, 0xb5, 0x9d, 0x9d, 0x38, 0x7e, 0xf4, 0x3f, 0x22, 0xaa, 0xad, 0x3a, 0x67, 0x5c, 0xff,
-    0x4d, 0x11, 0x67, 0xa6, 0x7f, 0x8d, 0xfe, 0x54, 0xe6, 0x79, 0x89, 0xdd, 0xef, 0xd3, 0x52, 0xa6, 0xff, 0xd9, 0xf1, 0xbf,
-    0x4f, 0xc7, 0x55, 0x50, 0xc8, 0xce, 0xa1, 0x54, 0xc2, 0x37, 0xfd, 0x5f, 0xa1, 0x98, 0xb1, 0x73, 0xaf, 0xff, 0x3d, 0xc4,
-    0x68, 0xba, 0x58, 0x82, 0xbf, 0xf9, 0x7e, 0x65, 0xfc, 0x4e, 0xcc, 0x1a, 0x14, 0xab, 0x52, 0x77, 0xec, 0xed, 0x38, 0x2a,
-    0x21, 0xa7, 0xff, 0x28, 0x43, 0x33, 0x4a, 0x27, 0xcc, 0xd9, 0xb4, 0x70, 0x35, 0xd7, 0xb2, 0x5b, 0xf8, 0x7a, 0xc6, 0x6c,
-    0xd1, 0xd5, 0x42, 0x8f, 0x45, 0xfb, 0x59, 0xcc, 0x94, 0x37, 0xd3, 0x5c, 0xcb, 0xab, 0xfe, 0x97, 0x14, 0xdf, 0x82, 0xed,
-    0x03, 0xd3, 0xff, 0xb1, 0x36, 0x71, 0x7f, 0xf6, 0x31, 0x1f, 0xab, 0x73, 0x8d, 0xfe, 0xbf, 0x61, 0xfa, 0x96, 0x3d, 0x5b,
-    0x99, 0x69, 0xda, 0xbb, 0xfe, 0x67, 0xbf, 0x61, 0x0a, 0x69, 0xf8, 0xbe, 0xad, 0x48, 0x2a, 0x9f, 0xc4, 0xff, 0x5c, 0xec,
-    0x8f, 0xda, 0xff, 0x7f, 0x8e, 0x0f, 0x3e, 0xef, 0xee, 0xf4, 0x7f, 0x93, 0xf0, 0x11, 0x0d, 0x5a, 0xff, 0x55, 0x35, 0xea,
-    0xc2, 0xd2, 0xff, 0x8b, 0x85, 0xb7, 0xc5, 0x26, 0xc5, 0x7c, 0xe9, 0xf1, 0xa4, 0xff, 0xcb, 0x1c, 0x6b, 0x47, 0x58, 0xcd,
-    0xdc, 0x77, 0xf7, 0x7c, 0x8d, 0x4a, 0x89, 0x5e, 0xba, 0x29, 0xef, 0xf7, 0xc5, 0x29, 0xd5, 0xff, 0xec, 0xb9, 0x80, 0x41,
-    0x09, 0xb5, 0xbf, 0xe7, 0xfa, 0xa6, 0xff, 0xb3, 0x34, 0x3c, 0x2f, 0xf5, 0xf5, 0xff, 0x24, 0x31, 0xcb, 0x79, 0x4b, 0x82,
-    0x57, 0xc0, 0x2c, 0xcd, 0x7d, 0x1a, 0x9b, 0xe0, 0xf5, 0xb4, 0x21, 0x61, 0x76, 0xe8, 0xe2, 0xb8, 0xeb, 0x77, 0x86, 0x8d,
-    0xef, 0x81, 0x93, 0x37, 0xc9, 0x2a, 0x11, 0x6f, 0x90, 0x21, 0x46, 0x00, 0xef, 0x69, 0xe4, 0x0f, 0xf4, 0x93, 0xf9, 0xe2,
-    0x1c, 0x8f, 0xd6, 0x5e, 0xcb, 0xab, 0xfe, 0x47, 0xb0, 0xc8, 0x17, 0xcf, 0x32, 0x95, 0xfe, 0x57, 0x16, 0x71, 0x7f, 0x37,
-    0x39, 0xe8, 0xd3, 0x61, 0xc7, 0x08, 0xa4, 0xb0, 0x7d, 0xfe, 0xf7, 0x88, 0x88, 0x37, 0xeb, 0x2a, 0x10, 0xee, 0xf4, 0x7f,
-    0x2b, 0x96, 0xe3, 0x51, 0xdc, 0x72, 0xd4, 0x72, 0xb0, 0xc7, 0x31, 0x8f, 0xe5, 0x31, 0x62, 0xf5, 0x59, 0xfe, 0xe7, 0xf9,
-    0x58, 0x0a, 0xc6, 0x55, 0xdc, 0xcf, 0xc2, 0x06, 0x3c, 0x8b, 0x9e, 0xe8, 0x89, 0x19, 0xf8, 0xc0, 0xc2, 0xb3, 0xaf, 0x84,
-    0x32, 0x26, 0xf5, 0x6b, 0x1f, 0xf4, 0xff, 0x80, 0xa5, 0x77, 0xf2, 0x1a, 0x9b, 0xba, 0x81, 0x8b, 0x85, 0x7d, 0xa8, 0xa0,
-    0x2f, 0xfa, 0xbf, 0x13, 0x2b, 0x31, 0x09, 0x0f, 0xe0, 0x76, 0x57, 0x35, 0xea, 0xc2, 0xd1, 0xff, 0x73, 0x85, 0xa7, 0xfc,
-    0x76, 0x54, 0x0f, 0xc5, 0xff, 0x2f, 0xf5, 0xfa, 0x3f, 0x56, 0x11, 0x5f, 0x60, 0x97, 0x05, 0xce, 0x2a, 0xcf, 0x9c, 0xee,
-    0x35, 0xaa, 0xe3, 0x90, 0xf3, 0xe0, 0x05, 0xcd, 0x4c, 0xd5, 0x61, 0xe8, 0x7f, 0xb6, 0xb7, 0xea, 0x5d, 0xa2, 0x62, 0x8a,
-    0x5d, 0x1d, 0x05, 0x2f, 0xfa, 0x3f, 0x58, 0x23, 0xba, 0xb6, 0x92, 0x8b, 0xca, 0x97, 0x53, 0xe3, 0x72, 0xba, 0xa4, 0x89,
-    0x99, 0x96, 0x0b, 0x34, 0xf7, 0xe9, 0x3c, 0xf1, 0x45, 0x7e, 0xb2, 0x29, 0x1b, 0x53, 0x63, 0x61, 0x25, 0xd8, 0x6d, 0xca,
-    0xcf, 0x14, 0x1b, 0x65, 0x8c, 0x73, 0x71, 0x5e, 0xfb, 0x09, 0x4b, 0x6c, 0x0d, 0xd3, 0x7c, 0xb5, 0x5d, 0x7d, 0xe1, 0x60,
-    0xe8, 0x24, 0xb6, 0xfb, 0x91, 0xa2, 0x46, 0x96, 0x7f, 0xfa, 0x7f, 0x83, 0x38, 0xc7, 0xc5, 0x03, 0xfa, 0xfe, 0x6f, 0x91,
-    0x73, 0x47, 0xbe, 0xe7, 0xe8, 0x8f, 0x31, 0x39, 0xe7, 0xd9, 0xef, 0x92, 0x64, 0x3c, 0x82, 0x5f, 0xc8, 0x2c, 0xc9, 0x76,
-    0x91, 0x0d, 0xfa, 0xfa, 0xbf, 0x24, 0x2e, 0x9b, 0x54, 0x1a, 0x1a, 0x0a, 0xb5, 0x8a, 0xda, 0xc5, 0x4e, 0x71, 0xcc, 0x7c,
-    0xbf, 0xdf, 0x73, 0x3e, 0xca, 0xde, 0xa6, 0x7d, 0x79, 0x2a, 0xae, 0xf6, 0x66, 0x3e, 0x74, 0x14, 0x59, 0xb0, 0xed, 0xf4,
-    0x7f, 0xa8, 0xb0, 0x4d, 0x95, 0x08, 0x39, 0xe6, 0xbd, 0xaf, 0xc3, 0xb7, 0x9a, 0x3b, 0xfd, 0xdf, 0x65, 0x51, 0x3f, 0x51,
-    0xaf, 0x46, 0x5d, 0x18, 0xfa, 0x5f, 0x5d, 0xcc, 0xf8, 0xfc, 0xee, 0x30, 0x1b, 0x76, 0x3c, 0xe9, 0xff, 0xed, 0x62, 0xce,
-    0xb7, 0x90, 0xe6, 0x7b, 0x0b, 0x16, 0xd1, 0xd1, 0xba, 0xd7, 0xa8, 0x83, 0x32, 0x53, 0xb5, 0xbc, 0xdf, 0xf7, 0x28, 0xdf,
-    0xc6, 0x61, 0xe9, 0x7f, 0x76, 0x76, 0x4d, 0x59, 0x11, 0x6e, 0xa5, 0x4f, 0xfa, 0xdf, 0x55, 0xa3, 0x72, 0xaf, 0x1b, 0xfd,
-    0xaf, 0x23, 0xbe, 0x33, 0xce, 0x32, 0xc5, 0xe4, 0xbb, 0xa9, 0xf9, 0x11, 0xb3, 0x57, 0x46, 0x7d, 0x5f, 0x1f, 0x31, 0x72,
-    0x35, 0xe5, 0xb3, 0xc8, 0x49, 0x75, 0xf8, 0xe8, 0x5c, 0xf9, 0xe7, 0xca, 0x1a, 0xd5, 0x76, 0xb3, 0x2b, 0xb1, 0x2f, 0xd4,
-    0x2e, 0x09, 0xdf, 0xe1, 0x87, 0x71, 0x71, 0x48, 0x6a, 0x73, 0xaa, 0xf8, 0x22, 0xfc, 0xc3, 0xc1, 0x27, 0xcc, 0x2f, 0xfd,
-    0x2f, 0x2a, 0xe6, 0xb7, 0x3b, 0x07, 0x18, 0xff, 0xd7, 0x16, 0xeb, 0x2c, 0x72, 0xc1, 0x26, 0xde, 0xdb, 0x9f, 0xa2, 0xbb,
-    0x8b, 0x71, 0x4f, 0xd0, 0x74, 0x17, 0xbe, 0xea, 0x45, 0x93, 0xd2, 0xff, 0xbd, 0x36, 0x73, 0x39, 0x15, 0xf0, 0x5f, 0x8d,
-    0x8a, 0x27, 0xd7, 0x88, 0x36, 0x3d, 0x3d, 0xce, 0xfc, 0xef, 0x14, 0x4f, 0xe4, 0xc3, 0x36, 0x5f, 0x17, 0x63, 0x1c, 0xf4,
-    0xff, 0x16, 0xb1, 0xbc, 0x75, 0xc8, 0xfa, 0x2f, 0xab, 0x82, 0xee, 0x50, 0x8c, 0x3e, 0x92, 0x89, 0xff, 0xd7, 0xa9, 0x51,
-    0x17, 0xbc, 0xfe, 0x9f, 0x26, 0x2c, 0x35, 0x7f, 0xa1, 0x69, 0x68, 0xf1, 0x7f, 0xa9, 0xd7, 0xff, 0xc6, 0xda, 0xf7, 0xf9,
-    0x3b, 0xc2, 0x8a, 0xe3, 0xfd, 0x1a, 0x2d, 0x17, 0xfe, 0x4f, 0x11, 0x87, 0xfb, 0xfd, 0xc6, 0x5c, 0xa2, 0xff, 0xd1, 0x38,
-    0x9c, 0x0f, 0x94, 0x39, 0xb4, 0xbc, 0xe8, 0xff, 0x65, 0xe2, 0x08, 0xba, 0xfa, 0xa0, 0xff, 0x11, 0xfc, 0xc7, 0x74, 0xa5,
-    0xe7, 0x7a, 0xaa, 0xb3, 0x36, 0xd0, 0x34, 0x1f, 0xb4, 0xc1, 0xd2, 0x17, 0xe3, 0x0a, 0x11, 0x27, 0x58, 0x47, 0xd4, 0xca,
-    0xd3, 0x7f, 0x33, 0xc6, 0x6a, 0x4e, 0xcc, 0x17, 0xf3, 0xf0, 0x5b, 0x43, 0xaf, 0xff, 0xbb, 0x54, 0x9c, 0xdf, 0x1e, 0xae,
-    0xd6, 0xf4, 0xae, 0xff, 0x11, 0x11, 0x61, 0xb2, 0x3c, 0xe0, 0xfc, 0xbf, 0x79, 0x8f, 0xfe, 0x1a, 0xf9, 0xc8, 0x92, 0xcd,
-    0xff, 0x57, 0x44, 0x3c, 0xcd, 0x7f, 0xa3, 0xb2, 0x4d, 0x4e, 0xad, 0x23, 0xa2, 0x42, 0x95, 0x17, 0x0b, 0xc0, 0x10, 0x0d,
-    0xcb, 0xb6, 0x73, 0xfc, 0xff, 0xd9, 0xc2, 0x43, 0xfb, 0x13, 0x8f, 0x33, 0x63, 0xde, 0xdf, 0x86, 0x4b, 0x1d, 0xaa, 0xbe,
-    0xf8, 0x91, 0xff, 0xc7, 0xb9, 0x46, 0x5d, 0xd0, 0xfa, 0x5f, 0x41, 0x44, 0xb6, 0x1d, 0xd4, 0x18, 0x65, 0x1d, 0x4f, 0xfa,
-    0x5f, 0x52, 0xcc, 0xc1, 0x7c, 0xaf, 0xb8, 0xbf, 0x9a, 0x88, 0x3b, 0x61, 0x99, 0xe7, 0x6b, 0x74, 0x96, 0xf0, 0xb4, 0x7e,
-    0xdb, 0xc6, 0xfe, 0x17, 0x6b, 0xf1, 0x7e, 0xae, 0xd1, 0xff, 0x08, 0xba, 0x28, 0xed, 0x16, 0x5e, 0xf4, 0xbf, 0xb2, 0x78,
-    0xb2, 0x3f, 0xf4, 0x45, 0xff, 0x3b, 0x8a, 0x11, 0x5a, 0x45, 0xc3, 0xcf, 0x6c, 0xaf, 0xab, 0x2a, 0x6b, 0xb1, 0x5c, 0x82,
-    0x99, 0xa2, 0x4e, 0x4c, 0xa3, 0x38, 0xcb, 0xe5, 0x36, 0x23, 0xaa, 0x70, 0x94, 0x45, 0x7d, 0x19, 0x27, 0xa6, 0x88, 0x79,
-    0xb6, 0xb2, 0x26, 0x7f, 0xf4, 0xd8, 0xb5, 0x9f, 0x1c, 0x82, 0xd6, 0x74, 0x15, 0x67, 0xf7, 0x75, 0x97, 0xeb, 0x26, 0xa3,
-    0xff, 0x6d, 0x85, 0xa5, 0xa3, 0x1c, 0xf5, 0xdf, 0x44, 0x2b, 0x07, 0xfb, 0xa0, 0x3f, 0xf9, 0x7f, 0xaf, 0x36, 0x79, 0x9e,
-    0x5b, 0xb7, 0x99, 0x9d, 0x94, 0x05, 0xa0, 0xac, 0xb0, 0xf2, 0xec, 0x50, 0x58, 0x56, 0x9d, 0xeb, 0xff, 0x3e, 0x2f, 0x5a,
-    0xdc, 0x17, 0xb2, 0xfe, 0x9f, 0x2e, 0xbc, 0x14, 0x32, 0xf1, 0x84, 0xc5, 0x71, 0xa4, 0xe3, 0x7a, 0x11, 0x8f, 0xe1, 0x2d,
-    0xff, 0x9f, 0x53, 0x8d, 0xba, 0x60, 0xf5, 0xbf, 0xac, 0xa8, 0x90, 0x7d, 0x48, 0xcb, 0x27, 0xf7, 0x78, 0xd2, 0xff, 0x98,
-    0x8d, 0x57, 0x6d, 0x8f, 0x5c, 0x29, 0x7c, 0x41, 0xce, 0xf3, 0x7c, 0x8d, 0x9e, 0x74, 0xa8, 0x21, 0x6f, 0x7e, 0xb3, 0xa9,
-    0xb2, 0xa4, 0x87, 0xad, 0xff, 0xf5, 0x95, 0xd9, 0x8f, 0xdf, 0xf7, 0x54, 0x39, 0x68, 0x81, 0x4d, 0xd4, 0xbe, 0x57, 0xfd,
-    0x2f, 0x24, 0x2c, 0x8e, 0x31, 0x5b, 0xc0, 0x93, 0x2e, 0x8f, 0x74, 0x8d, 0xc8, 0xd8, 0x71, 0xcc, 0x33, 0x24, 0xcd, 0xe6,
-    0x09, 0xc8, 0x34, 0x46, 0x02, 0x59, 0xda, 0x7e, 0xfb, 0xf5, 0xc5, 0x97, 0x55, 0xbc, 0x76, 0xcd, 0x14, 0x77, 0x59, 0x46,
-    0xc0, 0x4a, 0x73, 0x9a, 0x88, 0x67, 0xd9, 0xed, 0x5a, 0x87, 0x93, 0xd1, 0xff, 0x02, 0xc2, 0xa3, 0xe4, 0x2e, 0xea, 0x7f,
-    0x5c, 0xde, 0x3f, 0xe7, 0x9c, 0xa8, 0xc9, 0xeb, 0x7f, 0xba, 0xb0, 0xf7, 0xfe, 0x6c, 0x9b, 0x9d, 0x7d, 0x9f, 0xf0, 0x51,
-    0xb9, 0xc5, 0xe5, 0x71, 0x5c, 0xa3, 0x59, 0x3b, 0xcf, 0x59, 0xff, 0x2b, 0x09, 0x0d, 0xde, 0xef, 0xe9, 0xa9, 0x48, 0xe6,
-    0x6d, 0xd8, 0x2f, 0x2e, 0xb7, 0x40, 0x33, 0x63, 0xae, 0x32, 0x0d, 0x15, 0x71, 0x7d, 0x5c, 0x0d, 0x0f, 0x6f, 0xfa, 0xef,
-    0x54, 0xa3, 0x2e, 0x48, 0xfd, 0x2f, 0x25, 0x2a, 0xec, 0x1d, 0x51, 0x5a, 0x9c, 0x8f, 0x57, 0xfd, 0x2f, 0x2a, 0x2a, 0xfb,
-    0x6d, 0xb3, 0x54, 0xdc, 0x34, 0x61, 0x15, 0xb6, 0x8b, 0xcb, 0xeb, 0x23, 0xbe, 0xe9, 0xec, 0xe6, 0xed, 0x1e, 0x10, 0x5f,
-    0xbc, 0xf6, 0x11, 0xa5, 0x67, 0x8a, 0xda, 0x24, 0x5b, 0x50, 0x47, 0xc3, 0x8f, 0x20, 0x0c, 0xfd, 0xef, 0x24, 0x2c, 0x86,
-    0x05, 0x7d, 0xd2, 0x7f, 0x99, 0x0b, 0xf9, 0x10, 0xfa, 0x5a, 0xf8, 0x6a, 0xb9, 0xd3, 0xff, 0xf8, 0x0a, 0x06, 0xd9, 0xba,
-    0x5c, 0xcb, 0xe5, 0x91, 0x76, 0x4e, 0xe8, 0x23, 0x31, 0xdb, 0x63, 0xdd, 0x84, 0x36, 0x6f, 0x69, 0xfb, 0x77, 0xc7, 0x22,
-    0x3c, 0x5e, 0x4c, 0x58, 0x5a, 0x5c, 0xdc, 0x8b, 0xff, 0xd5, 0xca, 0xc3, 0xe3, 0x9d, 0x15, 0x1a, 0x4a, 0x13, 0x8c, 0xfe,
-    0x47, 0x30, 0xc3, 0x58, 0x7b, 0x0d, 0xf5, 0x3f, 0x8e, 0x9f, 0x85, 0xea, 0xd6, 0x0b, 0x48, 0xff, 0x23, 0xb8, 0x4f, 0x3c,
-    0x21, 0xc5, 0x1c, 0xe7, 0xc2, 0xb2, 0xab, 0x54, 0x17, 0xb3, 0xbc, 0x9f, 0x2b, 0xda, 0x64, 0x91, 0x8b, 0x59, 0x94, 0x2b,
-    0x24, 0xa5, 0xff, 0xe6, 0xa7, 0xfa, 0x08, 0x26, 0xdb, 0x64, 0xc9, 0x4c, 0xc7, 0x25, 0x36, 0x76, 0x86, 0x64, 0xde, 0x86,
-    0x05, 0x4c, 0x99, 0x31, 0xb3, 0x6d, 0x56, 0x5f, 0x62, 0x31, 0x3e, 0x11, 0x5f, 0xfd, 0xc9, 0xea, 0xbf, 0x53, 0x8d, 0xba,
-    0xe0, 0xf4, 0xbf, 0x94, 0xc8, 0x9c, 0x9e, 0x69, 0x78, 0x22, 0x9d, 0x58, 0xfa, 0x1f, 0xc1, 0x4d, 0xe2, 0xfc, 0xff, 0x9d,
-    0x70, 0x16, 0x8a, 0x98, 0x32, 0x58, 0xfc, 0x62, 0x44, 0x7d, 0xdb, 0xfb, 0xdd, 0xfe, 0x8c, 0xdb, 0x12, 0xbc, 0x89, 0xcd,
-    0x7e, 0x1e, 0x59, 0x4a, 0x35, 0x93, 0x59, 0xe1, 0x7e, 0xb7, 0x88, 0x29, 0x2f, 0x8f, 0xe9, 0xa6, 0xcc, 0x5e, 0x7e, 0xe9,
-    0xff, 0xf5, 0xa6, 0xbc, 0xf7, 0xe6, 0x18, 0xf1, 0x75, 0xca, 0x59, 0x89, 0xf7, 0x3d, 0x56, 0x0e, 0x5e, 0x11, 0x57, 0xfd,
-    0x66, 0x20, 0xae, 0x46, 0x0d, 0x94, 0x46, 0x45, 0xd4, 0x42, 0x63, 0xdc, 0x24, 0xf2, 0xea, 0xeb, 0xe9, 0x7f, 0xf9, 0x84,
-    0xbc, 0xa9, 0xcb, 0x3c, 0xf8, 0x3a, 0xec, 0x8e, 0xeb, 0xa3, 0xa6, 0x32, 0x4f, 0xb3, 0xbb, 0x58, 0xf6, 0x6e, 0x22, 0xdb,
-    0xbf, 0x55, 0xd6, 0xd9, 0x76, 0x9e, 0x67, 0xe4, 0xdd, 0xd1, 0xd1, 0x54, 0xe9, 0x29, 0x12, 0xb2, 0xfe, 0x5f, 0x22, 0x9e,
-    0x84, 0xaa, 0xd4, 0x7f, 0x9b, 0x08, 0xa0, 0xe8, 0xd3, 0x3f, 0x0d, 0x0d, 0x4d, 0x59, 0xb7, 0xa2, 0x7a, 0xbb, 0xd8, 0x07,
-    0xfd, 0x6f, 0x20, 0xb6, 0x52, 0xcf, 0xd6, 0x4f, 0x60, 0xb3, 0xe9, 0x1e, 0xdf, 0x84, 0x59, 0xb8, 0x17, 0x2d, 0x51, 0x09,
-    0x45, 0x50, 0x1d, 0x4d, 0x71, 0x13, 0x26, 0x60, 0x33, 0xd6, 0x5a, 0xae, 0x3b, 0x4d, 0xd3, 0x2f, 0x46, 0x47, 0xff, 0x8b,
-    0x89, 0x31, 0x51, 0xf6, 0x7c, 0xc2, 0x58, 0xdc, 0x89, 0x16, 0x38, 0x1d, 0x05, 0x71, 0x2a, 0x32, 0xd0, 0x16, 0x77, 0x60,
-    0xea, 0x51, 0x4b, 0x5c, 0x7d, 0xdf, 0xf5, 0x3f, 0x1a, 0x13, 0xf4, 0x83, 0x76, 0x0c, 0xbf, 0x37, 0xfd, 0x77, 0xaa, 0x51,
-    0x17, 0x94, 0xfe, 0x4b, 0xf5, 0xcf, 0x72, 0xf1, 0xb6, 0x39, 0xde, 0xf4, 0x3f, 0x4d, 0x58, 0x8b, 0xa3, 0xbf, 0x05, 0xe8,
-    0x8d, 0x8b, 0x50, 0x18, 0x65, 0xd1, 0x1a, 0x43, 0x45, 0x85, 0x00, 0xd5, 0x7e, 0xc6, 0xc7, 0xdd, 0x6e, 0xc0, 0x93, 0xe8,
-    0x81, 0x86, 0x28, 0x8e, 0xda, 0xb8, 0x15, 0x53, 0x4d, 0x95, 0xd5, 0x81, 0xd7, 0x1c, 0xbc, 0xb2, 0xff, 0x34, 0x7d, 0x19,
-    0x2f, 0xc1, 0x10, 0xb4, 0x41, 0x79, 0x9c, 0x8a, 0x56, 0xe8, 0x8f, 0xb9, 0x71, 0xf9, 0xc1, 0xfc, 0xd2, 0xff, 0x7c, 0xd8,
-    0x8f, 0x4c, 0xbc, 0x83, 0x7b, 0xd1, 0xd0, 0xf4, 0x85, 0x5f, 0x19, 0x7d, 0x84, 0x7f, 0x88, 0x75, 0xe5, 0x36, 0xaf, 0xfa,
-    0xdf, 0x58, 0xd8, 0xc2, 0x9d, 0x7e, 0x7a, 0x31, 0x7c, 0x4f, 0xc7, 0xad, 0xd5, 0xd2, 0xc3, 0x13, 0xff, 0xb8, 0xa9, 0x87,
-    0xb5, 0x36, 0xb6, 0x1c, 0x98, 0x22, 0x77, 0xf4, 0x3c, 0x93, 0x4a, 0x69, 0x64, 0xbc, 0x9e, 0x27, 0xee, 0xf8, 0xa0, 0x2a,
-    0xaf, 0x97, 0x12, 0x79, 0xa6, 0x7e, 0xf7, 0x54, 0x75, 0x28, 0x39, 0xfd, 0x4f, 0xc7, 0x4f, 0x49, 0x56, 0xdf, 0x39, 0x7e,
-    0xf5, 0xbf, 0xa4, 0xf0, 0x0e, 0x8d, 0x8d, 0x15, 0x37, 0xe0, 0x2b, 0x7c, 0x8b, 0x1f, 0xe2, 0xa2, 0xe6, 0xbd, 0xeb, 0xbf,
-    0xb4, 0xac, 0x5d, 0xa7, 0x50, 0xe7, 0x9d, 0x1a, 0xd9, 0x6b, 0xad, 0x62, 0x2c, 0xdf, 0xd2, 0xac, 0x9d, 0xa7, 0xa3, 0xff,
-    0xd1, 0x56, 0xdb, 0xb5, 0xde, 0x11, 0x1d, 0x03, 0xd0, 0xff, 0xe8, 0xf8, 0x63, 0x82, 0xe6, 0x7b, 0xca, 0x6b, 0xfd, 0x3f,
-    0x75, 0x8d, 0xba, 0x60, 0xf4, 0x7f, 0xa7, 0x50, 0x7f, 0xab, 0x3d, 0x3f, 0x71, 0xf4, 0x3f, 0x1a, 0x3b, 0xf6, 0xb3, 0x45,
-    0xce, 0x7b, 0xab, 0xda, 0x52, 0xe9, 0x9e, 0x73, 0x4c, 0xc5, 0x7e, 0xdf, 0xe0, 0x0c, 0x87, 0x33, 0x7c, 0x9b, 0x88, 0x0f,
-    0xf3, 0x92, 0x37, 0xcb, 0xcb, 0x1d, 0x2f, 0x6d, 0xda, 0x99, 0xf8, 0x0d, 0x5b, 0xb0, 0x01, 0xdb, 0x12, 0xf6, 0x63, 0x8b,
-    0xa5, 0x8d, 0x60, 0x8d, 0x66, 0xd5, 0x02, 0xab, 0x28, 0x80, 0x1d, 0xbe, 0xea, 0xff, 0xb9, 0xa6, 0xfa, 0x1a, 0x5f, 0x78,
-    0xaa, 0xa7, 0x7b, 0x86, 0x98, 0xa7, 0xb1, 0xae, 0xd2, 0x14, 0x1d, 0xa3, 0x1d, 0xd1, 0xce, 0xd5, 0x6c, 0xe5, 0xff, 0xb1,
-    0xce, 0xf6, 0x4e, 0xaa, 0x28, 0xde, 0xf1, 0xcf, 0x04, 0xa4, 0x31, 0x33, 0x34, 0x46, 0xb4, 0x41, 0xea, 0x7f, 0x04, 0xe3,
-    0x44, 0xde, 0x33, 0xea, 0x7f, 0xbc, 0x0f, 0xf0, 0x5e, 0x1f, 0xf2, 0xff, 0x6f, 0x76, 0x18, 0xed, 0xc7, 0xde, 0x6f, 0x03,
-    0x94, 0xfe, 0x08, 0x4b, 0x1c, 0xf7, 0xc2, 0xca, 0x82, 0xf3, 0x9d, 0x43, 0xf5, 0x25, 0x77, 0xfa, 0x1f, 0xad, 0xe4, 0xf5,
-    0xba, 0xc6, 0xf9, 0x18, 0x15, 0x88, 0xfe, 0x47, 0xb9, 0x30, 0xee, 0x3b, 0x30, 0x96, 0xbb, 0xec, 0x7a, 0x11, 0x33, 0xdc,
-    0xdb, 0xe3, 0xb6, 0xd5, 0x35, 0xea, 0x82, 0xd1, 0x7f, 0xf5, 0x7d, 0x74, 0x62, 0xe9, 0x7f, 0x34, 0x0e, 0x78, 0xa1, 0xc3,
-    0xbd, 0x75, 0x00, 0x7d, 0x14, 0x6a, 0xa2, 0xaf, 0xff, 0x73, 0xb5, 0x62, 0xbb, 0x2e, 0xc2, 0x96, 0x90, 0xf5, 0xff, 0x0e,
-    0x8d, 0x2d, 0xfd, 0x6a, 0x53, 0x05, 0x28, 0xf6, 0x6c, 0x3e, 0xef, 0x21, 0x06, 0xfd, 0x5f, 0x3e, 0xea, 0x7f, 0x04, 0x6f,
-    0x8b, 0x75, 0x6e, 0xf7, 0xf8, 0xb4, 0x2f, 0x17, 0xa3, 0xc0, 0x53, 0x1c, 0xe7, 0x2e, 0x0e, 0x69, 0xd4, 0x16, 0x8c, 0x92,
-    0x21, 0xc6, 0x0c, 0x4d, 0xb4, 0xbc, 0x18, 0xb2, 0x2c, 0x32, 0x4d, 0x25, 0x4f, 0x23, 0x31, 0xbe, 0x59, 0xed, 0x69, 0x84,
-    0x94, 0xbc, 0xfe, 0x5f, 0x20, 0xae, 0xd2, 0x39, 0xd4, 0xff, 0x38, 0x2e, 0xb7, 0xb0, 0x01, 0xf8, 0xab, 0xff, 0xd2, 0xcf,
-    0xc0, 0x69, 0x94, 0xd9, 0xc3, 0xa1, 0x0a, 0x6f, 0x62, 0xe6, 0xc4, 0xfc, 0x62, 0x74, 0x31, 0xd2, 0x17, 0xfd, 0xcf, 0xce,
-    0x8d, 0xb0, 0xdf, 0x75, 0xed, 0x5f, 0xff, 0xbc, 0xa1, 0xf2, 0xa1, 0x36, 0x6e, 0xc0, 0x70, 0xbc, 0x86, 0x0d, 0xf8, 0x12,
-    0x0b, 0x30, 0x1a, 0xdd, 0x72, 0x3c, 0xc1, 0xbf, 0x55, 0xcc, 0x02, 0x26, 0x5f, 0xa3, 0x2e, 0x0c, 0xfd, 0xdf, 0xe7, 0x2a,
-    0x73, 0xf9, 0xf1, 0xa8, 0xff, 0x91, 0xa3, 0xb5, 0x8f, 0xec, 0xeb, 0x6e, 0x6d, 0x70, 0xc8, 0x89, 0xd4, 0x47, 0xe4, 0x4f,
-    0xf8, 0x45, 0x31, 0x86, 0xb8, 0xcb, 0x45, 0x04, 0xcd, 0x9b, 0x8a, 0x3b, 0xfd, 0x27, 0xdf, 0xf5, 0x7f, 0x96, 0xe3, 0xdb,
-    0xe6, 0x6b, 0x5b, 0xd5, 0x9a, 0xa5, 0x59, 0x29, 0xc3, 0x9a, 0xfc, 0x18, 0x2a, 0xfc, 0xde, 0x90, 0x60, 0x71, 0x58, 0x88,
-    0x87, 0xd1, 0xca, 0xb1, 0x66, 0xe9, 0x31, 0xda, 0x88, 0x8c, 0x5b, 0x85, 0x3d, 0x3e, 0xeb, 0xed, 0x34, 0xfc, 0x07, 0x3a,
-    0xba, 0xcc, 0x63, 0x9b, 0x2e, 0xa2, 0xae, 0x5f, 0x73, 0xc8, 0x0f, 0xb0, 0x5d, 0x54, 0x6a, 0xf3, 0x3b, 0x1b, 0xb0, 0xf4,
-    0x68, 0x3a, 0x64, 0x99, 0x5f, 0x3e, 0x0c, 0xfd, 0x8f, 0x08, 0x85, 0x1b, 0x49, 0xfd, 0xb7, 0xb8, 0x5b, 0xae, 0xc4, 0x2a,
-    0x93, 0x2d, 0xcb, 0xfc, 0xfb, 0x0b, 0x1b, 0xf0, 0x1a, 0xae, 0x4e, 0xe2, 0xc9, 0xff, 0xc1, 0x45, 0xd5, 0xc9, 0x33, 0xf1,
-    0x92, 0xcd, 0x5b, 0x6d, 0x07, 0xa6, 0x5b, 0x64, 0x10, 0x90, 0x75, 0xd5, 0x86, 0xf9, 0xa6, 0xff, 0xd1, 0xfd, 0x98, 0x63,
-    0x33, 0x23, 0x91, 0x89, 0x4f, 0x30, 0xca, 0xa6, 0x92, 0xae, 0xff, 0xde, 0xd0, 0xe6, 0xe7, 0xe9, 0x90, 0x62, 0x24, 0xeb,
-    0x87, 0x46, 0x05, 0xa3, 0xff, 0x07, 0xc4, 0x7e, 0x47, 0xbd, 0x34, 0x6f, 0x3a, 0xe1, 0xf5, 0x3f, 0x9a, 0x6d, 0xe2, 0xf5,
-    0x84, 0x0a, 0xf8, 0x47, 0xf0, 0x15, 0x26, 0xd8, 0xfa, 0xc8, 0x5a, 0xed, 0x4b, 0x31, 0xdc, 0x2d, 0xc6, 0x84, 0xc7, 0xee,
-    0xcf, 0xaf, 0xf1, 0x92, 0xcb, 0xea, 0xf0, 0xe9, 0xb8, 0x0f, 0x2b, 0x13, 0x72, 0x76, 0x1f, 0xc1, 0x42, 0x34, 0x09, 0x20,
-    0xfe, 0xaf, 0x0a, 0xfa, 0x63, 0x9d, 0xcd, 0x1b, 0x27, 0x0b, 0xcb, 0xd1, 0x4a, 0xf1, 0xa5, 0x38, 0x32, 0x49, 0x6b, 0x6e,
-    0xb6, 0xd5, 0xf3, 0x0e, 0x0c, 0xc4, 0x78, 0xcc, 0xc6, 0x58, 0x0c, 0x40, 0x0f, 0x5c, 0x8b, 0x66, 0x38, 0xd7, 0x14, 0x1f,
-    0x4f, 0xfc, 0xe0, 0x7e, 0x71, 0x5d, 0xc7, 0x79, 0xee, 0x25, 0x79, 0xfd, 0x1f, 0x2e, 0x32, 0x6f, 0xa7, 0x51, 0xff, 0x6d,
-    0x62, 0x34, 0x9b, 0xa0, 0x23, 0xfa, 0x61, 0x32, 0x9e, 0xc2, 0x54, 0x3c, 0x81, 0xe1, 0xb8, 0x0b, 0xed, 0xd1, 0x00, 0x15,
-    0x6c, 0xcf, 0x98, 0xee, 0x93, 0x5f, 0x50, 0xd8, 0xa2, 0x06, 0x6b, 0x7e, 0xff, 0x36, 0x42, 0x5f, 0x8c, 0xc4, 0x2c, 0xcc,
-    0xc7, 0x0b, 0x78, 0x12, 0xfd, 0x71, 0xad, 0x45, 0x46, 0xdb, 0xc4, 0xd1, 0xc5, 0x0b, 0x3e, 0xea, 0x7f, 0xf6, 0x5b, 0x31,
-    0x03, 0x77, 0x61, 0x28, 0xa6, 0x60, 0x2e, 0x9e, 0xc1, 0x08, 0xf4, 0xc2, 0x55, 0xb8, 0xc0, 0xc6, 0x2b, 0x3b, 0x0c, 0xfd,
-    0xaf, 0x29, 0xde, 0xcc, 0x85, 0xf2, 0x90, 0xfe, 0x6f, 0x46, 0x53, 0xd3, 0xdc, 0x6b, 0xa6, 0xb6, 0x0f, 0x80, 0x9e, 0xfe,
-    0xe7, 0x5d, 0x2a, 0xa0, 0x35, 0x1e, 0xc6, 0x7c, 0x3c, 0x8d, 0xbb, 0xd1, 0xc8, 0x51, 0xf9, 0xad, 0xcf, 0x7a, 0x1a, 0x2a,
-    0xa1, 0x39, 0x7a, 0x62, 0x3c, 0x5e, 0xc0, 0x83, 0x68, 0xa6, 0x55, 0x7f, 0xce, 0xce, 0x3b, 0xb1, 0x1a, 0xae, 0xc3, 0x68,
-    0xcc, 0xc1, 0x50, 0xdc, 0x84, 0x8c, 0x9c, 0x0c, 0x11, 0xee, 0x9f, 0x1b, 0xdd, 0xf8, 0xe3, 0x16, 0xb8, 0x1f, 0xe3, 0x30,
-    0x03, 0x2f, 0x62, 0x1e, 0xa6, 0xa0, 0x3f, 0x3a, 0xe3, 0x52, 0x9b, 0x1c, 0x61, 0x56, 0x47, 0xff, 0x67, 0x5c, 0x96, 0x6f,
-    0x92, 0xbb, 0x28, 0x63, 0xaa, 0xf2, 0x71, 0x72, 0x0a, 0xf5, 0xff, 0x6c, 0x71, 0x07, 0x37, 0xa4, 0xfe, 0xfb, 0x84, 0xae,
-    0x56, 0xd4, 0x14, 0x67, 0xff, 0xda, 0x40, 0xa3, 0x4b, 0xdf, 0xf7, 0x59, 0xff, 0xc3, 0x8d, 0xff, 0x77, 0xe6, 0x2a, 0x65,
-    0x95, 0xc0, 0xdc, 0xac, 0xff, 0xd1, 0xf1, 0xa5, 0xb9, 0xd2, 0x7b, 0x2f, 0xea, 0x7f, 0xae, 0xbc, 0xc7, 0x52, 0xf3, 0xdc,
-    0xb8, 0x89, 0x1c, 0x8c, 0xfd, 0xfa, 0xf3, 0x6e, 0xc8, 0xc5, 0x4c, 0x74, 0xcc, 0x36, 0x1e, 0x96, 0xfe, 0x47, 0xf0, 0xa9,
-    0xd1, 0xc7, 0x24, 0xea, 0x7f, 0xc8, 0xef, 0xa1, 0x36, 0xe2, 0x3e, 0xa8, 0x15, 0xc0, 0x7e, 0x4c, 0x50, 0x66, 0x4b, 0x3f,
-    0x7e, 0xf4, 0x3f, 0x1d, 0xef, 0x2a, 0xb3, 0x59, 0xe7, 0x6e, 0xfd, 0x8f, 0xe6, 0x4c, 0x7b, 0xc5, 0x64, 0x5b, 0x6e, 0x4f,
-    0xfd, 0xa7, 0xfe, 0xbb, 0xa6, 0xb8, 0xc8, 0x25, 0xb7, 0xdd, 0xc2, 0x47, 0xb0, 0x3e, 0xef, 0x90, 0x5c, 0x41, 0x0d, 0x11,
-    0xcf, 0xf1, 0x81, 0x47, 0xcf, 0x3f, 0xff, 0xf4, 0xbf, 0x9f, 0xb8, 0x67, 0xf2, 0x51, 0xff, 0x43, 0x7d, 0x0f, 0xdd, 0x2b,
-    0x66, 0x7e, 0x83, 0xa8, 0x37, 0x7d, 0xa7, 0x78, 0x3f, 0x95, 0x3a, 0x8e, 0xf5, 0xbf, 0xb7, 0x43, 0xf5, 0xec, 0xdc, 0xae,
-    0xff, 0x51, 0xef, 0xab, 0x79, 0x26, 0xbf, 0x92, 0x46, 0xd4, 0x7f, 0xea, 0xbf, 0x6b, 0x1e, 0x33, 0x79, 0x39, 0x8e, 0x40,
-    0x4b, 0x9c, 0x8e, 0x2a, 0x68, 0x8e, 0xdb, 0xf1, 0xe8, 0x51, 0x7f, 0xb3, 0x53, 0x79, 0x8f, 0xe4, 0x02, 0x16, 0x98, 0xbc,
-    0x39, 0x57, 0x69, 0x73, 0x5f, 0x20, 0xfa, 0x5f, 0x55, 0x78, 0x9b, 0xb4, 0xa0, 0xfe, 0x87, 0xf8, 0x1e, 0x2a, 0x28, 0xbc,
-    0x2f, 0x3f, 0x0f, 0x64, 0x3f, 0x9a, 0xfa, 0x96, 0xff, 0x37, 0xb5, 0xef, 0xe6, 0xfa, 0x96, 0xd9, 0xbf, 0x22, 0x39, 0xdf,
-    0xce, 0xf7, 0x88, 0x88, 0x84, 0x6d, 0x96, 0xe3, 0x9c, 0xdc, 0xaf, 0xff, 0x51, 0x0f, 0xc6, 0x05, 0xa6, 0x0c, 0x77, 0xb5,
-    0xa8, 0xff, 0xd4, 0x7f, 0x97, 0x54, 0x72, 0xc8, 0x58, 0x70, 0x3d, 0xef, 0x91, 0x5c, 0xe0, 0xd7, 0xe2, 0xf5, 0x37, 0x33,
-    0x10, 0xfd, 0x97, 0xef, 0xbd, 0x67, 0xa8, 0xff, 0x21, 0xbe, 0x87, 0x64, 0x65, 0xfb, 0xe7, 0x03, 0xd9, 0x8f, 0xb2, 0xc2,
-    0xbb, 0xfc, 0x0f, 0xdb, 0xbc, 0xa2, 0xb9, 0x5f, 0xff, 0xa3, 0xd6, 0xf1, 0x8d, 0x98, 0x80, 0x76, 0xa8, 0x8f, 0x0a, 0x39,
-    0x56, 0xaa, 0x34, 0x94, 0xc7, 0x85, 0xe8, 0x15, 0x97, 0x1d, 0xf1, 0xea, 0x24, 0xb6, 0x9d, 0x5a, 0xfd, 0x8f, 0x8e, 0x07,
-    0x17, 0x9b, 0xf2, 0x3c, 0x96, 0xd2, 0xd4, 0xff, 0xff, 0xf2, 0x89, 0xa3, 0xfe, 0x5b, 0x58, 0x00, 0x12, 0x7f, 0x13, 0x79,
-    0x8f, 0xa4, 0x9c, 0x2a, 0xb9, 0x4e, 0xff, 0xef, 0x16, 0xd5, 0xb0, 0x0b, 0x51, 0xff, 0x43, 0x7a, 0x0f, 0x95, 0x12, 0x31,
-    0x45, 0x07, 0x14, 0xdf, 0xb7, 0xc9, 0xf1, 0xb8, 0xa9, 0x76, 0x40, 0x5e, 0xd5, 0xff, 0x4d, 0x71, 0xb1, 0x57, 0xdb, 0xb1,
-    0xc9, 0xa8, 0x2c, 0x2a, 0x7f, 0x2f, 0x27, 0xb5, 0xed, 0x54, 0xeb, 0x7f, 0x34, 0xeb, 0xf9, 0x87, 0xe2, 0x68, 0xde, 0x50,
-    0xd6, 0x1e, 0x19, 0x2e, 0x62, 0xb3, 0xf9, 0xc4, 0x51, 0xff, 0x8f, 0xd1, 0x45, 0x91, 0x27, 0xe4, 0x23, 0xde, 0x23, 0xd4,
-    0x7f, 0x8b, 0x68, 0x93, 0x58, 0x9e, 0x98, 0x6b, 0xa8, 0xff, 0xa1, 0xbc, 0x87, 0x4e, 0x35, 0x65, 0xc8, 0x7a, 0x24, 0xb0,
-    0x3d, 0x29, 0x26, 0x62, 0x00, 0x33, 0xf1, 0x90, 0x8d, 0xa2, 0xe4, 0x6e, 0xfd, 0x2f, 0xab, 0xf9, 0x7c, 0xfc, 0xcf, 0x36,
-    0x4e, 0x39, 0xaf, 0xe8, 0x7f, 0xd4, 0x82, 0xbb, 0x4d, 0x33, 0xa3, 0x69, 0x17, 0x91, 0x3f, 0xa4, 0x38, 0x9f, 0x39, 0xea,
-    0xbf, 0x88, 0xe9, 0x5a, 0x67, 0xca, 0x9d, 0x7b, 0xcc, 0xbb, 0x6b, 0x9c, 0x6d, 0x8d, 0x11, 0x72, 0x22, 0xeb, 0x7f, 0x44,
-    0xe4, 0xb8, 0x9a, 0x47, 0xfd, 0x0f, 0xe1, 0x3d, 0x74, 0x8d, 0xa9, 0xba, 0xd5, 0x77, 0xda, 0x59, 0xb5, 0xbc, 0xd0, 0xd6,
-    0x74, 0x0f, 0xad, 0x46, 0x95, 0x3c, 0xa7, 0xff, 0xad, 0x35, 0x9e, 0x8d, 0xef, 0x71, 0xab, 0xc2, 0x7b, 0x35, 0xef, 0xe8,
-    0x7f, 0x04, 0x17, 0x0b, 0xcb, 0xc6, 0x11, 0x45, 0xe5, 0x94, 0xc6, 0xa1, 0x8c, 0x1f, 0xa9, 0xff, 0x79, 0x4f, 0xff, 0xb3,
-    0x73, 0x7f, 0x9d, 0x8b, 0x6b, 0xd1, 0x1f, 0xd3, 0xf1, 0x08, 0x6e, 0xc3, 0xa5, 0xa8, 0xee, 0xda, 0xb7, 0x9b, 0xe4, 0x7e,
-    0xfc, 0xd2, 0xff, 0x5b, 0x85, 0xe7, 0xf1, 0xc9, 0xd4, 0x7f, 0x1f, 0xdf, 0x43, 0xfb, 0x31, 0x14, 0x6d, 0x50, 0x13, 0x15,
-    0x71, 0x32, 0xf2, 0xa3, 0x1a, 0xda, 0x63, 0x88, 0xc8, 0x6b, 0x9d, 0xfd, 0x6b, 0x1d, 0xf0, 0xde, 0xcc, 0x37, 0x6d, 0xed,
-    0x37, 0xcc, 0x46, 0x6f, 0x34, 0x45, 0x29, 0x14, 0x42, 0x19, 0x54, 0xc5, 0x79, 0xb8, 0x55, 0x5c, 0xc7, 0xdc, 0xa8, 0xff,
-    0x15, 0xd1, 0x1b, 0x0b, 0x15, 0xf9, 0x5c, 0x7f, 0x42, 0x2f, 0x8b, 0x6a, 0xe8, 0x79, 0x55, 0xff, 0x65, 0x75, 0x52, 0x60,
-    0xb7, 0x6d, 0x5d, 0xb0, 0x53, 0x4c, 0x99, 0xe1, 0x5e, 0xc0, 0x85, 0x9e, 0xf3, 0xac, 0x52, 0xff, 0x8f, 0x3f, 0xfd, 0x27,
-    0xd4, 0x7f, 0x7d, 0x4a, 0x88, 0x8a, 0xcd, 0x5d, 0xa8, 0xff, 0x3e, 0xbe, 0x87, 0x9c, 0x7f, 0x93, 0x02, 0xdf, 0x9b, 0x8a,
-    0xf8, 0x2a, 0xa9, 0x3a, 0x66, 0xb9, 0xe3, 0xdd, 0x9c, 0x8e, 0x7a, 0xb8, 0x1e, 0x77, 0x63, 0x38, 0xa6, 0x63, 0x01, 0x5e,
-    0xc7, 0x24, 0xdc, 0x8f, 0x0e, 0x38, 0x5f, 0x2b, 0x37, 0x69, 0xde, 0xd2, 0x7f, 0x73, 0xf5, 0xe9, 0xe5, 0xb6, 0xdb, 0x78,
-    0x2d, 0xa1, 0x56, 0x5e, 0xb5, 0x13, 0xfc, 0xb9, 0x6b, 0x8a, 0x09, 0x39, 0x0c, 0x09, 0x29, 0x92, 0x7b, 0x82, 0x41, 0x11,
-    0xbe, 0xf7, 0x48, 0x1e, 0xd5, 0x7f, 0x19, 0x93, 0xb8, 0x82, 0xfa, 0x1f, 0x9a, 0xfe, 0xff, 0x88, 0x56, 0xa1, 0xec, 0x4f,
-    0x61, 0x8c, 0xb6, 0xac, 0xa4, 0x9a, 0x97, 0xf4, 0x3f, 0xf8, 0x6d, 0xfb, 0xa9, 0xff, 0xb1, 0xfc, 0xde, 0x1b, 0x3d, 0xf4,
-    0x55, 0xd2, 0x54, 0x89, 0xc5, 0x6e, 0x44, 0x5e, 0x39, 0xce, 0xd3, 0xeb, 0x40, 0x20, 0x39, 0x24, 0x08, 0x21, 0xc7, 0xbb,
-    0xfe, 0x5f, 0xa7, 0x51, 0x6b, 0x91, 0xfa, 0xef, 0xa7, 0xfe, 0x67, 0x61, 0x66, 0x12, 0x99, 0x9f, 0xdd, 0x73, 0x81, 0xa8,
-    0x38, 0x45, 0xfd, 0x77, 0xaf, 0xff, 0xee, 0x18, 0x63, 0xf4, 0xb5, 0xca, 0xd3, 0xfe, 0x5c, 0x26, 0xb2, 0x72, 0xec, 0xb1,
-    0xad, 0x6c, 0xda, 0x49, 0xe4, 0x11, 0x07, 0xd6, 0xf3, 0xc9, 0x23, 0x84, 0xfa, 0xef, 0xc9, 0x5f, 0x24, 0x56, 0xed, 0xfe,
-    0x6e, 0xea, 0x7f, 0x92, 0x94, 0xc3, 0xcd, 0x98, 0x84, 0xb5, 0x36, 0xd9, 0x38, 0x32, 0xf1, 0x1d, 0x16, 0xe1, 0xb2, 0xd0,
-    0xf7, 0xaa, 0x20, 0x06, 0x60, 0xb5, 0xed, 0x3c, 0xfa, 0x6e, 0xbc, 0x81, 0x41, 0x68, 0xa1, 0x8c, 0x39, 0xa3, 0xfe, 0xeb,
-    0xf2, 0xa2, 0xd1, 0xd7, 0x2c, 0x8f, 0xfb, 0x23, 0x73, 0x84, 0xdb, 0x57, 0x2a, 0x2d, 0x8d, 0xf1, 0x86, 0xbf, 0xe0, 0xcb,
-    0x7c, 0xf2, 0x08, 0xa1, 0xfe, 0x7b, 0xe2, 0x79, 0xa3, 0xaf, 0x77, 0xa9, 0xff, 0xbe, 0xd9, 0xdd, 0xeb, 0xa3, 0x25, 0x6e,
-    0x46, 0x6f, 0x0c, 0xc7, 0x54, 0xcc, 0xc5, 0x44, 0xdc, 0x8e, 0x06, 0x9a, 0xb5, 0xcc, 0x82, 0xf4, 0x07, 0xb8, 0x02, 0x0f,
-    0xe2, 0x39, 0x3c, 0x8f, 0x71, 0x18, 0x80, 0xee, 0xb8, 0x06, 0x4d, 0x70, 0x46, 0x52, 0x79, 0xa8, 0x49, 0x3c, 0x9f, 0x85,
-    0x58, 0x89, 0xa5, 0x10, 0x6a, 0xa1, 0x2d, 0xfa, 0x86, 0x34, 0x97, 0x44, 0x08, 0x39, 0xfe, 0xf4, 0xbf, 0xb5, 0xb0, 0x4c,
-    0x9f, 0x4e, 0xfd, 0x27, 0xc4, 0x33, 0x17, 0x8b, 0x6f, 0xf7, 0x1b, 0x79, 0x3e, 0x08, 0x21, 0xb9, 0x5c, 0xff, 0x0b, 0x60,
-    0x97, 0xeb, 0x6f, 0x16, 0xea, 0x3f, 0x21, 0xf1, 0x14, 0x15, 0xb9, 0x9d, 0x8e, 0xe0, 0x4c, 0x9e, 0x11, 0x42, 0x48, 0x2e,
-    0xd7, 0xff, 0x08, 0xa6, 0xb9, 0xf6, 0x24, 0xa2, 0xfe, 0x13, 0x92, 0x1d, 0x41, 0x5b, 0xe3, 0xe8, 0x0c, 0x4a, 0x69, 0x34,
-    0xc7, 0x27, 0xe2, 0xeb, 0xff, 0x29, 0x9e, 0x1b, 0x42, 0x48, 0x1e, 0xd0, 0xff, 0x26, 0xe2, 0xbd, 0x55, 0x9b, 0xfa, 0x4f,
-    0x88, 0x36, 0x1d, 0x8e, 0xc6, 0xdf, 0xc5, 0xfb, 0x56, 0xee, 0x67, 0xc5, 0x55, 0x42, 0x48, 0x9e, 0xd0, 0xff, 0x74, 0x11,
-    0x75, 0x3c, 0x8a, 0xfa, 0x4f, 0x88, 0x36, 0x03, 0x2d, 0x63, 0x2a, 0x06, 0xf3, 0xcc, 0x10, 0x42, 0x02, 0xd7, 0xff, 0x0f,
-    0x30, 0xcb, 0x44, 0x86, 0xa7, 0xfe, 0x9e, 0x10, 0xd5, 0x47, 0xd3, 0x2c, 0xb3, 0x04, 0x98, 0xb7, 0xb2, 0x89, 0xfa, 0x4f,
-    0x08, 0x22, 0x98, 0x93, 0xa0, 0xfd, 0xfb, 0x70, 0x4f, 0x60, 0xb1, 0x94, 0x84, 0x10, 0x32, 0xd2, 0x36, 0x8b, 0xcb, 0xb5,
-    0x9e, 0xfa, 0xcb, 0x10, 0x3d, 0x5c, 0xa4, 0x1c, 0x1f, 0xc4, 0xff, 0xa8, 0xff, 0xe4, 0x44, 0x66, 0x5d, 0xdc, 0xf3, 0xb0,
-    0x02, 0x55, 0x79, 0x56, 0x08, 0x21, 0x79, 0x48, 0xff, 0x23, 0xf8, 0xda, 0xe8, 0x61, 0x32, 0xf5, 0x9f, 0x10, 0x4d, 0x6a,
-    0xe0, 0x0e, 0x8c, 0xc7, 0x8b, 0x18, 0x87, 0xee, 0x68, 0x82, 0x72, 0x3c, 0x23, 0x84, 0x90, 0x3c, 0xa7, 0xff, 0x43, 0x8d,
-    0x1e, 0x76, 0x58, 0x54, 0x8c, 0xa4, 0xfe, 0x13, 0x42, 0x08, 0x21, 0xa9, 0xa7, 0x8d, 0xa8, 0x3f, 0x65, 0xa6, 0x9e, 0xc7,
-    0x1e, 0xab, 0x89, 0x3e, 0x12, 0x2b, 0x8f, 0x5e, 0x65, 0xbb, 0xbd, 0xda, 0xbc, 0x1a, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
-    0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
-    0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
-    0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84,
-    0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x42, 0x94, 0xe4, 0xc3,
-    0x2b, 0x58, 0x94, 0xc3, 0x60, 0x65, 0xcb, 0xb3, 0x8c, 0x76, 0x8b, 0x50, 0x27, 0x61, 0x69, 0x45, 0xb1, 0xd4, 0x89, 0xba,
-    0x9a, 0xfb, 0x56, 0x0a, 0xe7, 0xe3, 0x3a, 0xf4, 0xc3, 0x74, 0xdc, 0x96, 0xb0, 0xac, 0x33, 0x96, 0xe6, 0xd0, 0x3e, 0x61,
-    0x59, 0x57, 0xcc, 0x40, 0x3f, 0x5c, 0x87, 0x0c, 0x94, 0x70, 0x7d, 0x3e, 0xaa, 0xa1, 0x1b, 0x9e, 0xc3, 0x2a, 0x8c, 0xc6,
-    0xd5, 0x28, 0x63, 0xd3, 0x26, 0x3f, 0xae, 0x40, 0x11, 0xde, 0x3b, 0x84, 0x10, 0x42, 0xf2, 0x34, 0x8b, 0x71, 0xec, 0xb7,
-    0x07, 0xf9, 0x14, 0xed, 0xfa, 0x18, 0xed, 0xfe, 0x46, 0xb1, 0x84, 0xa5, 0x67, 0x1a, 0x4b, 0x9d, 0x7f, 0x97, 0x69, 0xec,
-    0x55, 0x55, 0xbc, 0x82, 0x2c, 0x63, 0x8d, 0x71, 0x09, 0xcb, 0x47, 0x1a, 0xcb, 0xee, 0x4f, 0x58, 0xf6, 0x84, 0xb1, 0x2c,
-    0x0b, 0x73, 0x50, 0x59, 0xfb, 0x4c, 0x14, 0xc6, 0x6b, 0xa6, 0xfd, 0xfc, 0x03, 0x23, 0x2d, 0x47, 0x10, 0x2d, 0x01, 0xfc,
-    0x85, 0x15, 0xb8, 0x8a, 0x77, 0x0f, 0x21, 0x84, 0x90, 0x3c, 0x4b, 0x67, 0xa1, 0x78, 0x17, 0x2a, 0xda, 0x2d, 0x34, 0x5a,
-    0xad, 0xb4, 0x58, 0xea, 0xa7, 0xfe, 0x17, 0xc5, 0x28, 0xfc, 0x6d, 0x5a, 0xc3, 0xab, 0xfe, 0xe3, 0xa8, 0x52, 0x8f, 0xb2,
-    0x18, 0xaf, 0x24, 0x52, 0x12, 0xff, 0xb6, 0xd8, 0xd7, 0x3d, 0xe8, 0x9d, 0x30, 0x2a, 0x3a, 0x36, 0x4a, 0xe8, 0xcd, 0xbb,
-    0x87, 0x10, 0x42, 0x48, 0x9e, 0xa5, 0x24, 0x0e, 0x1a, 0x6a, 0x37, 0xd0, 0xb6, 0x55, 0x3a, 0x7e, 0x51, 0x28, 0xae, 0xbf,
-    0xfa, 0x3f, 0x36, 0x61, 0x8d, 0x64, 0xf4, 0x3f, 0xfa, 0x9b, 0xe0, 0xca, 0x0e, 0x12, 0xff, 0xfb, 0xc8, 0x34, 0x2e, 0x6a,
-    0x6a, 0xd8, 0x25, 0xce, 0xe0, 0xdd, 0x43, 0x08, 0x21, 0x24, 0x0f, 0xf3, 0x86, 0xa1, 0x74, 0xef, 0xd8, 0xb6, 0xa9, 0x2b,
-    0xf4, 0xf0, 0x1c, 0x8b, 0xe5, 0xa7, 0x61, 0x8d, 0x82, 0xad, 0x62, 0xed, 0xdf, 0x50, 0x55, 0xb9, 0x37, 0xb5, 0x70, 0x48,
-    0xb4, 0xde, 0x82, 0x45, 0x98, 0x82, 0xcb, 0x5d, 0xe9, 0x7f, 0x0b, 0x4c, 0xc1, 0x22, 0x6c, 0x11, 0xbd, 0x1c, 0xb2, 0xdc,
-    0x67, 0xc9, 0x45, 0xa2, 0xf5, 0x8f, 0xd8, 0x15, 0x37, 0x02, 0x38, 0x82, 0x65, 0xb8, 0x07, 0x35, 0x50, 0x02, 0x37, 0x62,
-    0x6f, 0xce, 0xdf, 0x56, 0xf3, 0xce, 0x21, 0x84, 0x10, 0x92, 0xa7, 0xe9, 0x6a, 0xe8, 0xdc, 0x01, 0x14, 0x75, 0x9c, 0xfd,
-    0xdf, 0xec, 0xba, 0xff, 0xea, 0xd8, 0x63, 0xac, 0x7d, 0x10, 0x97, 0x3a, 0xb4, 0x5e, 0x61, 0xb4, 0xdd, 0x85, 0xce, 0xc8,
-    0x6f, 0xd3, 0x6a, 0xa4, 0xd2, 0x1a, 0x11, 0xa5, 0x00, 0xba, 0xe1, 0x57, 0xe5, 0x9c, 0x85, 0xe4, 0xed, 0x9c, 0x76, 0xbb,
-    0xd1, 0x04, 0x69, 0xc8, 0x87, 0xc6, 0x78, 0x0c, 0xbb, 0x13, 0x2c, 0x01, 0x99, 0xe2, 0xdf, 0x8d, 0x79, 0xe7, 0x10, 0x42,
-    0x08, 0xc9, 0xd3, 0x94, 0x12, 0x5f, 0xdc, 0x1d, 0x1c, 0x67, 0xff, 0x67, 0xb8, 0xec, 0xbd, 0x38, 0xbe, 0x10, 0xaa, 0xd9,
-    0xd5, 0xd1, 0x07, 0x2f, 0xe6, 0xf5, 0xd7, 0x59, 0xd1, 0xce, 0x59, 0xff, 0xa3, 0xdc, 0x2e, 0x3c, 0x01, 0x8b, 0x2a, 0xda,
-    0x9d, 0x9a, 0xb3, 0xd5, 0x2c, 0x34, 0x12, 0x7f, 0x2d, 0x8d, 0x69, 0x38, 0x62, 0x33, 0x27, 0xf0, 0x3a, 0xef, 0x1b, 0x42,
-    0x08, 0x21, 0x79, 0x9e, 0xd8, 0x37, 0xf7, 0x4b, 0x8e, 0xb3, 0xff, 0xed, 0x5d, 0xf5, 0x9c, 0x26, 0x46, 0x0e, 0xc0, 0x08,
-    0xc7, 0xf6, 0x35, 0x8d, 0xb6, 0x1b, 0x91, 0x96, 0xb4, 0xfe, 0xa7, 0x61, 0xa3, 0xd1, 0xee, 0x6c, 0x45, 0xbb, 0xee, 0xb6,
-    0xaa, 0x9e, 0x81, 0xd5, 0x96, 0xea, 0x5f, 0x94, 0x77, 0x0d, 0x21, 0x84, 0x90, 0x3c, 0x4f, 0xec, 0x3b, 0x79, 0x2f, 0x0a,
-    0x29, 0x67, 0xff, 0x0f, 0xe1, 0x64, 0x57, 0x3d, 0x0f, 0x15, 0xaa, 0xb9, 0x40, 0xa9, 0xe8, 0xb1, 0xd8, 0xba, 0xec, 0xdf,
-    0x52, 0x65, 0x3b, 0x3d, 0xfd, 0x8f, 0x60, 0x89, 0xd1, 0xae, 0x95, 0xd2, 0xe7, 0x60, 0x08, 0xde, 0xc7, 0x11, 0x5c, 0x69,
-    0xb9, 0xb4, 0x2d, 0x3e, 0x33, 0xc5, 0x13, 0x4c, 0x50, 0xc6, 0x49, 0x12, 0x42, 0x08, 0x21, 0x79, 0x85, 0x32, 0x38, 0x6c,
-    0xe8, 0x5b, 0x3b, 0xe5, 0xec, 0xbf, 0x3b, 0xaf, 0xb7, 0x76, 0xc2, 0x9a, 0xff, 0x15, 0x8a, 0x6b, 0xac, 0xd1, 0xdd, 0x68,
-    0x3f, 0xd5, 0x17, 0xfd, 0x9f, 0x6c, 0xb4, 0xeb, 0xe9, 0xb8, 0xed, 0xd2, 0x28, 0x60, 0xbb, 0xac, 0x12, 0xae, 0xc1, 0x68,
-    0x3c, 0x84, 0x8b, 0x51, 0x90, 0xf7, 0x0b, 0x21, 0x84, 0x90, 0xe3, 0x86, 0x95, 0x86, 0x4e, 0x3e, 0xa7, 0x9c, 0xfd, 0xff,
-    0x87, 0x8b, 0x3e, 0x4f, 0x17, 0x7e, 0x7f, 0xbf, 0xe3, 0x2c, 0xad, 0x75, 0xfa, 0x19, 0x6b, 0x0c, 0xf7, 0x45, 0xff, 0x87,
-    0x18, 0xed, 0x06, 0xf0, 0x2a, 0x13, 0x42, 0x08, 0x21, 0x71, 0xf4, 0x30, 0x74, 0xf2, 0xd7, 0x84, 0x2f, 0x5c, 0x39, 0xfb,
-    0x5f, 0x4f, 0xbb, 0xc7, 0x82, 0x58, 0x2b, 0xfc, 0xe6, 0xdb, 0x69, 0xae, 0x15, 0xd3, 0xff, 0x61, 0xbe, 0xe8, 0xff, 0x60,
-    0xea, 0x3f, 0x21, 0x84, 0x10, 0x62, 0x4b, 0x39, 0x31, 0x03, 0x10, 0x9f, 0xd7, 0xf6, 0x3c, 0x63, 0xc9, 0x56, 0x8d, 0x19,
-    0xfc, 0x63, 0x4c, 0x12, 0x73, 0xe6, 0xc3, 0xb4, 0xd7, 0xa2, 0xfe, 0x13, 0x42, 0x08, 0x21, 0x61, 0xb2, 0x4a, 0xf8, 0xe9,
-    0x99, 0x97, 0x0c, 0x33, 0x96, 0x3c, 0xa3, 0xdd, 0xdb, 0x75, 0x42, 0xfd, 0x97, 0x23, 0x9d, 0xfa, 0x4f, 0x08, 0x21, 0x84,
-    0xe4, 0x4a, 0x7a, 0x8a, 0x1c, 0x3d, 0xe6, 0xca, 0x77, 0xeb, 0x8d, 0x25, 0x37, 0x68, 0xf6, 0x55, 0x03, 0xbf, 0x0b, 0x9b,
-    0x41, 0x39, 0x17, 0x7b, 0x41, 0xfd, 0x27, 0x84, 0x10, 0x42, 0xc2, 0xa4, 0xbc, 0xc8, 0x75, 0x73, 0x8f, 0xf8, 0x7b, 0x75,
-    0x91, 0x05, 0xb7, 0x94, 0x56, 0x4f, 0xf9, 0xc5, 0xcc, 0xff, 0x11, 0x34, 0x73, 0xb5, 0x17, 0xd4, 0x7f, 0x42, 0x08, 0x21,
-    0x24, 0x5c, 0xe6, 0x1b, 0x5a, 0xb9, 0x4e, 0xfc, 0xf5, 0x41, 0xe3, 0xaf, 0xff, 0xd6, 0xec, 0x67, 0x98, 0xa7, 0x99, 0x7f,
-    0xea, 0x3f, 0x21, 0x84, 0x10, 0x92, 0x0a, 0x2e, 0x10, 0xba, 0x5d, 0xc7, 0xf8, 0xeb, 0x7b, 0xc6, 0xdf, 0xee, 0xd0, 0xea,
-    0xa5, 0x81, 0xf0, 0x24, 0x5c, 0xed, 0x3a, 0x53, 0x0e, 0xf5, 0x9f, 0x10, 0x42, 0x08, 0x09, 0x9b, 0x7f, 0x26, 0x54, 0xcc,
-    0x3d, 0xd5, 0xa8, 0x79, 0xf3, 0xa7, 0x56, 0xe6, 0xbf, 0x62, 0xf8, 0x46, 0xd4, 0xef, 0xa9, 0xe4, 0x7a, 0x0f, 0xa8, 0xff,
-    0x84, 0x10, 0x42, 0x48, 0xd8, 0x5c, 0x2e, 0xf2, 0xf5, 0x14, 0x8f, 0xf3, 0x0a, 0x7c, 0x51, 0xab, 0x87, 0x69, 0xc2, 0x86,
-    0xd0, 0xce, 0xc3, 0x1e, 0xc4, 0xf4, 0xff, 0x21, 0x5f, 0xf4, 0xff, 0x7e, 0xea, 0x3f, 0x21, 0x84, 0x10, 0xe2, 0x40, 0x1a,
-    0x3e, 0x31, 0xf4, 0xb2, 0xf7, 0xd1, 0xbf, 0xbc, 0x65, 0xfc, 0xbf, 0x85, 0xc6, 0xfa, 0xad, 0x45, 0xbe, 0xdf, 0x97, 0x3c,
-    0xed, 0x41, 0xcc, 0x77, 0xa0, 0x9b, 0x2f, 0xfa, 0xdf, 0x55, 0x33, 0x9f, 0x20, 0x21, 0x84, 0x10, 0x72, 0x22, 0x73, 0x93,
-    0xa8, 0xbf, 0x97, 0x8e, 0x92, 0x46, 0x65, 0xe0, 0x2d, 0x1a, 0x31, 0xfc, 0xc5, 0xb0, 0xc5, 0x58, 0x7b, 0xb7, 0xab, 0xa8,
-    0xbf, 0x18, 0xaf, 0x68, 0x5a, 0x0f, 0x74, 0xf5, 0xbf, 0x9d, 0xd1, 0xee, 0x05, 0x5e, 0x5d, 0x42, 0x08, 0x21, 0xc4, 0x36,
-    0x76, 0x6f, 0x93, 0xa1, 0x98, 0x6d, 0x71, 0x8b, 0x8b, 0xca, 0xbd, 0x11, 0x8c, 0x11, 0xb6, 0xff, 0x4e, 0x9e, 0xb6, 0x5e,
-    0x00, 0x9b, 0xb5, 0xea, 0xf5, 0xea, 0xeb, 0x7f, 0x6d, 0xa3, 0xdd, 0x06, 0x17, 0x59, 0x88, 0x08, 0x21, 0x84, 0x90, 0x13,
-    0x8d, 0xbb, 0x0c, 0xc5, 0x5c, 0x89, 0x05, 0x39, 0xff, 0xca, 0x42, 0x0d, 0xc7, 0xf5, 0xce, 0x31, 0x6c, 0x05, 0xc0, 0xb2,
-    0xa4, 0xb7, 0xfd, 0xad, 0x43, 0x4b, 0x5d, 0xfd, 0x8f, 0x08, 0x9b, 0x44, 0x17, 0x5e, 0x5d, 0x42, 0x08, 0x21, 0xc4, 0x86,
-    0x22, 0xd8, 0x69, 0xa8, 0xfe, 0x81, 0x9c, 0x7f, 0xad, 0xd1, 0xf0, 0x1c, 0x58, 0x6d, 0xe8, 0xec, 0x3e, 0x54, 0xf1, 0xb4,
-    0xe5, 0x2b, 0xf0, 0x9b, 0xd1, 0xc7, 0xa3, 0xbe, 0xe9, 0xff, 0x24, 0x31, 0x27, 0xd1, 0x82, 0xd7, 0x97, 0x10, 0x42, 0x08,
-    0xb1, 0x61, 0x90, 0xb0, 0xe3, 0x67, 0xff, 0x6e, 0x77, 0x5c, 0xe7, 0x16, 0xd1, 0x7a, 0x0d, 0x1e, 0x54, 0x72, 0x6d, 0xc2,
-    0xda, 0x35, 0xd0, 0x19, 0x33, 0x8d, 0x48, 0x43, 0xe0, 0x5d, 0x14, 0xf6, 0x4d, 0xff, 0x8b, 0xe1, 0x43, 0x91, 0x8d, 0x70,
-    0x16, 0x3a, 0xe3, 0x4c, 0x5e, 0x63, 0x42, 0x08, 0x21, 0x24, 0x81, 0xd2, 0xd8, 0x6f, 0x52, 0x7f, 0x9d, 0xc8, 0xff, 0xcd,
-    0x09, 0x63, 0x06, 0xfb, 0xdf, 0x9b, 0x09, 0x6b, 0xaf, 0x30, 0x2d, 0xff, 0x06, 0x65, 0x1d, 0xb7, 0xa7, 0xaf, 0xff, 0x11,
-    0x9c, 0x82, 0x6f, 0x4d, 0xfd, 0xaf, 0xe4, 0x35, 0x26, 0x84, 0x10, 0x42, 0x2c, 0x18, 0x6f, 0xd2, 0xcb, 0x39, 0x1a, 0x6b,
-    0xec, 0xf5, 0x4d, 0xff, 0x77, 0xa3, 0xba, 0xc6, 0xf6, 0xdc, 0xe8, 0x7f, 0xb4, 0x86, 0xc1, 0x2e, 0xea, 0x3f, 0x21, 0x84,
-    0x10, 0xe2, 0x40, 0x65, 0xe1, 0xcb, 0x07, 0x5c, 0x16, 0xaa, 0xfe, 0xff, 0x89, 0x86, 0xbe, 0xeb, 0x7f, 0x43, 0xfc, 0x49,
-    0xfd, 0x27, 0x84, 0x10, 0x42, 0x1c, 0x79, 0xce, 0x50, 0xcb, 0xcd, 0x5a, 0x71, 0x73, 0x7b, 0x7d, 0xb4, 0xff, 0xef, 0xd4,
-    0xb0, 0x00, 0xb8, 0xd1, 0xff, 0x9a, 0xd8, 0x6d, 0xea, 0xff, 0x2d, 0x5e, 0x5f, 0x42, 0x08, 0x21, 0xc4, 0x92, 0x9b, 0x0d,
-    0xb5, 0x7c, 0x24, 0x84, 0xad, 0x9d, 0x84, 0x66, 0x78, 0xc4, 0x88, 0x36, 0x88, 0x7a, 0x00, 0x94, 0xf1, 0x4d, 0xff, 0x2b,
-    0x88, 0x8c, 0x06, 0x07, 0x30, 0x02, 0xcd, 0x71, 0x12, 0xaf, 0x2f, 0x21, 0x84, 0x10, 0x62, 0x41, 0x3a, 0x3e, 0xcb, 0x51,
-    0xcc, 0xfd, 0x28, 0x1f, 0xda, 0x56, 0x1b, 0x60, 0x87, 0xa1, 0xd4, 0xd3, 0x7c, 0xd3, 0xff, 0x98, 0x25, 0xe3, 0x27, 0x9c,
-    0xcf, 0x6b, 0x4b, 0x08, 0x21, 0x84, 0xd8, 0x72, 0x9b, 0xe7, 0xfa, 0xfd, 0xc9, 0xd1, 0xc5, 0xd8, 0xee, 0x56, 0xa4, 0xf9,
-    0xa2, 0xff, 0xe9, 0x46, 0x36, 0x03, 0xa0, 0x03, 0xaf, 0x2c, 0x21, 0x84, 0x10, 0x62, 0x4b, 0x2d, 0xfc, 0x62, 0xcc, 0xc4,
-    0x17, 0x0f, 0xd9, 0xee, 0xb0, 0xd1, 0x50, 0xeb, 0x0c, 0x5f, 0xf4, 0xff, 0x7c, 0xa3, 0xdd, 0x7a, 0x87, 0x11, 0x05, 0x21,
-    0x84, 0x10, 0x72, 0x22, 0x53, 0x49, 0xc4, 0xf2, 0xdf, 0x13, 0xfa, 0xd6, 0xe7, 0x18, 0xdb, 0x6e, 0xef, 0x8b, 0xfe, 0xb7,
-    0x37, 0xda, 0x3d, 0xcb, 0x6b, 0x4b, 0x08, 0x21, 0x84, 0x18, 0x5c, 0x89, 0x42, 0xc6, 0xbf, 0x4b, 0x63, 0x18, 0x7e, 0x35,
-    0x14, 0xf3, 0x43, 0x14, 0x0c, 0x7d, 0x6f, 0x62, 0xb9, 0x07, 0xef, 0xf0, 0x45, 0xff, 0x63, 0x33, 0x19, 0x43, 0x78, 0xad,
-    0x09, 0x21, 0x84, 0x9c, 0xe8, 0xfc, 0x3f, 0x7b, 0xf7, 0xef, 0x52, 0x55, 0x18, 0xc7, 0x71, 0x9c, 0x4a, 0xa1, 0xd1, 0x68,
-    0x29, 0x88, 0xa0, 0xe8, 0x7f, 0xc8, 0xb1, 0xa0, 0x49, 0xa2, 0xa5, 0xc1, 0xa8, 0x86, 0xa0, 0x39, 0x1c, 0xa2, 0x13, 0x05,
-    0x0a, 0x0e, 0x4d, 0x51, 0x0d, 0x41, 0x34, 0x36, 0x04, 0x41, 0x5b, 0x8b, 0xf7, 0x0f, 0xa8, 0xcd, 0xc5, 0xa9, 0xa9, 0xc5,
-    0xd6, 0x28, 0x10, 0x34, 0x17, 0xe5, 0xe3, 0x22, 0x8f, 0x07, 0x8e, 0xe2, 0x8f, 0x7b, 0xf4, 0x9e, 0xab, 0x2f, 0x5e, 0xe3,
-    0x79, 0x2e, 0xf7, 0xf0, 0x3d, 0xc3, 0x7b, 0x79, 0xce, 0x79, 0x8a, 0xab, 0x49, 0x96, 0x32, 0x9f, 0x6f, 0xf9, 0x9e, 0xdf,
-    0x59, 0xab, 0xbd, 0x25, 0xf7, 0xeb, 0x08, 0x77, 0xfe, 0x6d, 0xa9, 0xca, 0xff, 0x3f, 0x6f, 0xa5, 0xff, 0xcf, 0xca, 0xba,
-    0x17, 0x9e, 0x36, 0x00, 0x6c, 0x7a, 0xb8, 0xc3, 0x3b, 0xfa, 0x7f, 0x06, 0xf4, 0x95, 0xfc, 0x6a, 0x8f, 0x3b, 0x0f, 0xf7,
-    0xda, 0xff, 0x69, 0xfd, 0x07, 0x80, 0x86, 0x0f, 0xdb, 0xd6, 0x7f, 0x7e, 0x97, 0xdd, 0x77, 0xfa, 0x0f, 0x00, 0xc3, 0xec,
-    0x47, 0xa3, 0xfd, 0x3f, 0x73, 0x77, 0x80, 0x3b, 0xe5, 0xf5, 0x1f, 0x00, 0x0e, 0xdf, 0xd9, 0x4c, 0xe4, 0x55, 0xbe, 0xa6,
-    0x97, 0x4f, 0x99, 0xce, 0x83, 0x5c, 0xcf, 0x99, 0x81, 0xde, 0x8f, 0xfe, 0x03, 0xc0, 0xc9, 0xa3, 0xff, 0x00, 0xa0, 0xff,
-    0xfa, 0x0f, 0x00, 0xfa, 0xaf, 0xff, 0x00, 0xa0, 0xff, 0xfa, 0x0f, 0x00, 0xc7, 0xa9, 0xff, 0xb3, 0xad, 0xf4, 0x7f, 0x46,
-    0xff, 0x01, 0xa0, 0xf3, 0x1e, 0x95, 0x5e, 0x7f, 0x6c, 0xa5, 0xff, 0x5b, 0xdf, 0x37, 0x78, 0x6c, 0xba, 0x00, 0xd0, 0x51,
-    0x37, 0x4b, 0xaf, 0x7b, 0xad, 0xf4, 0xbf, 0x57, 0xd6, 0xdd, 0x32, 0x5d, 0x00, 0xe8, 0xa8, 0x2b, 0xa5, 0xd7, 0x8b, 0x19,
-    0xe9, 0xbb, 0xff, 0x23, 0x59, 0x2c, 0xeb, 0xae, 0x99, 0x2e, 0x00, 0x74, 0xd4, 0x68, 0xed, 0x0c, 0xa2, 0x27, 0x7d, 0xf7,
-    0xff, 0x69, 0x59, 0xb5, 0x5e, 0x3b, 0xe5, 0x10, 0x00, 0xe8, 0x9a, 0xcf, 0xa5, 0xd9, 0x4b, 0xa9, 0x32, 0x76, 0xe0, 0xfe,
-    0x8f, 0xe5, 0x65, 0x96, 0xcb, 0xaa, 0x2f, 0x26, 0x0b, 0x00, 0x1d, 0x76, 0x29, 0x2b, 0xb5, 0xd3, 0x08, 0x96, 0xb3, 0x90,
-    0xb9, 0xdc, 0xdf, 0x57, 0xff, 0xef, 0x65, 0x2e, 0x0b, 0xb5, 0xf6, 0x27, 0xff, 0x73, 0xd9, 0x64, 0x01, 0xa0, 0xd3, 0x66,
-    0x1a, 0x67, 0x12, 0xbd, 0xd9, 0x57, 0xff, 0x5f, 0x37, 0x7e, 0x3f, 0x6b, 0xaa, 0x00, 0xd0, 0xf9, 0x3d, 0x00, 0x53, 0xf9,
-    0xd7, 0x5a, 0xff, 0xff, 0x66, 0x2a, 0xa3, 0xa6, 0x0a, 0x00, 0x43, 0xe0, 0x7c, 0xde, 0x67, 0xb5, 0xef, 0xfe, 0xaf, 0xe4,
-    0x6d, 0xce, 0x99, 0x26, 0x00, 0x0c, 0x91, 0xd3, 0xb9, 0x98, 0xf1, 0x4c, 0xa6, 0xca, 0x9d, 0xc6, 0xb5, 0x89, 0xbc, 0xdb,
-    0x74, 0xa3, 0x71, 0xed, 0x76, 0xaa, 0x4c, 0x66, 0x3c, 0x17, 0x72, 0xca, 0x14, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc3, 0xb2, 0xd1, 0x5e, 0x1d, 0x12, 0x01, 0x00, 0x00, 0x20, 0x10,
-    0xeb, 0xdf, 0x1a, 0x41, 0x02, 0x2c, 0x37, 0xd6, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x83, 0xce, 0x0f, 0x00, 0xa0, 0xff, 0x00, 0xc0, 0x7d, 0xff, 0x03 };
+#define ATLAS_WIDTH_FONT_FONTUBUNTU 1024
+#define ATLAS_HEIGHT_FONT_FONTUBUNTU 512
+#define ATLAS_FORMAT_FONT_FONTUBUNTU 1  // PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+#define DECOMPRESSED_DATA_SIZE_FONT_FONTUBUNTU 524288
+#define COMPRESSED_DATA_SIZE_FONT_FONTUBUNTU 25148
+#define COMPRESSED_DATA_HASH_FONT_FONTUBUNTU 0x457dba866cf1f4bfULL  // FNV-1a of the blob
 
-// Font characters rectangles data
-static Rectangle fontRecs_FontUbuntu[95] = {
-    { 4, 4, 13 , 64 },
-    { 25, 4, 8 , 41 },
-    { 41, 4, 16 , 16 },
-    { 65, 4, 34 , 40 },
-    { 107, 4, 26 , 52 },
-    { 141, 4, 45 , 42 },
-    { 194, 4, 36 , 42 },
-    { 238, 4, 6 , 16 },
-    { 252, 4, 15 , 56 },
-    { 275, 4, 15 , 56 },
-    { 298, 4, 24 , 23 },
-    { 330, 4, 27 , 29 },
-    { 365, 4, 9 , 17 },
-    { 382, 4, 15 , 6 },
-    { 405, 4, 8 , 8 },
-    { 421, 4, 26 , 56 },
-    { 455, 4, 28 , 42 },
-    { 491, 4, 17 , 40 },
-    { 516, 4, 25 , 41 },
-    { 549, 4, 25 , 42 },
-    { 582, 4, 28 , 40 },
-    { 618, 4, 26 , 41 },
-    { 652, 4, 27 , 41 },
-    { 687, 4, 26 , 40 },
-    { 721, 4, 27 , 42 },
-    { 756, 4, 27 , 42 },
-    { 791, 4, 8 , 31 },
-    { 807, 4, 9 , 40 },
-    { 824, 4, 27 , 26 },
-    { 859, 4, 27 , 18 },
-    { 894, 4, 27 , 26 },
-    { 929, 4, 21 , 42 },
-    { 958, 4, 48 , 50 },
-    { 4, 76, 38 , 40 },
-    { 50, 76, 30 , 41 },
-    { 88, 76, 31 , 42 },
-    { 127, 76, 34 , 41 },
-    { 169, 76, 27 , 40 },
-    { 204, 76, 25 , 40 },
-    { 237, 76, 32 , 42 },
-    { 277, 76, 32 , 40 },
-    { 317, 76, 7 , 40 },
-    { 332, 76, 24 , 41 },
-    { 364, 76, 32 , 40 },
-    { 404, 76, 25 , 40 },
-    { 437, 76, 43 , 40 },
-    { 488, 76, 33 , 40 },
-    { 529, 76, 39 , 42 },
-    { 576, 76, 29 , 40 },
-    { 613, 76, 39 , 52 },
-    { 660, 76, 31 , 40 },
-    { 699, 76, 28 , 42 },
-    { 735, 76, 32 , 40 },
-    { 775, 76, 31 , 41 },
-    { 814, 76, 37 , 40 },
-    { 859, 76, 51 , 40 },
-    { 918, 76, 34 , 40 },
-    { 960, 76, 34 , 40 },
-    { 4, 148, 30 , 40 },
-    { 42, 148, 14 , 56 },
-    { 64, 148, 26 , 56 },
-    { 98, 148, 14 , 56 },
-    { 120, 148, 28 , 23 },
-    { 156, 148, 30 , 5 },
-    { 194, 148, 12 , 12 },
-    { 214, 148, 24 , 32 },
-    { 246, 148, 27 , 46 },
-    { 281, 148, 24 , 32 },
-    { 313, 148, 28 , 46 },
-    { 349, 148, 27 , 32 },
-    { 384, 148, 19 , 45 },
-    { 411, 148, 27 , 42 },
-    { 446, 148, 25 , 45 },
-    { 479, 148, 8 , 43 },
-    { 495, 148, 15 , 54 },
-    { 518, 148, 26 , 45 },
-    { 552, 148, 11 , 46 },
-    { 571, 148, 41 , 31 },
-    { 620, 148, 25 , 31 },
-    { 653, 148, 29 , 32 },
-    { 690, 148, 27 , 42 },
-    { 725, 148, 28 , 42 },
-    { 761, 148, 18 , 31 },
-    { 787, 148, 22 , 32 },
-    { 817, 148, 18 , 40 },
-    { 843, 148, 25 , 31 },
-    { 876, 148, 28 , 30 },
-    { 912, 148, 43 , 30 },
-    { 963, 148, 29 , 30 },
-    { 4, 220, 28 , 41 },
-    { 40, 220, 23 , 30 },
-    { 71, 220, 17 , 56 },
-    { 96, 220, 6 , 56 },
-    { 110, 220, 17 , 56 },
-    { 135, 220, 28 , 10 },
-};
+// Atlas coverage, DEFLATE-compressed
+extern "C" const unsigned char fontData_FontUbuntu[COMPRESSED_DATA_SIZE_FONT_FONTUBUNTU];
 
-// Font glyphs info data
-// NOTE: No glyphs.image data provided
-static GlyphInfo fontGlyphs_FontUbuntu[95] = {
-    { 32, 0, 0, 13, { 0 }},
-    { 33, 4, 13, 15, { 0 }},
-    { 34, 4, 9, 23, { 0 }},
-    { 35, 2, 13, 38, { 0 }},
-    { 36, 3, 8, 32, { 0 }},
-    { 37, 2, 12, 48, { 0 }},
-    { 38, 2, 12, 38, { 0 }},
-    { 39, 4, 9, 13, { 0 }},
-    { 40, 4, 8, 18, { 0 }},
-    { 41, 0, 8, 18, { 0 }},
-    { 42, 2, 13, 27, { 0 }},
-    { 43, 3, 21, 32, { 0 }},
-    { 44, 2, 46, 14, { 0 }},
-    { 45, 1, 33, 17, { 0 }},
-    { 46, 3, 46, 14, { 0 }},
-    { 47, -2, 8, 21, { 0 }},
-    { 48, 2, 12, 32, { 0 }},
-    { 49, 5, 13, 32, { 0 }},
-    { 50, 3, 12, 32, { 0 }},
-    { 51, 3, 12, 32, { 0 }},
-    { 52, 2, 13, 32, { 0 }},
-    { 53, 3, 13, 32, { 0 }},
-    { 54, 3, 13, 32, { 0 }},
-    { 55, 3, 13, 32, { 0 }},
-    { 56, 3, 12, 32, { 0 }},
-    { 57, 2, 12, 32, { 0 }},
-    { 58, 3, 23, 14, { 0 }},
-    { 59, 2, 23, 14, { 0 }},
-    { 60, 3, 23, 32, { 0 }},
-    { 61, 3, 27, 32, { 0 }},
-    { 62, 3, 23, 32, { 0 }},
-    { 63, 1, 12, 23, { 0 }},
-    { 64, 3, 12, 54, { 0 }},
-    { 65, 0, 13, 37, { 0 }},
-    { 66, 4, 13, 36, { 0 }},
-    { 67, 3, 12, 35, { 0 }},
-    { 68, 4, 13, 40, { 0 }},
-    { 69, 4, 13, 32, { 0 }},
-    { 70, 4, 13, 30, { 0 }},
-    { 71, 3, 12, 38, { 0 }},
-    { 72, 4, 13, 40, { 0 }},
-    { 73, 4, 13, 15, { 0 }},
-    { 74, 0, 13, 28, { 0 }},
-    { 75, 4, 13, 35, { 0 }},
-    { 76, 4, 13, 29, { 0 }},
-    { 77, 3, 13, 49, { 0 }},
-    { 78, 4, 13, 41, { 0 }},
-    { 79, 3, 12, 44, { 0 }},
-    { 80, 4, 13, 34, { 0 }},
-    { 81, 3, 12, 44, { 0 }},
-    { 82, 4, 13, 35, { 0 }},
-    { 83, 1, 12, 30, { 0 }},
-    { 84, 0, 13, 32, { 0 }},
-    { 85, 4, 13, 39, { 0 }},
-    { 86, 0, 13, 37, { 0 }},
-    { 87, 1, 13, 53, { 0 }},
-    { 88, 1, 13, 36, { 0 }},
-    { 89, 0, 13, 34, { 0 }},
-    { 90, 1, 13, 32, { 0 }},
-    { 91, 5, 8, 18, { 0 }},
-    { 92, -2, 8, 21, { 0 }},
-    { 93, 0, 8, 18, { 0 }},
-    { 94, 2, 13, 32, { 0 }},
-    { 95, -1, 59, 28, { 0 }},
-    { 96, 3, 8, 21, { 0 }},
-    { 97, 2, 22, 29, { 0 }},
-    { 98, 4, 8, 33, { 0 }},
-    { 99, 2, 22, 26, { 0 }},
-    { 100, 2, 8, 33, { 0 }},
-    { 101, 2, 22, 31, { 0 }},
-    { 102, 4, 8, 22, { 0 }},
-    { 103, 2, 22, 32, { 0 }},
-    { 104, 4, 8, 32, { 0 }},
-    { 105, 3, 10, 14, { 0 }},
-    { 106, -4, 10, 14, { 0 }},
-    { 107, 4, 8, 29, { 0 }},
-    { 108, 4, 8, 15, { 0 }},
-    { 109, 4, 22, 49, { 0 }},
-    { 110, 4, 22, 32, { 0 }},
-    { 111, 2, 22, 33, { 0 }},
-    { 112, 4, 22, 33, { 0 }},
-    { 113, 2, 22, 33, { 0 }},
-    { 114, 4, 22, 22, { 0 }},
-    { 115, 2, 22, 25, { 0 }},
-    { 116, 4, 14, 22, { 0 }},
-    { 117, 4, 23, 32, { 0 }},
-    { 118, 0, 23, 28, { 0 }},
-    { 119, 1, 23, 44, { 0 }},
-    { 120, 0, 23, 29, { 0 }},
-    { 121, 0, 23, 28, { 0 }},
-    { 122, 2, 23, 26, { 0 }},
-    { 123, 2, 8, 19, { 0 }},
-    { 124, 5, 8, 15, { 0 }},
-    { 125, 0, 8, 19, { 0 }},
-    { 126, 2, 31, 32, { 0 }},
+// Glyph rectangles in the atlas
+static Rectangle fontRecs_FontUbuntu[GLYPH_COUNT_FONT_FONTUBUNTU] = {
+    {4, 4, 13, 64},
+    {25, 4, 8, 41},
+    {41, 4, 16, 16},
+    {65, 4, 34, 40},
+    {107, 4, 26, 52},
+    {141, 4, 45, 42},
+    {194, 4, 36, 42},
+    {238, 4, 6, 16},
+    {252, 4, 15, 56},
+    {275, 4, 15, 56},
+    {298, 4, 24, 23},
+    {330, 4, 27, 29},
+    {365, 4, 9, 17},
+    {382, 4, 15, 6},
+    {405, 4, 8, 8},
+    {421, 4, 26, 56},
+    {455, 4, 28, 42},
+    {491, 4, 17, 40},
+    {516, 4, 25, 41},
+    {549, 4, 25, 42},
+    {582, 4, 28, 40},
+    {618, 4, 26, 41},
+    {652, 4, 27, 41},
+    {687, 4, 26, 40},
+    {721, 4, 27, 42},
+    {756, 4, 27, 42},
+    {791, 4, 8, 31},
+    {807, 4, 9, 40},
+    {824, 4, 27, 26},
+    {859, 4, 27, 18},
+    {894, 4, 27, 26},
+    {929, 4, 21, 42},
+    {958, 4, 48, 50},
+    {4, 76, 38, 40},
+    {50, 76, 30, 41},
+    {88, 76, 31, 42},
+    {127, 76, 34, 41},
+    {169, 76, 27, 40},
+    {204, 76, 25, 40},
+    {237, 76, 32, 42},
+    {277, 76, 32, 40},
+    {317, 76, 7, 40},
+    {332, 76, 24, 41},
+    {364, 76, 32, 40},
+    {404, 76, 25, 40},
+    {437, 76, 43, 40},
+    {488, 76, 33, 40},
+    {529, 76, 39, 42},
+    {576, 76, 29, 40},
+    {613, 76, 39, 52},
+    {660, 76, 31, 40},
+    {699, 76, 28, 42},
+    {735, 76, 32, 40},
+    {775, 76, 31, 41},
+    {814, 76, 37, 40},
+    {859, 76, 51, 40},
+    {918, 76, 34, 40},
+    {960, 76, 34, 40},
+    {4, 148, 30, 40},
+    {42, 148, 14, 56},
+    {64, 148, 26, 56},
+    {98, 148, 14, 56},
+    {120, 148, 28, 23},
+    {156, 148, 30, 5},
+    {194, 148, 12, 12},
+    {214, 148, 24, 32},
+    {246, 148, 27, 46},
+    {281, 148, 24, 32},
+    {313, 148, 28, 46},
+    {349, 148, 27, 32},
+    {384, 148, 19, 45},
+    {411, 148, 27, 42},
+    {446, 148, 25, 45},
+    {479, 148, 8, 43},
+    {495, 148, 15, 54},
+    {518, 148, 26, 45},
+    {552, 148, 11, 46},
+    {571, 148, 41, 31},
+    {620, 148, 25, 31},
+    {653, 148, 29, 32},
+    {690, 148, 27, 42},
+    {725, 148, 28, 42},
+    {761, 148, 18, 31},
+    {787, 148, 22, 32},
+    {817, 148, 18, 40},
+    {843, 148, 25, 31},
+    {876, 148, 28, 30},
+    {912, 148, 43, 30},
+    {963, 148, 29, 30},
+    {4, 220, 28, 41},
+    {40, 220, 23, 30},
+    {71, 220, 17, 56},
+    {96, 220, 6, 56},
+    {110, 220, 17, 56},
+    {135, 220, 28, 10},
 };
 
-// Font loading function: FontUbuntu
-static Font LoadFont_FontUbuntu(void)
-{
-    Font font = { 0 };
-
-    font.baseSize = 64;
-    font.glyphCount = 95;
-    font.glyphPadding = 4;
-
-    // Custom font loading
-    // NOTE: Compressed font image data (DEFLATE), it requires DecompressData() function
-    int fontDataSize_FontUbuntu = 0;
-    unsigned char *data = DecompressData(fontData_FontUbuntu, COMPRESSED_DATA_SIZE_FONT_FONTUBUNTU, &fontDataSize_FontUbuntu);
-    Image imFont = { data, 1024, 512, 1, 2 };
-
-    // Load texture from image
-    font.texture = LoadTextureFromImage(imFont);
-    UnloadImage(imFont);  // Uncompressed data can be unloaded from memory
-
-    // Assign glyph recs and info data directly
-    // WARNING: This font data must not be unloaded
-    font.recs = fontRecs_FontUbuntu;
-    font.glyphs = fontGlyphs_FontUbuntu;
-
-    return font;
-}
+// Glyph metrics; glyph images are not embedded
+static GlyphInfo fontGlyphs_FontUbuntu[GLYPH_COUNT_FONT_FONTUBUNTU] = {
+    {32, 0, 0, 13, {}},
+    {33, 4, 13, 15, {}},
+    {34, 4, 9, 23, {}},
+    {35, 2, 13, 38, {}},
+    {36, 3, 8, 32, {}},
+    {37, 2, 12, 48, {}},
+    {38, 2, 12, 38, {}},
+    {39, 4, 9, 13, {}},
+    {40, 4, 8, 18, {}},
+    {41, 0, 8, 18, {}},
+    {42, 2, 13, 27, {}},
+    {43, 3, 21, 32, {}},
+    {44, 2, 46, 14, {}},
+    {45, 1, 33, 17, {}},
+    {46, 3, 46, 14, {}},
+    {47, -2, 8, 21, {}},
+    {48, 2, 12, 32, {}},
+    {49, 5, 13, 32, {}},
+    {50, 3, 12, 32, {}},
+    {51, 3, 12, 32, {}},
+    {52, 2, 13, 32, {}},
+    {53, 3, 13, 32, {}},
+    {54, 3, 13, 32, {}},
+    {55, 3, 13, 32, {}},
+    {56, 3, 12, 32, {}},
+    {57, 2, 12, 32, {}},
+    {58, 3, 23, 14, {}},
+    {59, 2, 23, 14, {}},
+    {60, 3, 23, 32, {}},
+    {61, 3, 27, 32, {}},
+    {62, 3, 23, 32, {}},
+    {63, 1, 12, 23, {}},
+    {64, 3, 12, 54, {}},
+    {65, 0, 13, 37, {}},
+    {66, 4, 13, 36, {}},
+    {67, 3, 12, 35, {}},
+    {68, 4, 13, 40, {}},
+    {69, 4, 13, 32, {}},
+    {70, 4, 13, 30, {}},
+    {71, 3, 12, 38, {}},
+    {72, 4, 13, 40, {}},
+    {73, 4, 13, 15, {}},
+    {74, 0, 13, 28, {}},
+    {75, 4, 13, 35, {}},
+    {76, 4, 13, 29, {}},
+    {77, 3, 13, 49, {}},
+    {78, 4, 13, 41, {}},
+    {79, 3, 12, 44, {}},
+    {80, 4, 13, 34, {}},
+    {81, 3, 12, 44, {}},
+    {82, 4, 13, 35, {}},
+    {83, 1, 12, 30, {}},
+    {84, 0, 13, 32, {}},
+    {85, 4, 13, 39, {}},
+    {86, 0, 13, 37, {}},
+    {87, 1, 13, 53, {}},
+    {88, 1, 13, 36, {}},
+    {89, 0, 13, 34, {}},
+    {90, 1, 13, 32, {}},
+    {91, 5, 8, 18, {}},
+    {92, -2, 8, 21, {}},
+    {93, 0, 8, 18, {}},
+    {94, 2, 13, 32, {}},
+    {95, -1, 59, 28, {}},
+    {96, 3, 8, 21, {}},
+    {97, 2, 22, 29, {}},
+    {98, 4, 8, 33, {}},
+    {99, 2, 22, 26, {}},
+    {100, 2, 8, 33, {}},
+    {101, 2, 22, 31, {}},
+    {102, 4, 8, 22, {}},
+    {103, 2, 22, 32, {}},
+    {104, 4, 8, 32, {}},
+    {105, 3, 10, 14, {}},
+    {106, -4, 10, 14, {}},
+    {107, 4, 8, 29, {}},
+    {108, 4, 8, 15, {}},
+    {109, 4, 22, 49, {}},
+    {110, 4, 22, 32, {}},
+    {111, 2, 22, 33, {}},
+    {112, 4, 22, 33, {}},
+    {113, 2, 22, 33, {}},
+    {114, 4, 22, 22, {}},
+    {115, 2, 22, 25, {}},
+    {116, 4, 14, 22, {}},
+    {117, 4, 23, 32, {}},
+    {118, 0, 23, 28, {}},
+    {119, 1, 23, 44, {}},
+    {120, 0, 23, 29, {}},
+    {121, 0, 23, 28, {}},
+    {122, 2, 23, 26, {}},
+    {123, 2, 8, 19, {}},
+    {124, 5, 8, 15, {}},
+    {125, 0, 8, 19, {}},
+    {126, 2, 31, 32, {}},
+};
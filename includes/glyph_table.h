@@ -0,0 +1,16 @@
+#pragma once
+#include "../raylib/src/raylib.h"
+
+// Direct codepoint -> glyph index map for the ASCII range, replacing the
+// linear scan raylib's GetGlyphIndex does for every character. Codepoints
+// without a glyph map to the '?' fallback exactly as GetGlyphIndex does
+struct GlyphTable {
+    int index[128];
+
+    // Build the table with one pass over the font's glyphs
+    static GlyphTable build(const Font& font);
+
+    int lookup(const Font& font, int codepoint) const {
+        return codepoint >= 0 && codepoint < 128 ? index[codepoint] : GetGlyphIndex(font, codepoint);
+    }
+};
@@ -0,0 +1,98 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "parser.h"
+
+// Shunting-yard evaluator fed one character at a time as the user types.
+// Every character leaves a checkpoint, and every stack mutation is recorded
+// in an undo journal, so appending and erasing are O(1) amortized per
+// character instead of re-parsing the whole expression. The preview is
+// refreshed once per edit and costs O(pending operators).
+class IncrementalParser {
+   public:
+    IncrementalParser();
+
+    // Feed characters appended to the end of the expression
+    void append(const std::string& text);
+
+    // Undo the last count characters
+    void erase(size_t count);
+
+    // Bring the parser in line with an arbitrarily edited expression,
+    // re-feeding only the part after the common prefix
+    void sync(const std::string& expression);
+
+    void clear();
+
+    const std::string& text() const { return source; }
+
+    // Number of '(' not yet closed; negative if there are surplus ')'
+    int parenBalance() const { return state.parenDepth; }
+
+    // No syntax or domain error so far; the text may still be incomplete
+    bool isValid() const { return state.error == EvalError::None; }
+
+    // Valid and ends on a complete operand, so it evaluates once parentheses are closed
+    bool isComplete() const { return preview.ok(); }
+
+    // Value of the expression with open parentheses closed, or the reason there is none
+    const EvalResult& previewResult() const { return preview; }
+
+   private:
+    enum class Lexeme : uint8_t { None, Number, Identifier };
+
+    // Operator stack entry: an operator, a function awaiting its ')', or a '('
+    enum class Pending : uint8_t { Operator, Function, LeftParen };
+    struct StackOp {
+        Pending kind;
+        OpCode op;
+    };
+
+    // Everything that is not a stack, restored wholesale from a checkpoint
+    struct Scalars {
+        Lexeme lexeme;
+        uint32_t tokenStart;
+        bool expectOperand;
+        int parenDepth;
+        EvalError error;
+        uint32_t errorPosition;
+    };
+
+    struct Change {
+        enum Kind : uint8_t { PushValue, PopValue, PushOp, PopOp } kind;
+        double value;
+        StackOp op;
+    };
+
+    struct Checkpoint {
+        size_t journalSize;
+        Scalars scalars;
+    };
+
+    std::string source;
+    Scalars state;
+    std::vector<double> values;
+    std::vector<StackOp> ops;
+    std::vector<Change> journal;
+    std::vector<Checkpoint> checkpoints;  // One per character of source
+    EvalResult preview;
+
+    // Scratch reused by refreshPreview
+    std::vector<double> previewValues;
+
+    void feed(char c);
+    bool finishLexeme(char next);
+    void pushOperator(StackOp op);
+    bool reduceTop();
+    void fail(EvalError error, uint32_t position);
+    void refreshPreview();
+
+    // Journaled stack primitives
+    void pushValue(double value);
+    double popValue();
+    void pushOp(StackOp op);
+    StackOp popOp();
+};
@@ -0,0 +1,25 @@
+#pragma once
+#include <cstddef>
+
+// Read-only memory mapping of a whole file. Kept free of raylib so the
+// platform headers it needs never meet raylib.h in one translation unit
+class MappedFile {
+   public:
+    MappedFile() = default;
+    ~MappedFile() { close(); }
+
+    MappedFile(const MappedFile&)            = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Map path, replacing any previous mapping. False if the file is missing,
+    // empty or cannot be mapped
+    bool open(const char* path);
+    void close();
+
+    const unsigned char* data() const { return bytes; }
+    size_t size() const { return length; }
+
+   private:
+    const unsigned char* bytes = nullptr;
+    size_t length              = 0;
+};
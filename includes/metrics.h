@@ -10,9 +10,13 @@ class PerformanceMetrics {
     int frameCount{0};                                          // Total number of frames processed
     double avgFrameTime{0.0};                                   // Running average frame time
     std::chrono::high_resolution_clock::time_point frameStart;  // Start time of current frame
+    int targetFps;                                              // Rate an always-redrawing loop would run at
+    std::chrono::high_resolution_clock::time_point startTime;   // When measurement began
+    double startCpu;                                            // Process CPU seconds when measurement began
+    long long framesSkipped{0};                                 // Loop iterations that did not redraw
 
    public:
-    PerformanceMetrics() = default;
+    explicit PerformanceMetrics(int targetFps = 60);
 
     // Start timing a new frame
     void startFrame();
@@ -20,6 +24,9 @@ class PerformanceMetrics {
     // End timing the current frame and update metrics
     void endFrame();
 
+    // Count a loop iteration that found nothing to redraw
+    void skipFrame();
+
     // Get current FPS from raylib
     int getFPS() const;
 
@@ -29,6 +36,19 @@ class PerformanceMetrics {
     // Get average frame time in milliseconds
     double getAvgFrameTime() const;
 
-    // Get formatted performance info string
+    // Loop iterations that found nothing to redraw
+    long long getFramesSkipped() const;
+
+    // Process CPU time since measurement began, in milliseconds
+    double getCpuTimeUsed() const;
+
+    // CPU time a loop redrawing at the target FPS would have used beyond
+    // getCpuTimeUsed(), at the measured CPU cost per drawn frame, in milliseconds
+    double getCpuTimeSaved() const;
+
+    // Get formatted performance info string (FPS and frame times)
     std::string getPerformanceInfo() const;
+
+    // Get formatted frames skipped, CPU time used and CPU time saved
+    std::string getRedrawInfo() const;
 };
\ No newline at end of file
@@ -0,0 +1,18 @@
+#pragma once
+#include <cstddef>
+
+// Large enough for any output of FormatNumberTo, including the terminator
+const size_t numberBufferSize = 32;
+
+// Shortest decimal digits that read back as value (Grisu2). Writes at most 17
+// digits, no terminator, and returns their count; value == digits * 10^exponent.
+// value must be finite and greater than zero
+int ShortestDigits(double value, char* digits, int& exponent);
+
+// Formats value for display without allocating or consulting the locale: at
+// most precision decimals with trailing zeros dropped, or scientific notation
+// ("1.5e20", "2e-7") below 1e-6 and from 1e16. A value that rounds away at
+// the precision prints as 0. Rounding works on the shortest round-trip digits, so
+// 0.1 + 0.2 prints as 0.3 and no digits appear beyond what the double holds.
+// Writes a terminated string to buffer (numberBufferSize bytes) and returns its length
+size_t FormatNumberTo(double value, int precision, char* buffer);
@@ -1,5 +1,7 @@
 #pragma once
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <sstream>
@@ -8,18 +10,179 @@
 #include <string>
 #include <vector>
 
+// Bytecode operations understood by CompiledExpression; every opcode except
+// PushConst and PushVar has an entry in the operator table (see operatorInfo)
+enum class OpCode : uint8_t {
+    PushConst,  // Push Instruction::value
+    PushVar,    // Push variable number Instruction::slot
+    Add,
+    Sub,
+    Mul,
+    Div,
+    Pow,
+    Neg,  // Unary minus
+    Sin,
+    Cos,
+    Tan,
+    Log,
+    Ln,
+    Exp,
+    Sqrt,
+    Asin,
+    Acos,
+    Atan,
+    Hyp
+};
+
+enum class Associativity : uint8_t { Left, Right };
+
+// Why parsing or evaluation failed
+enum class EvalError : uint8_t {
+    None,
+    // Syntax errors
+    EmptyExpression,
+    UnexpectedCharacter,
+    InvalidNumber,
+    MismatchedParentheses,
+    InvalidExpression,
+    InvalidFunctionCall,
+    UnboundVariable,
+    // Domain errors
+    DivisionByZero,
+    ZeroToNegativePower,
+    ImaginaryResult,
+    TangentUndefined,
+    LogNonPositive,
+    LnNonPositive,
+    SqrtNegative,
+    AsinOutOfRange,
+    AcosOutOfRange
+};
+
+// Human-readable description of an error code
+const char* errorMessage(EvalError error);
+
+// Outcome of parsing/evaluating: a value, or an error code and the offset in
+// the source expression where it was detected. Returned by value; never throws
+struct EvalResult {
+    double value;
+    EvalError error;
+    uint32_t position;
+
+    bool ok() const { return error == EvalError::None; }
+    const char* message() const { return errorMessage(error); }
+
+    static EvalResult success(double value) { return EvalResult{value, EvalError::None, 0}; }
+    static EvalResult failure(EvalError error, uint32_t position) { return EvalResult{0.0, error, position}; }
+};
+
+// Applies an operator to its arguments, ordered as written, storing the value
+// in result; returns EvalError::None or the domain error hit
+typedef EvalError (*ApplyFn)(const double* args, double& result);
+
+// Applies an operator element-wise over columns: lhs[i] = op(lhs[i], rhs[i]).
+// rhs is unused by unary operators; domain errors produce NaN instead of throwing
+typedef void (*ColumnFn)(double* lhs, const double* rhs, size_t count);
+
+// Static description of an operator or function shared by every parser stage
+struct OperatorInfo {
+    const char* name;
+    OpCode code;
+    uint8_t arity;
+    uint8_t precedence;  // Binding strength for operators; 0 for functions
+    Associativity associativity;
+    ApplyFn apply;
+    ColumnFn applyColumn;
+};
+
+// Table entry for an opcode other than PushConst/PushVar
+const OperatorInfo& operatorInfo(OpCode code);
+
+// Resolve an operator symbol or function name in O(1); nullptr if unknown
+const OperatorInfo* findOperator(const char* name, size_t length);
+
+// Single postfix instruction; value holds the pre-parsed literal for PushConst
+// and slot the variable number for PushVar
+struct Instruction {
+    OpCode op;
+    uint32_t slot;
+    double value;
+};
+
+// Expression compiled once into a flat postfix program, evaluated many times
+class CompiledExpression {
+   public:
+    CompiledExpression() = default;
+
+    // Whether compilation succeeded; if not, evaluate reports the syntax error
+    bool ok() const { return status.ok(); }
+    EvalError error() const { return status.error; }
+    uint32_t errorPosition() const { return status.position; }
+
+    // Run the program; variables[i] binds variableNames()[i]
+    EvalResult evaluate(const double* variables = nullptr) const;
+
+    // Evaluate over count points, one op at a time across a chunk of points.
+    // columns[i] holds count values for variableNames()[i]; points whose
+    // evaluation hits a domain error produce NaN. Returns a syntax error, an
+    // unbound variable error, or EvalError::None
+    EvalError evaluateBatch(const double* const* columns, size_t count, double* out) const;
+
+    // Same, reusing caller-owned scratch (one per thread) instead of allocating
+    EvalError evaluateBatch(const double* const* columns, size_t count, double* out, std::vector<double>& scratch) const;
+
+    // Variable names in slot order (order of first appearance)
+    const std::vector<std::string>& variableNames() const { return variables; }
+
+    bool empty() const { return code.empty(); }
+    size_t size() const { return code.size(); }
+
+    // Instructions removed by constant folding and algebraic simplification
+    size_t eliminatedOps() const { return eliminated; }
+
+   private:
+    friend class MathParser;
+
+    std::vector<Instruction> code;
+    std::vector<uint32_t> positions;  // Source offset of each instruction, read only on errors
+    std::vector<std::string> variables;
+    size_t maxStackDepth{0};  // Deepest operand stack reached, validated at compile time
+    size_t eliminated{0};
+    EvalResult status{EvalResult::failure(EvalError::EmptyExpression, 0)};
+};
+
+// Lexical category of a Token
+enum class TokenKind : uint8_t { Number, Variable, Function, Operator, LeftParen, RightParen };
+
+// Fixed-size token record referring back into the source expression
+struct Token {
+    TokenKind kind;
+    OpCode op;        // Resolved operator/function for Operator and Function tokens
+    uint32_t offset;  // Position of the first character in the expression
+    uint32_t length;  // Number of characters spanned
+    double value;     // Pre-parsed literal for Number tokens
+};
+
 class MathParser {
    public:
-    std::unique_ptr<double> evaluate(const std::string& expression);
+    EvalResult evaluate(const std::string& expression);
+
+    // Tokenize and convert the expression once; check ok() on the result.
+    // optimize folds constant subexpressions and applies identities that are exact in IEEE arithmetic
+    CompiledExpression compile(const std::string& expression, bool optimize = true);
+
+    // Split the expression into the parser-owned token buffer; no per-token
+    // allocation. Returns the first lexical error, or EvalResult::success
+    EvalResult tokenize(const std::string& expr);
+    const std::vector<Token>& tokenBuffer() const { return tokens; }
 
    private:
-    std::vector<std::string> tokenize(const std::string& expr);
-    std::vector<std::string> toRPN(const std::vector<std::string>& tokens);
-    double computeRPN(const std::vector<std::string>& rpn);
-    bool isNumber(const std::string& token);
-    bool isOperator(const std::string& token);
-    bool isFunction(const std::string& token);
-    int precedence(const std::string& op);
-    double applyOperator(double a, double b, const std::string& op);
-    double applyFunction(double a, const std::string& func);
+    // Scratch buffers reused across calls so steady-state parsing does not allocate
+    std::vector<Token> tokens;
+    std::vector<Token> rpn;
+    std::vector<Token> opStack;
+
+    EvalResult toRPN();
+    void assemble(const std::string& expr, CompiledExpression& compiled);
+    void optimize(CompiledExpression& compiled);
 };
@@ -0,0 +1,8 @@
+#pragma once
+#include <cstddef>
+
+// Peak resident set size of this process in bytes, or 0 if unknown
+size_t PeakRssBytes();
+
+// User plus system CPU time this process has used, in seconds, or 0 if unknown
+double ProcessCpuSeconds();
@@ -0,0 +1,29 @@
+#pragma once
+#include "../raylib/src/raylib.h"
+
+// Off-screen texture holding a pre-rendered, fully opaque piece of the UI.
+// Content is drawn once between begin() and end(), then composited every
+// frame with a single textured quad by draw()
+class RenderLayer {
+   public:
+    RenderLayer() = default;
+
+    RenderLayer(const RenderLayer&)            = delete;
+    RenderLayer& operator=(const RenderLayer&) = delete;
+
+    bool loaded() const { return target.id != 0; }
+
+    // Start rendering into the layer, (re)allocating it at the given size.
+    // Needs an OpenGL context, so only call after InitWindow
+    void begin(int width, int height, Color background);
+    void end();
+
+    // Composite the layer with its top-left corner at position
+    void draw(Vector2 position) const;
+
+    // Release the texture; must run before CloseWindow
+    void unload();
+
+   private:
+    RenderTexture2D target{};
+};
@@ -0,0 +1,79 @@
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <cstdio>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "parser.h"
+
+// Totals from one StreamEvaluator::run
+struct StreamStats {
+    size_t lines{0};
+    size_t expressions{0};  // Non-blank lines evaluated
+    size_t failures{0};
+    size_t bytesRead{0};
+    size_t cacheHits{0};  // Summed over the workers' expression caches
+    size_t cacheMisses{0};
+    double seconds{0.0};
+};
+
+// Append the output line for one result: the formatted value, or
+// "error: <message> at <offset>"
+void AppendResultLine(std::string& out, const EvalResult& result, int precision);
+
+// Evaluates newline-separated expressions from a stream in a pipeline:
+// the calling thread reads fixed-size chunks cut at line boundaries, worker
+// threads evaluate whole chunks, and a writer thread emits them in input
+// order. At most a few chunks per worker are alive at once, so memory stays
+// bounded no matter how large the input is
+class StreamEvaluator {
+   public:
+    // threadCount of 0 uses one worker per hardware core. Each worker keeps an
+    // LRU of cacheCapacity results, so repeated lines are not parsed again
+    explicit StreamEvaluator(size_t threadCount = 0, int precision = 10, size_t chunkBytes = 1 << 20, size_t cacheCapacity = 4096);
+
+    StreamEvaluator(const StreamEvaluator&)            = delete;
+    StreamEvaluator& operator=(const StreamEvaluator&) = delete;
+
+    // Write one result line per input line. Returns false on a read or
+    // write error; stats cover whatever was processed
+    bool run(FILE* input, FILE* output, StreamStats& stats);
+
+    size_t threadCount() const { return workerCount; }
+
+   private:
+    struct Chunk {
+        size_t sequence;
+        std::string text;    // Whole lines, the last one possibly unterminated
+        std::string result;  // One output line per input line
+        size_t lines;
+        size_t expressions;
+        size_t failures;
+    };
+
+    size_t workerCount;
+    int precision;
+    size_t chunkBytes;
+    size_t cacheCapacity;
+    size_t maxInFlight;  // Chunks read but not yet written
+
+    std::mutex mutex;
+    std::condition_variable spaceAvailable;  // Reader waits for inFlight < maxInFlight
+    std::condition_variable chunkReady;      // Workers wait for queued chunks
+    std::condition_variable chunkDone;       // Writer waits for the next chunk in order
+    std::deque<std::unique_ptr<Chunk>> queued;
+    std::map<size_t, std::unique_ptr<Chunk>> finished;
+    size_t inFlight{0};
+    size_t chunksRead{0};
+    bool readingDone{false};
+    bool writeFailed{false};
+    size_t cacheHits{0};  // Added by each worker as it exits
+    size_t cacheMisses{0};
+
+    void workerLoop();
+    void writerLoop(FILE* output, StreamStats& stats);
+};
@@ -0,0 +1,61 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "../raylib/src/raylib.h"
+#include "coverage_shader.h"
+#include "glyph_table.h"
+
+// Text measurement and drawing for a single loaded font. Glyphs and their
+// advances for ASCII are looked up in tables built once instead of the
+// per-glyph GetGlyphIndex scan in MeasureTextEx/DrawTextEx, and truncation
+// results are memoized across frames
+class TextLayout {
+   public:
+    // coverage draws fonts with a single-channel atlas; it may be null for
+    // other fonts and must outlive the layout
+    TextLayout(const Font& font, const GlyphTable& glyphs, const CoverageShader* coverage = nullptr);
+
+    int glyphIndex(int codepoint) const { return glyphs.lookup(font, codepoint); }
+
+    // Same result as MeasureTextEx for single-line text
+    Vector2 measure(const std::string& text, float fontSize, float spacing = 0.0f) const;
+
+    // Same output as DrawTextEx for single-line text
+    void draw(const std::string& text, Vector2 position, float fontSize, float spacing, Color tint) const;
+
+    // Bracket a run of draw calls so they share one coverage shader switch;
+    // every switch flushes raylib's batch. Calls outside a run switch on
+    // their own. Shapes and textures drawn inside a run render unchanged
+    void begin();
+    void end();
+
+    // Drop characters from the front until text fits maxWidth, marking the
+    // cut with a leading '.'; O(n) on a miss, free when unchanged since the
+    // last call with the same size and width. The result is evicted least
+    // recently used first, so it outlives the next cacheSlots - 1 calls
+    const std::string& truncateToFit(const std::string& text, float fontSize, float maxWidth);
+
+   private:
+    struct Truncation {
+        std::string text;
+        float fontSize;
+        float maxWidth;
+        std::string result;
+        uint64_t lastUse;
+    };
+
+    static const size_t cacheSlots = 6;  // One per distinct line the display truncates
+
+    Font font;
+    GlyphTable glyphs;
+    const CoverageShader* coverage;
+    bool inRun{false};
+    float advances[128];  // Unscaled advance of each ASCII character
+    Truncation cache[cacheSlots];
+    uint64_t useClock{0};
+
+    static bool isAscii(const std::string& text);
+    void drawGlyphs(const std::string& text, Vector2 position, float fontSize, float spacing, Color tint) const;
+};
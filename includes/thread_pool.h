@@ -0,0 +1,59 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed-size pool where each worker owns a deque of index ranges: it pops
+// its own work from the back and steals from the front of other workers'
+// deques once its own is empty
+class ThreadPool {
+   public:
+    // Body of a parallel loop: process [begin, end) on the given worker
+    typedef std::function<void(size_t begin, size_t end, size_t worker)> RangeFn;
+
+    // threadCount of 0 uses one thread per hardware core
+    explicit ThreadPool(size_t threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&)            = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    size_t size() const { return workers.size(); }
+
+    // Split [0, count) into ranges of at most grain items and run body over
+    // all of them; blocks until every range has finished
+    void parallelFor(size_t count, size_t grain, const RangeFn& body);
+
+   private:
+    // Each range carries its own body so a worker never runs it against a stale job
+    struct Range {
+        size_t begin;
+        size_t end;
+        const RangeFn* body;
+    };
+
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<Range> ranges;
+    };
+
+    std::vector<std::thread> workers;
+    std::vector<std::unique_ptr<WorkQueue>> queues;
+
+    std::mutex jobMutex;  // Serializes parallelFor callers
+    std::mutex stateMutex;
+    std::condition_variable workAvailable;
+    std::condition_variable jobFinished;
+    size_t jobGeneration{0};
+    std::atomic<size_t> pendingRanges{0};
+    bool stopping{false};
+
+    void workerLoop(size_t index);
+    bool popOrSteal(size_t index, Range& range);
+};
@@ -0,0 +1,27 @@
+#include "../includes/batch_evaluator.h"
+
+ParallelBatchEvaluator::ParallelBatchEvaluator(size_t threadCount, size_t grain) : pool(threadCount), scratch(pool.size()), grain(grain) {}
+
+EvalError ParallelBatchEvaluator::evaluate(const CompiledExpression& expression, const double* const* columns, size_t count, double* out) {
+    // Validate up front so workers cannot fail
+    if (!expression.ok()) {
+        return expression.error();
+    }
+    const size_t variableCount = expression.variableNames().size();
+    if (columns == nullptr && variableCount > 0) {
+        return EvalError::UnboundVariable;
+    }
+
+    pool.parallelFor(count, grain, [&](size_t begin, size_t end, size_t worker) {
+        WorkerScratch& local = scratch[worker];
+
+        // Rebase every input column onto this range
+        local.columns.resize(variableCount);
+        for (size_t i = 0; i < variableCount; ++i) {
+            local.columns[i] = columns[i] + begin;
+        }
+
+        expression.evaluateBatch(local.columns.data(), end - begin, out + begin, local.stack);
+    });
+    return EvalError::None;
+}
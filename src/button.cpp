@@ -1,17 +1,17 @@
 #include "../includes/button.h"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
-#include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "../raylib/src/raylib.h"
+#include "../raylib/src/rlgl.h"
 
-// Button categories for visual styling
-enum class ButtonCategory { NUMBER, OPERATOR, FUNCTION, CONTROL, SPECIAL };
-
-// Button category mapping
-static const std::map<int, ButtonCategory> buttonCategories = {
+// Button category mapping; ids not listed are styled as numbers
+static const std::pair<int, ButtonCategory> categoryEntries[] = {
     // Numbers
     {'0', ButtonCategory::NUMBER},
     {'1', ButtonCategory::NUMBER},
@@ -57,6 +57,20 @@ static const std::map<int, ButtonCategory> buttonCategories = {
     {205, ButtonCategory::SPECIAL},
     {'=', ButtonCategory::SPECIAL}};
 
+// Dense id -> category table so lookups are a single index; every id fits in a byte
+static std::array<ButtonCategory, 256> BuildCategoryTable() {
+    std::array<ButtonCategory, 256> table;
+    table.fill(ButtonCategory::NUMBER);
+    for (const auto& entry : categoryEntries) {
+        table[static_cast<size_t>(entry.first)] = entry.second;
+    }
+    return table;
+}
+
+static const std::array<ButtonCategory, 256> buttonCategories = BuildCategoryTable();
+
+static ButtonCategory CategoryOf(int id) { return id >= 0 && id < 256 ? buttonCategories[static_cast<size_t>(id)] : ButtonCategory::NUMBER; }
+
 // Creates and returns a vector of Button objects arranged in a calculator
 // layout
 std::vector<Button> CreateButtons(int btnW, int btnH, int margin, int topOffset, int leftOffset, const Font& font) {
@@ -77,86 +91,183 @@ std::vector<Button> CreateButtons(int btnW, int btnH, int margin, int topOffset,
             Rectangle rect = {static_cast<float>(leftOffset + col * (btnW + margin)), static_cast<float>(topOffset + row * (btnH + margin)),
                               static_cast<float>(btnW), static_cast<float>(btnH)};
             buttons.emplace_back(rect, layout[row][col].first, layout[row][col].second, font);
+            buttons.back().category = CategoryOf(buttons.back().id);
         }
     }
+    ApplyButtonTheme(buttons, false);
     return buttons;
 }
 
-// Draws all calculator buttons and highlights the one under the mouse cursor
-void DrawButtons(const std::vector<Button>& buttons, const Font& font, Vector2 mouse, const bool isDarkMode) {
-    struct ThemeColors {
-        Color numberBg;
-        Color operatorBg;
-        Color functionBg;
-        Color controlBg;
-        Color specialBg;
-        Color hover;
-        Color text;
-    };
-
-    const ThemeColors lightTheme = {
-        {240, 240, 240, 255},  // numberBg
-        {230, 230, 250, 255},  // operatorBg (Lavender)
-        {230, 250, 230, 255},  // functionBg (Light green)
-        {250, 230, 230, 255},  // controlBg (Light red)
-        {250, 250, 210, 255},  // specialBg (Light yellow)
-        {173, 216, 230, 255},  // hover (Light blue)
-        BLACK                  // text
-    };
-
-    const ThemeColors darkTheme = {
-        {60, 60, 60, 255},     // numberBg
-        {70, 70, 90, 255},     // operatorBg
-        {50, 80, 50, 255},     // functionBg
-        {80, 50, 50, 255},     // controlBg
-        {90, 90, 40, 255},     // specialBg
-        {100, 149, 237, 255},  // hover (Cornflower blue)
-        WHITE                  // text
-    };
+// Button palette for one theme
+struct ThemeColors {
+    Color numberBg;
+    Color operatorBg;
+    Color functionBg;
+    Color controlBg;
+    Color specialBg;
+    Color hover;
+    Color text;
+};
 
+static const ThemeColors lightTheme = {
+    {240, 240, 240, 255},  // numberBg
+    {230, 230, 250, 255},  // operatorBg (Lavender)
+    {230, 250, 230, 255},  // functionBg (Light green)
+    {250, 230, 230, 255},  // controlBg (Light red)
+    {250, 250, 210, 255},  // specialBg (Light yellow)
+    {173, 216, 230, 255},  // hover (Light blue)
+    BLACK                  // text
+};
+
+static const ThemeColors darkTheme = {
+    {60, 60, 60, 255},     // numberBg
+    {70, 70, 90, 255},     // operatorBg
+    {50, 80, 50, 255},     // functionBg
+    {80, 50, 50, 255},     // controlBg
+    {90, 90, 40, 255},     // specialBg
+    {100, 149, 237, 255},  // hover (Cornflower blue)
+    WHITE                  // text
+};
+
+void ApplyButtonTheme(std::vector<Button>& buttons, bool isDarkMode) {
     const ThemeColors& theme = isDarkMode ? darkTheme : lightTheme;
 
-    for (const Button& btn : buttons) {
-        ButtonCategory category = buttonCategories.count(btn.id) ? buttonCategories.at(btn.id) : ButtonCategory::NUMBER;
-
-        bool isHovered = CheckCollisionPointRec(mouse, btn.rect);
-        Color btnColor = isHovered ? theme.hover : [&]() {
-            switch (category) {
-                case ButtonCategory::NUMBER:
-                    return theme.numberBg;
-                case ButtonCategory::OPERATOR:
-                    return theme.operatorBg;
-                case ButtonCategory::FUNCTION:
-                    return theme.functionBg;
-                case ButtonCategory::CONTROL:
-                    return theme.controlBg;
-                case ButtonCategory::SPECIAL:
-                    return theme.specialBg;
-                default:
-                    return theme.numberBg;
-            }
-        }();
-
-        // Draw button with rounded corners
-        DrawRectangleRounded(btn.rect, 0.3f, 0, btnColor);
-        DrawRectangleRoundedLines(btn.rect, 0.3f, 0, isHovered ? DARKGRAY : GRAY);
-
-        if (btn.texture != nullptr) {
-            float scale = std::min((btn.rect.width - 10.0f) / btn.texture->width, (btn.rect.height - 10.0f) / btn.texture->height);
-
-            Vector2 texturePos = {btn.rect.x + (btn.rect.width - btn.texture->width * scale) * 0.5f,
-                                  btn.rect.y + (btn.rect.height - btn.texture->height * scale) * 0.5f};
-
-            DrawTextureEx(*btn.texture, texturePos, 0.0f, scale, isDarkMode ? DARKGRAY : WHITE);
-        } else {
-            Vector2 textPos = {btn.rect.x + (btn.rect.width - btn.labelSize.x) * 0.5f, btn.rect.y + (btn.rect.height - btn.labelSize.y) * 0.5f};
-
-            DrawTextEx(font, btn.label.c_str(), textPos, static_cast<float>(btn.fontSize), 0, theme.text);
-
-            if (!isHovered) {
-                Rectangle innerRect = {btn.rect.x + 1, btn.rect.y + 1, btn.rect.width - 2, btn.rect.height - 2};
-                DrawRectangleLinesEx(innerRect, 1, Fade(WHITE, 0.3f));
-            }
+    for (Button& btn : buttons) {
+        switch (btn.category) {
+            case ButtonCategory::NUMBER:
+                btn.background = theme.numberBg;
+                break;
+            case ButtonCategory::OPERATOR:
+                btn.background = theme.operatorBg;
+                break;
+            case ButtonCategory::FUNCTION:
+                btn.background = theme.functionBg;
+                break;
+            case ButtonCategory::CONTROL:
+                btn.background = theme.controlBg;
+                break;
+            case ButtonCategory::SPECIAL:
+                btn.background = theme.specialBg;
+                break;
+        }
+        btn.textColor = theme.text;
+    }
+}
+
+// Draws a single button in its normal or hovered look, using the colors
+// resolved by ApplyButtonTheme
+static void DrawButton(const Button& btn, const TextLayout& text, const ThemeColors& theme, bool isHovered, bool isDarkMode) {
+    Color btnColor = isHovered ? theme.hover : btn.background;
+
+    // Draw button with rounded corners
+    DrawRectangleRounded(btn.rect, 0.3f, 0, btnColor);
+    DrawRectangleRoundedLines(btn.rect, 0.3f, 0, isHovered ? DARKGRAY : GRAY);
+
+    if (btn.texture != nullptr) {
+        float scale = std::min((btn.rect.width - 10.0f) / btn.texture->width, (btn.rect.height - 10.0f) / btn.texture->height);
+
+        Vector2 texturePos = {btn.rect.x + (btn.rect.width - btn.texture->width * scale) * 0.5f,
+                              btn.rect.y + (btn.rect.height - btn.texture->height * scale) * 0.5f};
+
+        DrawTextureEx(*btn.texture, texturePos, 0.0f, scale, isDarkMode ? DARKGRAY : WHITE);
+    } else {
+        Vector2 textPos = {btn.rect.x + (btn.rect.width - btn.labelSize.x) * 0.5f, btn.rect.y + (btn.rect.height - btn.labelSize.y) * 0.5f};
+
+        text.draw(btn.label, textPos, static_cast<float>(btn.fontSize), 0, btn.textColor);
+
+        if (!isHovered) {
+            Rectangle innerRect = {btn.rect.x + 1, btn.rect.y + 1, btn.rect.width - 2, btn.rect.height - 2};
+            DrawRectangleLinesEx(innerRect, 1, Fade(WHITE, 0.3f));
         }
     }
-}
\ No newline at end of file
+}
+
+ButtonHitIndex::ButtonHitIndex(const std::vector<Button>& buttons) {
+    if (buttons.empty()) return;
+
+    const Rectangle& first = buttons.front().rect;
+    originX                = first.x;
+    originY                = first.y;
+    cellWidth              = first.width;
+    cellHeight             = first.height;
+
+    // The first row is the run of buttons sharing the first button's y
+    columns = 1;
+    while (static_cast<size_t>(columns) < buttons.size() && buttons[static_cast<size_t>(columns)].rect.y == originY) {
+        columns++;
+    }
+    rows   = static_cast<int>(buttons.size()) / columns;
+    pitchX = columns > 1 ? buttons[1].rect.x - originX : cellWidth;
+    pitchY = rows > 1 ? buttons[static_cast<size_t>(columns)].rect.y - originY : cellHeight;
+
+    // Row-major, equally sized and evenly spaced, with gaps no narrower than zero
+    regular = static_cast<size_t>(rows * columns) == buttons.size() && pitchX >= cellWidth && pitchY >= cellHeight;
+    for (size_t i = 0; regular && i < buttons.size(); ++i) {
+        const Rectangle& r = buttons[i].rect;
+        const float x      = originX + static_cast<float>(i % static_cast<size_t>(columns)) * pitchX;
+        const float y      = originY + static_cast<float>(i / static_cast<size_t>(columns)) * pitchY;
+        regular            = r.x == x && r.y == y && r.width == cellWidth && r.height == cellHeight;
+    }
+
+    if (!regular) {
+        for (const Button& btn : buttons) {
+            rects.push_back(btn.rect);
+        }
+    }
+}
+
+int ButtonHitIndex::find(Vector2 point) const {
+    if (!regular) {
+        for (size_t i = 0; i < rects.size(); ++i) {
+            if (CheckCollisionPointRec(point, rects[i])) return static_cast<int>(i);
+        }
+        return -1;
+    }
+
+    // Same inclusive-left, exclusive-right test as CheckCollisionPointRec
+    const float dx = point.x - originX;
+    const float dy = point.y - originY;
+    if (dx < 0.0f || dy < 0.0f) return -1;
+
+    const int column = static_cast<int>(dx / pitchX);
+    const int row    = static_cast<int>(dy / pitchY);
+    if (column >= columns || row >= rows) return -1;
+    if (dx - static_cast<float>(column) * pitchX >= cellWidth || dy - static_cast<float>(row) * pitchY >= cellHeight) return -1;  // In a gap
+
+    return row * columns + column;
+}
+
+void ButtonLayer::draw(const std::vector<Button>& buttons, const TextLayout& text, int hovered, bool isDarkMode, Color background) {
+    const ThemeColors& theme = isDarkMode ? darkTheme : lightTheme;
+
+    // Re-render the idle grid only when the theme changes
+    if (!layer.loaded() || isDarkMode != renderedDark) {
+        float left = 0.0f, top = 0.0f, right = 0.0f, bottom = 0.0f;
+        for (size_t i = 0; i < buttons.size(); ++i) {
+            const Rectangle& r = buttons[i].rect;
+            left               = i == 0 ? r.x : std::min(left, r.x);
+            top                = i == 0 ? r.y : std::min(top, r.y);
+            right              = i == 0 ? r.x + r.width : std::max(right, r.x + r.width);
+            bottom             = i == 0 ? r.y + r.height : std::max(bottom, r.y + r.height);
+        }
+        // Pad by a pixel so outlines on the right and bottom edges are kept
+        bounds = Rectangle{std::floor(left), std::floor(top), std::ceil(right - std::floor(left)) + 1.0f, std::ceil(bottom - std::floor(top)) + 1.0f};
+
+        layer.begin(static_cast<int>(bounds.width), static_cast<int>(bounds.height), background);
+        rlPushMatrix();
+        rlTranslatef(-bounds.x, -bounds.y, 0.0f);
+        for (const Button& btn : buttons) {
+            DrawButton(btn, text, theme, false, isDarkMode);
+        }
+        rlPopMatrix();
+        layer.end();
+        renderedDark = isDarkMode;
+    }
+
+    layer.draw(Vector2{bounds.x, bounds.y});
+
+    // Only the hovered button differs from the cached grid
+    if (hovered >= 0 && static_cast<size_t>(hovered) < buttons.size()) {
+        DrawButton(buttons[static_cast<size_t>(hovered)], text, theme, true, isDarkMode);
+    }
+}
@@ -3,47 +3,29 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdlib>
 #include <cstring>
-#include <iomanip>
-#include <sstream>
 
-#include "../includes/parser.h"
+#include "../includes/number_format.h"
 
-// Format a number for display, removing trailing zeros and decimal point if
-// needed
-std::string FormatNumber(double value, int precision = 10) {
-    // Handle special cases
-    if (std::isnan(value)) return "Error: NaN";
-    if (std::isinf(value)) return value > 0 ? "Infinity" : "-Infinity";
-
-    // Format with fixed precision
-    std::ostringstream oss;
-    oss << std::fixed << std::setprecision(precision) << value;
-    std::string result = oss.str();
-
-    // Remove trailing zeros
-    auto lastNonZero = result.find_last_not_of('0');
-    if (lastNonZero != std::string::npos) {
-        result.erase(lastNonZero + 1);
-    }
-
-    // Remove decimal point if it's the last character
-    if (!result.empty() && result.back() == '.') {
-        result.pop_back();
-    }
-
-    return result;
+std::string FormatNumber(double value, int precision) {
+    char buffer[numberBufferSize];
+    const size_t length = FormatNumberTo(value, precision, buffer);
+    return std::string(buffer, length);
 }
 
 // Handles all button press events and updates calculator state accordingly
 void HandleButtonPress(CalculatorState& state, int clicked) {
     static const std::array<std::string, 11> functions = {"sin(", "cos(", "tan(", "log(", "ln(", "exp(", "sqrt(", "hyp(", "asin(", "acos(", "atan("};
+    state.generation++;
+
     // Clear error state when any button is pressed
     if (state.errorState) {
         state.errorState = false;
         state.errorMessage.clear();
         state.display = "0";
         state.expression.clear();
+        state.input.clear();
     }
 
     std::string append;
@@ -60,6 +42,7 @@ void HandleButtonPress(CalculatorState& state, int clicked) {
         case '9': {
             if (state.justEvaluated) {
                 state.expression.clear();
+                state.input.clear();
                 state.display       = "0";
                 state.justEvaluated = false;
             }
@@ -86,6 +69,7 @@ void HandleButtonPress(CalculatorState& state, int clicked) {
             if (state.justEvaluated) {
                 state.expression    = FormatNumber(state.lastResult);
                 state.justEvaluated = false;
+                state.input.sync(state.expression);
             }
             append        = std::string(1, static_cast<char>(clicked));
             state.display = "0";
@@ -102,6 +86,7 @@ void HandleButtonPress(CalculatorState& state, int clicked) {
         }
         case 101: {  // C - Clear
             state.expression.clear();
+            state.input.clear();
             state.display    = "0";
             state.errorState = false;
             state.errorMessage.clear();
@@ -110,6 +95,7 @@ void HandleButtonPress(CalculatorState& state, int clicked) {
         case 102: {  // Backspace
             if (state.justEvaluated) {
                 state.expression.clear();
+                state.input.clear();
                 state.display    = "0";
                 state.errorState = false;
                 state.errorMessage.clear();
@@ -125,6 +111,7 @@ void HandleButtonPress(CalculatorState& state, int clicked) {
                 for (const auto& func : functions) {
                     if (state.expression.size() >= func.size() && state.expression.substr(state.expression.size() - func.size()) == func) {
                         state.expression.erase(state.expression.size() - func.size());
+                        state.input.erase(func.size());
                         found = true;
                         break;
                     }
@@ -133,6 +120,7 @@ void HandleButtonPress(CalculatorState& state, int clicked) {
                 // If not a function, remove the last character
                 if (!found) {
                     state.expression.pop_back();
+                    state.input.erase(1);
                 }
             }
 
@@ -152,6 +140,7 @@ void HandleButtonPress(CalculatorState& state, int clicked) {
                 state.display       = FormatNumber(state.lastResult);
                 state.expression    = state.display;
                 state.justEvaluated = false;
+                state.input.sync(state.expression);
                 return;
             }
 
@@ -160,6 +149,11 @@ void HandleButtonPress(CalculatorState& state, int clicked) {
             // Find where the last number starts
             size_t lastNumStart = 0;
             for (size_t i = state.expression.length() - 1; i != (size_t)-1; --i) {
+                // The sign of an exponent ("1e-7") belongs to the number
+                if ((state.expression[i] == '-' || state.expression[i] == '+') && i >= 2 && state.expression[i - 1] == 'e' &&
+                    strchr("0123456789.", state.expression[i - 2])) {
+                    continue;
+                }
                 if (strchr("()+-*/^", state.expression[i])) {
                     lastNumStart = i + 1;
                     break;
@@ -174,8 +168,12 @@ void HandleButtonPress(CalculatorState& state, int clicked) {
                 std::string positiveNum = lastNumStr.substr(2, lastNumStr.length() - 3);
                 state.expression.replace(lastNumStart, lastNumStr.length(), positiveNum);
                 state.display = positiveNum;
+                state.input.sync(state.expression);
             } else {  // Case 2: Number is not parenthesized. Toggle its sign.
-                double lastNum        = std::stod(lastNumStr);
+                char* parsed;
+                double lastNum = std::strtod(lastNumStr.c_str(), &parsed);
+                if (parsed != lastNumStr.c_str() + lastNumStr.size()) return;  // Not a complete number, e.g. "."
+
                 lastNum               = -lastNum;
                 std::string newNumStr = FormatNumber(lastNum);
 
@@ -190,6 +188,7 @@ void HandleButtonPress(CalculatorState& state, int clicked) {
 
                 state.expression.replace(lastNumStart, lastNumStr.length(), newNumStr);
                 state.display = FormatNumber(lastNum);
+                state.input.sync(state.expression);
             }
             return;
         }
@@ -206,6 +205,7 @@ void HandleButtonPress(CalculatorState& state, int clicked) {
         case 120: {
             if (state.justEvaluated) {
                 state.expression.clear();
+                state.input.clear();
                 state.justEvaluated = false;
             }
 
@@ -217,41 +217,42 @@ void HandleButtonPress(CalculatorState& state, int clicked) {
             break;
         }
         case '=': {
-            try {
-                if (state.expression.empty()) {
-                    state.display = "0";
-                    return;
-                }
-
-                auto evalExpr   = state.expression;
-                auto openParens = std::count(evalExpr.begin(), evalExpr.end(), '(') - std::count(evalExpr.begin(), evalExpr.end(), ')');
-                evalExpr.append(openParens, ')');
-
-                MathParser parser;
-                auto result    = *parser.evaluate(evalExpr);
-                auto resultStr = FormatNumber(result);
-
-                if (state.history.size() >= 5) {
-                    state.history.erase(state.history.begin());
-                }
-                state.history.push_back(state.expression + " = " + resultStr);
+            if (state.expression.empty()) {
+                state.display = "0";
+                return;
+            }
 
-                state.display       = resultStr;
-                state.expression    = resultStr;
-                state.lastResult    = result;
-                state.justEvaluated = true;
-            } catch (const std::exception& e) {
+            // The incremental parser already holds the value of a complete
+            // expression; anything else takes the full parse for its diagnostics
+            EvalResult result = state.input.isComplete() ? state.input.previewResult() : state.parser.evaluate(state.expression);
+            if (!result.ok()) {
                 state.display = "Error";
                 state.expression.clear();
+                state.input.clear();
                 state.errorState   = true;
-                state.errorMessage = e.what();
+                state.errorMessage = std::string("Calculation error: ") + result.message();
+                return;
             }
+
+            auto resultStr = FormatNumber(result.value);
+
+            if (state.history.size() >= 5) {
+                state.history.erase(state.history.begin());
+            }
+            state.history.push_back(state.expression + " = " + resultStr);
+
+            state.display       = resultStr;
+            state.expression    = resultStr;
+            state.lastResult    = result.value;
+            state.justEvaluated = true;
+            state.input.sync(state.expression);
             return;
         }
     }
 
     if (!append.empty()) {
         state.expression += append;
+        state.input.append(append);
         state.justEvaluated = false;
     }
 }
\ No newline at end of file
@@ -0,0 +1,286 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../includes/batch_evaluator.h"
+#include "../includes/incremental_parser.h"
+#include "../includes/number_format.h"
+#include "../includes/process_stats.h"
+#include "../includes/stream_evaluator.h"
+
+// Headless front end to the calculator core: one expression per input line,
+// one result per output line, so output lines up with input line for line.
+// Exit status is 0 if every expression evaluated, 1 if any failed and 2 on
+// usage or I/O errors
+
+static void PrintUsage(const char* program) {
+    std::fprintf(stderr,
+                 "Usage: %s [-p precision] [-j threads] [-c entries] [--chunk bytes] [--incremental | --batch expr] [--stats] [file ...]\n"
+                 "Evaluate one expression per line from the files (or stdin, or '-') and\n"
+                 "print one result per line. Failed lines print \"error: <message> at <offset>\".\n"
+                 "  -p N            digits after the decimal point (default 10)\n"
+                 "  -j N            evaluation threads (default: one per core)\n"
+                 "  -c N            cached results per thread for repeated lines (default 4096)\n"
+                 "  --chunk N       bytes read per chunk of work (default 1048576)\n"
+                 "  --incremental   type each line over the previous one through the GUI's\n"
+                 "                  incremental parser and print its live preview\n"
+                 "  --batch EXPR    evaluate EXPR once per line; a line holds the values of its\n"
+                 "                  variables in order of first appearance\n"
+                 "  --stats         report throughput, cache hits and peak memory on stderr\n",
+                 program);
+}
+
+// One line without its "\n" or "\r\n"; false once the input is exhausted
+static bool ReadLine(FILE* input, std::string& line) {
+    line.clear();
+    char buffer[4096];
+    bool any = false;
+    while (std::fgets(buffer, sizeof(buffer), input) != nullptr) {
+        any = true;
+        line += buffer;
+        if (line.back() == '\n') break;
+    }
+    if (!line.empty() && line.back() == '\n') line.pop_back();
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    return any;
+}
+
+static bool IsBlank(const std::string& line) { return line.find_first_not_of(" \t") == std::string::npos; }
+
+// Each line is typed over the previous one as in the GUI: the parser erases
+// back to the common prefix and feeds the rest, and the line's result is the
+// preview. Single-threaded, since every line builds on the last
+static bool RunIncremental(FILE* input, FILE* output, int precision, StreamStats& stats) {
+    IncrementalParser parser;
+    std::string line;
+    std::string out;
+    while (ReadLine(input, line)) {
+        stats.lines++;
+        stats.bytesRead += line.size() + 1;
+        out.clear();
+        if (IsBlank(line)) {
+            out += '\n';
+        } else {
+            parser.sync(line);
+            const EvalResult& result = parser.previewResult();
+            stats.expressions++;
+            if (!result.ok()) stats.failures++;
+            AppendResultLine(out, result, precision);
+        }
+        if (std::fwrite(out.data(), 1, out.size(), output) != out.size()) return false;
+    }
+    return !std::ferror(input);
+}
+
+// Evaluates expression over the input rows a block at a time through the
+// parallel batch evaluator. Points that hit a domain error come out as NaN;
+// rows with the wrong number of values print an error
+static bool RunBatch(const CompiledExpression& expression, ParallelBatchEvaluator& evaluator, FILE* input, FILE* output, int precision,
+                     StreamStats& stats) {
+    const size_t variableCount = expression.variableNames().size();
+    const size_t blockRows     = 65536;
+
+    std::vector<std::vector<double>> columns(variableCount);
+    std::vector<const double*> columnData(variableCount);
+    std::vector<char> rowKind;  // ' ' blank, 'v' values, 'x' malformed
+    std::vector<double> results;
+    std::vector<double> row;
+    std::string line;
+    std::string out;
+
+    bool atEnd = false;
+    while (!atEnd) {
+        for (std::vector<double>& column : columns) column.clear();
+        rowKind.clear();
+        size_t points = 0;
+
+        while (rowKind.size() < blockRows) {
+            if (!ReadLine(input, line)) {
+                atEnd = true;
+                break;
+            }
+            stats.lines++;
+            stats.bytesRead += line.size() + 1;
+            if (IsBlank(line)) {
+                rowKind.push_back(' ');
+                continue;
+            }
+
+            row.clear();
+            const char* cursor = line.c_str();
+            for (;;) {
+                char* end;
+                const double value = std::strtod(cursor, &end);
+                if (end == cursor) break;
+                row.push_back(value);
+                cursor = end;
+            }
+            const bool valid = IsBlank(cursor) && row.size() == variableCount;
+            rowKind.push_back(valid ? 'v' : 'x');
+            if (!valid) continue;
+
+            for (size_t i = 0; i < variableCount; ++i) columns[i].push_back(row[i]);
+            points++;
+        }
+
+        results.resize(points);
+        for (size_t i = 0; i < variableCount; ++i) columnData[i] = columns[i].data();
+        evaluator.evaluate(expression, variableCount > 0 ? columnData.data() : nullptr, points, results.data());
+
+        out.clear();
+        size_t point = 0;
+        for (char kind : rowKind) {
+            if (kind == ' ') {
+                out += '\n';
+                continue;
+            }
+            stats.expressions++;
+            if (kind == 'x') {
+                stats.failures++;
+                out += "error: expected " + std::to_string(variableCount) + " values\n";
+                continue;
+            }
+            const double value = results[point++];
+            if (value != value) stats.failures++;  // NaN
+            char buffer[numberBufferSize];
+            out.append(buffer, FormatNumberTo(value, precision, buffer));
+            out += '\n';
+        }
+        if (std::fwrite(out.data(), 1, out.size(), output) != out.size()) return false;
+    }
+    return !std::ferror(input);
+}
+
+int main(int argc, char** argv) {
+    int precision     = 10;
+    long threadCount  = 0;
+    long cacheSize    = 4096;
+    long chunkBytes   = 1 << 20;
+    bool showStats    = false;
+    bool incremental  = false;
+    const char* batch = nullptr;
+    std::vector<std::string> paths;
+
+    for (int i = 1; i < argc; ++i) {
+        const bool hasValue = i + 1 < argc;
+        if ((std::strcmp(argv[i], "-p") == 0 || std::strcmp(argv[i], "--precision") == 0) && hasValue) {
+            precision = std::atoi(argv[++i]);
+            if (precision < 0 || precision > 17) {
+                std::fprintf(stderr, "%s: precision must be between 0 and 17\n", argv[0]);
+                return 2;
+            }
+        } else if ((std::strcmp(argv[i], "-j") == 0 || std::strcmp(argv[i], "--threads") == 0) && hasValue) {
+            threadCount = std::atol(argv[++i]);
+            if (threadCount < 0) {
+                std::fprintf(stderr, "%s: thread count must not be negative\n", argv[0]);
+                return 2;
+            }
+        } else if ((std::strcmp(argv[i], "-c") == 0 || std::strcmp(argv[i], "--cache") == 0) && hasValue) {
+            cacheSize = std::atol(argv[++i]);
+            if (cacheSize < 0) {
+                std::fprintf(stderr, "%s: cache size must not be negative\n", argv[0]);
+                return 2;
+            }
+        } else if (std::strcmp(argv[i], "--chunk") == 0 && hasValue) {
+            chunkBytes = std::atol(argv[++i]);
+            if (chunkBytes <= 0) {
+                std::fprintf(stderr, "%s: chunk size must be positive\n", argv[0]);
+                return 2;
+            }
+        } else if (std::strcmp(argv[i], "--incremental") == 0) {
+            incremental = true;
+        } else if (std::strcmp(argv[i], "--batch") == 0 && hasValue) {
+            batch = argv[++i];
+        } else if (std::strcmp(argv[i], "--stats") == 0) {
+            showStats = true;
+        } else if (std::strcmp(argv[i], "-h") == 0 || std::strcmp(argv[i], "--help") == 0) {
+            PrintUsage(argv[0]);
+            return 0;
+        } else if (argv[i][0] == '-' && argv[i][1] != '\0') {
+            PrintUsage(argv[0]);
+            return 2;
+        } else {
+            paths.push_back(argv[i]);
+        }
+    }
+    if (paths.empty()) {
+        paths.push_back("-");
+    }
+    if (incremental && batch != nullptr) {
+        PrintUsage(argv[0]);
+        return 2;
+    }
+
+    // The batch expression is compiled once, before any input is read
+    CompiledExpression batchExpression;
+    std::unique_ptr<ParallelBatchEvaluator> batchEvaluator;
+    if (batch != nullptr) {
+        MathParser parser;
+        batchExpression = parser.compile(batch);
+        if (!batchExpression.ok()) {
+            std::fprintf(stderr, "%s: --batch: %s at %u\n", argv[0], errorMessage(batchExpression.error()), batchExpression.errorPosition());
+            return 2;
+        }
+        batchEvaluator.reset(new ParallelBatchEvaluator(static_cast<size_t>(threadCount)));
+    }
+
+    StreamEvaluator evaluator(static_cast<size_t>(threadCount), precision, static_cast<size_t>(chunkBytes), static_cast<size_t>(cacheSize));
+    const size_t threadsUsed = incremental ? 1 : batch != nullptr ? batchEvaluator->threadCount() : evaluator.threadCount();
+    StreamStats total;
+    int status = 0;
+
+    for (const std::string& path : paths) {
+        FILE* input = path == "-" ? stdin : std::fopen(path.c_str(), "rb");
+        if (input == nullptr) {
+            std::fprintf(stderr, "%s: cannot open %s\n", argv[0], path.c_str());
+            return 2;
+        }
+
+        StreamStats stats;
+        const auto start = std::chrono::steady_clock::now();
+        bool ok;
+        if (incremental) {
+            ok = RunIncremental(input, stdout, precision, stats);
+        } else if (batch != nullptr) {
+            ok = RunBatch(batchExpression, *batchEvaluator, input, stdout, precision, stats);
+        } else {
+            ok = evaluator.run(input, stdout, stats);
+        }
+        stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (input != stdin) std::fclose(input);
+        if (!ok) {
+            std::fprintf(stderr, "%s: I/O error while processing %s\n", argv[0], path.c_str());
+            return 2;
+        }
+
+        total.lines += stats.lines;
+        total.expressions += stats.expressions;
+        total.failures += stats.failures;
+        total.bytesRead += stats.bytesRead;
+        total.cacheHits += stats.cacheHits;
+        total.cacheMisses += stats.cacheMisses;
+        total.seconds += stats.seconds;
+        if (stats.failures > 0) status = 1;
+    }
+
+    if (std::fflush(stdout) != 0) {
+        std::fprintf(stderr, "%s: cannot write output\n", argv[0]);
+        return 2;
+    }
+
+    if (showStats) {
+        const double seconds = total.seconds > 0.0 ? total.seconds : 1e-9;
+        std::fprintf(stderr, "%zu expressions (%zu failed) in %.3f s on %zu threads: %.0f expr/s, %.1f MB/s, peak RSS %.1f MiB\n",
+                     total.expressions, total.failures, total.seconds, threadsUsed, total.expressions / seconds,
+                     total.bytesRead / seconds / 1e6, PeakRssBytes() / (1024.0 * 1024.0));
+        if (!incremental && batch == nullptr) {
+            std::fprintf(stderr, "cache: %zu hits, %zu misses (%zu entries per thread)\n", total.cacheHits, total.cacheMisses,
+                         static_cast<size_t>(cacheSize));
+        }
+    }
+    return status;
+}
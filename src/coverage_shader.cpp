@@ -0,0 +1,72 @@
+#include "../includes/coverage_shader.h"
+
+#include <string>
+
+#include "../raylib/src/rlgl.h"
+
+// Fragment stages matching raylib's default vertex shader outputs, for GLSL
+// 330 / 300 es and for GLSL 120 / 100
+static const char* const modernFragment =
+    "in vec2 fragTexCoord;\n"
+    "in vec4 fragColor;\n"
+    "out vec4 finalColor;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform vec4 colDiffuse;\n"
+    "void main() {\n"
+    "    vec4 texel = texture(texture0, fragTexCoord);\n"
+    "    finalColor = vec4(fragColor.rgb, fragColor.a*texel.r*texel.a)*colDiffuse;\n"
+    "}\n";
+
+static const char* const legacyFragment =
+    "varying vec2 fragTexCoord;\n"
+    "varying vec4 fragColor;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform vec4 colDiffuse;\n"
+    "void main() {\n"
+    "    vec4 texel = texture2D(texture0, fragTexCoord);\n"
+    "    gl_FragColor = vec4(fragColor.rgb, fragColor.a*texel.r*texel.a)*colDiffuse;\n"
+    "}\n";
+
+bool CoverageShader::load() {
+    unload();
+
+    std::string source;
+    switch (rlGetVersion()) {
+        case RL_OPENGL_33:
+        case RL_OPENGL_43:
+            source = std::string("#version 330\n") + modernFragment;
+            break;
+        case RL_OPENGL_ES_30:
+            source = std::string("#version 300 es\nprecision mediump float;\n") + modernFragment;
+            break;
+        case RL_OPENGL_21:
+            source = std::string("#version 120\n") + legacyFragment;
+            break;
+        case RL_OPENGL_ES_20:
+            source = std::string("#version 100\nprecision mediump float;\n") + legacyFragment;
+            break;
+        default:
+            return false;  // Fixed-function pipeline
+    }
+
+    // On failure raylib hands back its default shader, which loaded() rejects
+    shader = LoadShaderFromMemory(nullptr, source.c_str());
+    return loaded();
+}
+
+bool CoverageShader::loaded() const { return shader.id != 0 && shader.id != rlGetShaderIdDefault(); }
+
+void CoverageShader::begin(const Font& font) const {
+    if (needed(font)) BeginShaderMode(shader);
+}
+
+void CoverageShader::end(const Font& font) const {
+    if (needed(font)) EndShaderMode();
+}
+
+void CoverageShader::unload() {
+    if (shader.id != 0) {
+        UnloadShader(shader);  // Leaves raylib's default shader alone
+        shader = Shader{};
+    }
+}
@@ -1,71 +1,114 @@
 #include "../includes/display.h"
 
-Display::Display(Rectangle box, Font displayFont) : displayBox(box), font(displayFont), maxTextWidth(box.width - 40) {}
+Display::Display(Rectangle box, Font displayFont, const GlyphTable& glyphs, const CoverageShader* coverage)
+    : displayBox(box), font(displayFont), layout(displayFont, glyphs, coverage), maxTextWidth(box.width - 40) {}
 
-void Display::draw(const CalculatorState& calc, const Theme& theme, const std::string& perfInfo) {
-    // Get theme colors based on current mode
-    Color displayColor = theme.getDisplayColor(calc.isDarkMode);
-    Color textColor    = theme.getTextColor(calc.isDarkMode);
-    Color historyColor = theme.textHistory;
-    Color fadedColor   = theme.getFadedTextColor(calc.isDarkMode);
+void Display::updatePreview(const CalculatorState& calc) {
+    previewGeneration = calc.generation;
+    previewText.clear();
+    previewWidth = 0.0f;
 
-    // Draw display box with theme-appropriate color
-    DrawRectangleRec(displayBox, displayColor);
+    // Nothing to preview after '=', on errors, or while the expression is incomplete
+    if (calc.justEvaluated || calc.errorState || !calc.input.isComplete()) return;
 
-    // Use the expression as the main display, fallback to display string if
-    // empty
-    std::string mainDisplayString = calc.expression.empty() ? calc.display : calc.expression;
-    std::string dispToDraw        = truncateToFit(mainDisplayString, dispFontSize, maxTextWidth);
-    Vector2 dispSize              = MeasureTextEx(font, dispToDraw.c_str(), dispFontSize, 0);
+    std::string value = FormatNumber(calc.input.previewResult().value);
+    if (value == calc.expression) return;  // A bare number previews as itself
+
+    previewText  = truncateToFit("= " + value, exprFontSize, maxTextWidth);
+    previewWidth = layout.measure(previewText, exprFontSize).x;
+}
+
+void Display::renderFrame(const CalculatorState& calc, const Theme& theme) {
+    frameHistory = calc.history;
+    frameDark    = calc.isDarkMode;
+
+    frameLayer.begin(static_cast<int>(displayBox.width), static_cast<int>(displayBox.height), theme.getDisplayColor(calc.isDarkMode));
 
-    // Display history with optimized positioning
-    const float historyStartY     = displayBox.y + 10.0f;
+    // Display history with optimized positioning, in layer coordinates
+    const float historyStartY     = 10.0f;
     const float historyLineHeight = 25.0f;
-    const float historyX          = displayBox.x + 10.0f;
+    const float historyX          = 10.0f;
 
-    // Draw history entries
     float currentY = historyStartY;
+    layout.begin();
     for (std::vector<std::string>::const_iterator it = calc.history.begin(); it != calc.history.end(); ++it) {
-        DrawTextEx(font, it->c_str(), Vector2{historyX, currentY}, historyFontSize, 0, historyColor);
+        layout.draw(*it, Vector2{historyX, currentY}, historyFontSize, 0, theme.textHistory);
         currentY += historyLineHeight;
     }
+    layout.end();
+
+    frameLayer.end();
+}
+
+void Display::draw(const CalculatorState& calc, const Theme& theme, const std::string& perfInfo, const std::string& redrawInfo) {
+    // Get theme colors based on current mode
+    Color textColor  = theme.getTextColor(calc.isDarkMode);
+    Color fadedColor = theme.getFadedTextColor(calc.isDarkMode);
+
+    if (calc.generation != previewGeneration) {
+        updatePreview(calc);
+    }
+
+    // Draw the cached display box and history, refreshing them first if the
+    // theme changed or a button press altered the history
+    if (!frameLayer.loaded() || calc.isDarkMode != frameDark || (calc.generation != frameGeneration && calc.history != frameHistory)) {
+        renderFrame(calc, theme);
+    }
+    frameGeneration = calc.generation;
+    frameLayer.draw(Vector2{displayBox.x, displayBox.y});
+
+    // All text below shares one coverage shader switch
+    layout.begin();
+
+    // Use the expression as the main display, fallback to display string if
+    // empty
+    const std::string& mainDisplayString = calc.expression.empty() ? calc.display : calc.expression;
+    const std::string& dispToDraw        = truncateToFit(mainDisplayString, dispFontSize, maxTextWidth);
+    Vector2 dispSize                     = layout.measure(dispToDraw, dispFontSize);
 
     // Display error message if in error state
     if (calc.errorState && !calc.errorMessage.empty()) {
-        std::string errorToDraw = truncateToFit("Error: " + calc.errorMessage, exprFontSize, maxTextWidth);
+        const std::string& errorToDraw = truncateToFit("Error: " + calc.errorMessage, exprFontSize, maxTextWidth);
 
         float errorX = displayBox.x + 30.0f;
         float errorY = displayBox.y + displayBox.height - 60.0f;
-        DrawTextEx(font, errorToDraw.c_str(), Vector2{errorX, errorY}, exprFontSize, 0, RED);
+        layout.draw(errorToDraw, Vector2{errorX, errorY}, exprFontSize, 0, RED);
     }
 
-    // Calculate display position
-    const float dispX = displayBox.x + displayBox.width - dispSize.x - 30.0f;
-    const float dispY = displayBox.y + displayBox.height - dispSize.y - 30.0f;
+    // Calculate display position, leaving a line below for the preview
+    const float previewHeight = previewText.empty() ? 0.0f : exprFontSize;
+    const float dispX         = displayBox.x + displayBox.width - dispSize.x - 30.0f;
+    const float dispY         = displayBox.y + displayBox.height - dispSize.y - previewHeight - 30.0f;
 
     // Draw the display text
-    DrawTextEx(font, dispToDraw.c_str(), Vector2{dispX, dispY}, dispFontSize, 0, textColor);
+    layout.draw(dispToDraw, Vector2{dispX, dispY}, dispFontSize, 0, textColor);
 
-    // Display performance info only in debug builds
+    // Draw the provisional result under the expression
+    if (!previewText.empty()) {
+        const float previewX = displayBox.x + displayBox.width - previewWidth - 30.0f;
+        layout.draw(previewText, Vector2{previewX, dispY + dispSize.y}, exprFontSize, 0, fadedColor);
+    }
+
+    // Display performance info only in debug builds: frame times on one line,
+    // redraw savings below it, cut short of the mode indicator
 #ifndef RELEASE_BUILD
-    DrawTextEx(font, perfInfo.c_str(), Vector2{displayBox.x + 10.0f, displayBox.y + displayBox.height - 30.0f}, statusFontSize, 0, fadedColor);
+    const float statusX     = displayBox.x + 10.0f;
+    const float modeX       = displayBox.x + displayBox.width - 100.0f;
+    const float perfY       = displayBox.y + displayBox.height - 32.0f;
+    const float redrawY     = perfY + statusFontSize;
+    const float statusWidth = displayBox.width - 20.0f;
+
+    layout.draw(truncateToFit(perfInfo, statusFontSize, statusWidth), Vector2{statusX, perfY}, statusFontSize, 0, fadedColor);
+    layout.draw(truncateToFit(redrawInfo, statusFontSize, modeX - statusX - 10.0f), Vector2{statusX, redrawY}, statusFontSize, 0, fadedColor);
 
     // Display mode indicator
-    const char* modeText = calc.isDarkMode ? "Dark Mode" : "Light Mode";
-    DrawTextEx(font, modeText, Vector2{displayBox.x + displayBox.width - 100.0f, displayBox.y + displayBox.height - 30.0f}, statusFontSize, 0,
-               fadedColor);
+    const std::string modeText = calc.isDarkMode ? "Dark Mode" : "Light Mode";
+    layout.draw(modeText, Vector2{modeX, redrawY}, statusFontSize, 0, fadedColor);
 #endif
+
+    layout.end();
 }
 
-std::string Display::truncateToFit(const std::string& text, float fontSize, float maxWidth) const {
-    std::string result = text;
-    Vector2 size       = MeasureTextEx(font, result.c_str(), fontSize, 0);
-    while (size.x > maxWidth && result.length() > 1) {
-        result.erase(0, 1);
-        size = MeasureTextEx(font, result.c_str(), fontSize, 0);
-    }
-    if (result != text && result.length() > 1) {
-        result[0] = '.';
-    }
-    return result;
+const std::string& Display::truncateToFit(const std::string& text, float fontSize, float maxWidth) {
+    return layout.truncateToFit(text, fontSize, maxWidth);
 }
\ No newline at end of file
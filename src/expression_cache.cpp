@@ -0,0 +1,94 @@
+#include "../includes/expression_cache.h"
+
+#include <cctype>
+#include <vector>
+
+ExpressionCache::ExpressionCache(size_t capacity) : maxEntries(capacity) {}
+
+// Collapse each whitespace run to one space and drop leading and trailing
+// runs. The tokenizer only uses whitespace to separate tokens, so this keeps
+// the meaning ("1 2" stays two numbers). If offsets is given, it receives the
+// source offset of every character kept
+static std::string CollapseWhitespace(const std::string& expression, std::vector<uint32_t>* offsets) {
+    std::string collapsed;
+    collapsed.reserve(expression.size());
+
+    bool pendingSpace = false;
+    for (size_t i = 0; i < expression.size(); ++i) {
+        const char c = expression[i];
+        if (isspace(static_cast<unsigned char>(c))) {
+            pendingSpace = !collapsed.empty();
+            continue;
+        }
+        if (pendingSpace) {
+            collapsed.push_back(' ');
+            if (offsets != nullptr) offsets->push_back(static_cast<uint32_t>(i - 1));
+            pendingSpace = false;
+        }
+        collapsed.push_back(c);
+        if (offsets != nullptr) offsets->push_back(static_cast<uint32_t>(i));
+    }
+    return collapsed;
+}
+
+// Results are stored with error positions in key coordinates, so one entry
+// serves every spelling of the expression; map them back to what was typed
+static EvalResult ToSource(const std::string& expression, EvalResult result) {
+    if (result.ok()) return result;
+
+    std::vector<uint32_t> offsets;
+    CollapseWhitespace(expression, &offsets);
+    if (result.position < offsets.size()) {
+        result.position = offsets[result.position];
+    } else {
+        // At the end, or inside the parentheses the key closes
+        result.position = static_cast<uint32_t>(expression.size() + (result.position - offsets.size()));
+    }
+    return result;
+}
+
+EvalResult ExpressionCache::evaluate(const std::string& expression) {
+    std::string key = normalize(expression);
+
+    auto found = index.find(key);
+    if (found != index.end()) {
+        hitCount++;
+        entries.splice(entries.begin(), entries, found->second);
+        return ToSource(expression, found->second->second);
+    }
+    missCount++;
+
+    EvalResult result = parser.evaluate(key);
+    entries.emplace_front(key, result);
+    index[key] = entries.begin();
+    evictOverflow();
+    return ToSource(expression, result);
+}
+
+void ExpressionCache::clear() {
+    entries.clear();
+    index.clear();
+    hitCount  = 0;
+    missCount = 0;
+}
+
+std::string ExpressionCache::normalize(const std::string& expression) {
+    std::string normalized = CollapseWhitespace(expression, nullptr);
+
+    int openParens = 0;
+    for (char c : normalized) {
+        if (c == '(') openParens++;
+        if (c == ')') openParens--;
+    }
+    if (openParens > 0) {
+        normalized.append(static_cast<size_t>(openParens), ')');
+    }
+    return normalized;
+}
+
+void ExpressionCache::evictOverflow() {
+    while (entries.size() > maxEntries) {
+        index.erase(entries.back().first);
+        entries.pop_back();
+    }
+}
@@ -0,0 +1,207 @@
+#include "../includes/font_cache.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#include "../includes/content_hash.h"
+
+// On-disk layout: a header, one record per glyph, then the atlas pixels, all
+// in host byte order. A header that does not match byte for byte is a miss
+struct CacheHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t glyphCount;
+    uint64_t key;
+    int32_t baseSize;
+    int32_t glyphPadding;
+    int32_t width;
+    int32_t height;
+    int32_t format;
+    uint32_t pixelBytes;
+};
+
+struct CacheGlyph {
+    int32_t value;
+    int32_t offsetX;
+    int32_t offsetY;
+    int32_t advanceX;
+    float x;
+    float y;
+    float width;
+    float height;
+};
+
+static_assert(sizeof(CacheHeader) == 48 && sizeof(CacheGlyph) == 32, "atlas cache records must not contain padding");
+
+static const char cacheMagic[8]    = {'C', 'A', 'L', 'C', 'F', 'N', 'T', '\0'};
+static const uint32_t cacheVersion = 1;
+
+// What LoadFontEx(fileName, fontSize, 0, 0) rasterizes: ASCII 32..126, with
+// raylib's FONT_TTF_DEFAULT_CHARS_PADDING around each glyph
+static const int defaultGlyphCount   = 95;
+static const int defaultGlyphPadding = 4;
+
+// Everything the rasterized atlas depends on: the font file's bytes, the pixel
+// size and the raylib version that bundles stb_truetype and the packer
+static uint64_t CacheKey(const unsigned char* fileData, size_t dataSize, int fontSize) {
+    const int32_t size = fontSize;
+    uint64_t hash      = Fnv1a(fileData, dataSize);
+    hash               = Fnv1a(&size, sizeof(size), hash);
+    return Fnv1a(RAYLIB_VERSION, sizeof(RAYLIB_VERSION) - 1, hash);
+}
+
+// Write to a temporary file and rename it over the cache, so an interrupted
+// run never leaves a truncated cache behind
+static bool WriteCacheFile(const std::string& path, const std::vector<unsigned char>& contents) {
+    const std::string temporary = path + ".tmp";
+    FILE* file                  = std::fopen(temporary.c_str(), "wb");
+    if (file == nullptr) return false;
+
+    const bool written = std::fwrite(contents.data(), 1, contents.size(), file) == contents.size();
+    if (std::fclose(file) != 0 || !written) {
+        std::remove(temporary.c_str());
+        return false;
+    }
+
+    std::remove(path.c_str());  // rename does not replace an existing file on Windows
+    if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+        std::remove(temporary.c_str());
+        return false;
+    }
+    return true;
+}
+
+FontAtlasCache::~FontAtlasCache() { reset(); }
+
+void FontAtlasCache::reset() {
+    if (font.glyphs != nullptr) RL_FREE(font.glyphs);
+    if (font.recs != nullptr) RL_FREE(font.recs);
+    font     = Font{};
+    image    = Image{};
+    cacheHit = false;
+    mapping.close();
+    built.clear();
+}
+
+std::string FontAtlasCache::pathFor(const char* fileName, int fontSize) { return std::string(fileName) + "." + std::to_string(fontSize) + ".atlas"; }
+
+bool FontAtlasCache::load(const char* fileName, int fontSize) {
+    reset();
+
+    MappedFile source;
+    if (!source.open(fileName)) return false;
+    const uint64_t key     = CacheKey(source.data(), source.size(), fontSize);
+    const std::string path = pathFor(fileName, fontSize);
+
+    if (mapping.open(path.c_str()) && parse(mapping.data(), mapping.size(), key)) {
+        cacheHit = true;
+        return true;
+    }
+    mapping.close();  // Stale or missing; Windows cannot replace a mapped file
+
+    if (!rasterize(source.data(), source.size(), fontSize, key)) return false;
+    if (!WriteCacheFile(path, built)) {
+        TraceLog(LOG_WARNING, "FONT: [%s] Failed to write atlas cache %s", fileName, path.c_str());
+    }
+    return true;
+}
+
+Font FontAtlasCache::takeFont() {
+    Font taken = font;
+    font       = Font{};
+    return taken;
+}
+
+bool FontAtlasCache::parse(const unsigned char* data, size_t size, uint64_t key) {
+    CacheHeader header;
+    if (size < sizeof(header)) return false;
+    std::memcpy(&header, data, sizeof(header));
+
+    if (std::memcmp(header.magic, cacheMagic, sizeof(cacheMagic)) != 0 || header.version != cacheVersion || header.key != key) return false;
+    if (header.glyphCount == 0 || header.width <= 0 || header.height <= 0) return false;
+    if (static_cast<int>(header.pixelBytes) != GetPixelDataSize(header.width, header.height, header.format)) return false;
+
+    const size_t glyphBytes = header.glyphCount * sizeof(CacheGlyph);
+    if (size != sizeof(header) + glyphBytes + header.pixelBytes) return false;
+
+    // Glyph images stay empty, as for the embedded font; drawing only needs the atlas
+    const int count   = static_cast<int>(header.glyphCount);
+    font.baseSize     = header.baseSize;
+    font.glyphCount   = count;
+    font.glyphPadding = header.glyphPadding;
+    font.glyphs       = static_cast<GlyphInfo*>(RL_CALLOC(count, sizeof(GlyphInfo)));
+    font.recs         = static_cast<Rectangle*>(RL_MALLOC(count * sizeof(Rectangle)));
+
+    const unsigned char* record = data + sizeof(header);
+    for (int i = 0; i < count; ++i, record += sizeof(CacheGlyph)) {
+        CacheGlyph glyph;
+        std::memcpy(&glyph, record, sizeof(glyph));
+        font.glyphs[i].value    = glyph.value;
+        font.glyphs[i].offsetX  = glyph.offsetX;
+        font.glyphs[i].offsetY  = glyph.offsetY;
+        font.glyphs[i].advanceX = glyph.advanceX;
+        font.recs[i]            = {glyph.x, glyph.y, glyph.width, glyph.height};
+    }
+
+    // The pixels are used in place; upload copies them to the GPU
+    image = {const_cast<unsigned char*>(record), header.width, header.height, 1, header.format};
+    return true;
+}
+
+bool FontAtlasCache::rasterize(const unsigned char* fileData, size_t dataSize, int fontSize, uint64_t key) {
+    GlyphInfo* glyphs = LoadFontData(fileData, static_cast<int>(dataSize), fontSize, nullptr, defaultGlyphCount, FONT_DEFAULT);
+    if (glyphs == nullptr) return false;
+
+    Rectangle* recs  = nullptr;
+    Image atlasImage = GenImageFontAtlas(glyphs, &recs, defaultGlyphCount, fontSize, defaultGlyphPadding, 0);
+    if (atlasImage.data == nullptr || recs == nullptr) {
+        UnloadImage(atlasImage);
+        RL_FREE(recs);
+        UnloadFontData(glyphs, defaultGlyphCount);
+        return false;
+    }
+
+    CacheHeader header = {};
+    std::memcpy(header.magic, cacheMagic, sizeof(cacheMagic));
+    header.version      = cacheVersion;
+    header.glyphCount   = defaultGlyphCount;
+    header.key          = key;
+    header.baseSize     = fontSize;
+    header.glyphPadding = defaultGlyphPadding;
+    header.width        = atlasImage.width;
+    header.height       = atlasImage.height;
+    header.format       = atlasImage.format;
+    header.pixelBytes   = static_cast<uint32_t>(GetPixelDataSize(atlasImage.width, atlasImage.height, atlasImage.format));
+
+    built.resize(sizeof(header) + defaultGlyphCount * sizeof(CacheGlyph) + header.pixelBytes);
+    unsigned char* out = built.data();
+    std::memcpy(out, &header, sizeof(header));
+    out += sizeof(header);
+    for (int i = 0; i < defaultGlyphCount; ++i, out += sizeof(CacheGlyph)) {
+        const CacheGlyph glyph = {glyphs[i].value, glyphs[i].offsetX, glyphs[i].offsetY, glyphs[i].advanceX, recs[i].x, recs[i].y, recs[i].width, recs[i].height};
+        std::memcpy(out, &glyph, sizeof(glyph));
+    }
+    std::memcpy(out, atlasImage.data, header.pixelBytes);
+
+    UnloadImage(atlasImage);
+    RL_FREE(recs);
+    UnloadFontData(glyphs, defaultGlyphCount);
+
+    // Read back through the same path a warm load takes
+    return parse(built.data(), built.size(), key);
+}
+
+Font LoadFontCached(const char* fileName, int fontSize) {
+    const auto start = std::chrono::steady_clock::now();
+
+    FontAtlasCache cache;
+    if (!cache.load(fileName, fontSize)) return LoadFontEx(fileName, fontSize, nullptr, 0);
+
+    Font font    = cache.takeFont();
+    font.texture = LoadTextureFromImage(cache.atlas());
+
+    const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    TraceLog(LOG_INFO, "FONT: [%s] Atlas %s in %.1f ms", fileName, cache.hit() ? "loaded from cache" : "rasterized and cached", ms);
+    return font;
+}
@@ -0,0 +1,32 @@
+#include "../includes/glyph_table.h"
+
+GlyphTable GlyphTable::build(const Font& font) {
+    GlyphTable table;
+    for (int c = 0; c < 128; ++c) {
+        table.index[c] = -1;
+    }
+
+    // Walk backwards so the first glyph for a codepoint wins, as in
+    // GetGlyphIndex, whose fallback for a miss is the last '?' it scanned
+    int fallback     = 0;
+    bool hasFallback = false;
+    if (IsFontValid(font)) {
+        for (int i = font.glyphCount - 1; i >= 0; --i) {
+            int codepoint = font.glyphs[i].value;
+            if (codepoint >= 0 && codepoint < 128) {
+                table.index[codepoint] = i;
+            }
+            if (codepoint == '?' && !hasFallback) {
+                fallback    = i;
+                hasFallback = true;
+            }
+        }
+    }
+
+    for (int c = 0; c < 128; ++c) {
+        if (table.index[c] < 0) {
+            table.index[c] = fallback;
+        }
+    }
+    return table;
+}
@@ -0,0 +1,31 @@
+// Platform backend for raylib without a window, for tools that only load,
+// rasterize and export fonts and images. rcore.c compiled without a PLATFORM_*
+// define leaves these functions to a custom backend; here InitWindow fails,
+// so no OpenGL context or windowing library (GLFW, X11, Win32) is involved
+#include "../raylib/src/raylib.h"
+
+#include <time.h>
+
+int InitPlatform(void) {
+    TraceLog(LOG_WARNING, "PLATFORM: Headless build, no window can be created");
+    return -1;
+}
+
+void ClosePlatform(void) {}
+
+double GetTime(void) { return (double)clock() / CLOCKS_PER_SEC; }
+
+Vector2 GetWindowScaleDPI(void) { return (Vector2){1.0f, 1.0f}; }
+
+void SetWindowSize(int width, int height) {
+    (void)width;
+    (void)height;
+}
+
+void MaximizeWindow(void) {}
+
+void MinimizeWindow(void) {}
+
+void SwapScreenBuffer(void) {}
+
+void PollInputEvents(void) {}
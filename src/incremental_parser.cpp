@@ -0,0 +1,309 @@
+#include "../includes/incremental_parser.h"
+
+#include <cctype>
+#include <cstdlib>
+
+static bool isNumberChar(char c) { return isdigit(static_cast<unsigned char>(c)) || c == '.'; }
+
+// Whether c continues the literal typed so far: digits and '.', then an
+// exponent 'e' with an optional sign right after it. A literal left ending in
+// 'e' or its sign fails to parse, as "2e" does in MathParser
+static bool continuesNumber(const char* literal, size_t length, char c) {
+    const char* exponent = nullptr;
+    for (size_t i = 0; i < length; ++i) {
+        if (literal[i] == 'e' || literal[i] == 'E') exponent = literal + i;
+    }
+    if (isdigit(static_cast<unsigned char>(c))) return true;
+    if (exponent == nullptr) return c == '.' || c == 'e' || c == 'E';
+    return (c == '+' || c == '-') && exponent == literal + length - 1;
+}
+
+// Parses source[begin, end) as a complete decimal literal
+static bool parseLiteral(const std::string& source, size_t begin, size_t end, double& value) {
+    std::string literal = source.substr(begin, end - begin);
+    char* parsed;
+    value = std::strtod(literal.c_str(), &parsed);
+    return !literal.empty() && parsed == literal.c_str() + literal.size();
+}
+
+IncrementalParser::IncrementalParser() { clear(); }
+
+void IncrementalParser::append(const std::string& text) {
+    for (char c : text) {
+        feed(c);
+    }
+    refreshPreview();
+}
+
+void IncrementalParser::erase(size_t count) {
+    for (; count > 0 && !checkpoints.empty(); --count) {
+        const Checkpoint& checkpoint = checkpoints.back();
+
+        // Replay the journal backwards to the state before this character
+        while (journal.size() > checkpoint.journalSize) {
+            const Change& change = journal.back();
+            switch (change.kind) {
+                case Change::PushValue:
+                    values.pop_back();
+                    break;
+                case Change::PopValue:
+                    values.push_back(change.value);
+                    break;
+                case Change::PushOp:
+                    ops.pop_back();
+                    break;
+                case Change::PopOp:
+                    ops.push_back(change.op);
+                    break;
+            }
+            journal.pop_back();
+        }
+
+        state = checkpoint.scalars;
+        checkpoints.pop_back();
+        source.pop_back();
+    }
+    refreshPreview();
+}
+
+void IncrementalParser::sync(const std::string& expression) {
+    size_t common = 0;
+    while (common < source.size() && common < expression.size() && source[common] == expression[common]) {
+        common++;
+    }
+    if (common < source.size()) {
+        erase(source.size() - common);
+    }
+    if (common < expression.size()) {
+        append(expression.substr(common));
+    }
+}
+
+void IncrementalParser::clear() {
+    source.clear();
+    values.clear();
+    ops.clear();
+    journal.clear();
+    checkpoints.clear();
+    state = Scalars{Lexeme::None, 0, true, 0, EvalError::None, 0};
+    refreshPreview();
+}
+
+void IncrementalParser::feed(char c) {
+    checkpoints.push_back(Checkpoint{journal.size(), state});
+    source.push_back(c);
+    const uint32_t position = static_cast<uint32_t>(source.size() - 1);
+
+    // Parenthesis balance is tracked even after an error
+    if (c == '(') state.parenDepth++;
+    if (c == ')') state.parenDepth--;
+    if (state.error != EvalError::None) return;
+
+    // Extend the literal or name being typed
+    if (state.lexeme == Lexeme::Number && continuesNumber(source.c_str() + state.tokenStart, source.size() - 1 - state.tokenStart, c)) return;
+    if (state.lexeme == Lexeme::Identifier && isalpha(static_cast<unsigned char>(c))) return;
+    if (state.lexeme != Lexeme::None && !finishLexeme(c)) return;
+
+    if (isspace(static_cast<unsigned char>(c))) return;
+
+    if (isNumberChar(c) || isalpha(static_cast<unsigned char>(c))) {
+        if (!state.expectOperand) {
+            fail(EvalError::InvalidExpression, position);
+            return;
+        }
+        state.lexeme     = isNumberChar(c) ? Lexeme::Number : Lexeme::Identifier;
+        state.tokenStart = position;
+        return;
+    }
+
+    if (c == '(') {
+        if (!state.expectOperand) {
+            fail(EvalError::InvalidExpression, position);
+            return;
+        }
+        pushOp(StackOp{Pending::LeftParen, OpCode::PushConst});
+        return;
+    }
+
+    if (c == ')') {
+        if (state.expectOperand) {
+            fail(EvalError::InvalidExpression, position);
+            return;
+        }
+        while (!ops.empty() && ops.back().kind != Pending::LeftParen) {
+            if (!reduceTop()) return;
+        }
+        if (ops.empty()) {
+            fail(EvalError::MismatchedParentheses, position);
+            return;
+        }
+        popOp();
+        if (!ops.empty() && ops.back().kind == Pending::Function) {
+            reduceTop();
+        }
+        return;
+    }
+
+    const OperatorInfo* info = findOperator(&c, 1);
+    if (info == nullptr) {
+        fail(EvalError::UnexpectedCharacter, position);
+    } else if (state.expectOperand) {
+        // Only minus may start an operand
+        if (c == '-') {
+            pushOp(StackOp{Pending::Operator, OpCode::Neg});
+        } else {
+            fail(EvalError::InvalidExpression, position);
+        }
+    } else {
+        pushOperator(StackOp{Pending::Operator, info->code});
+        state.expectOperand = true;
+    }
+}
+
+bool IncrementalParser::finishLexeme(char next) {
+    const size_t end   = source.size() - 1;  // The character that ended the lexeme
+    const Lexeme ended = state.lexeme;
+    state.lexeme       = Lexeme::None;
+
+    if (ended == Lexeme::Number) {
+        double value;
+        if (!parseLiteral(source, state.tokenStart, end, value)) {
+            fail(EvalError::InvalidNumber, state.tokenStart);
+            return false;
+        }
+        pushValue(value);
+        state.expectOperand = false;
+        return true;
+    }
+
+    // Function names must be followed directly by their '('
+    const OperatorInfo* info = findOperator(source.c_str() + state.tokenStart, end - state.tokenStart);
+    if (info == nullptr || info->arity != 1) {
+        fail(EvalError::UnboundVariable, state.tokenStart);
+        return false;
+    }
+    if (next != '(') {
+        fail(EvalError::InvalidFunctionCall, state.tokenStart);
+        return false;
+    }
+    pushOp(StackOp{Pending::Function, info->code});
+    return true;
+}
+
+void IncrementalParser::pushOperator(StackOp op) {
+    const OperatorInfo& info = operatorInfo(op.op);
+    while (!ops.empty() && ops.back().kind == Pending::Operator) {
+        const OperatorInfo& top = operatorInfo(ops.back().op);
+        if (top.precedence < info.precedence || (top.precedence == info.precedence && info.associativity == Associativity::Right)) {
+            break;
+        }
+        if (!reduceTop()) return;
+    }
+    pushOp(op);
+}
+
+bool IncrementalParser::reduceTop() {
+    const OperatorInfo& info = operatorInfo(ops.back().op);
+    if (values.size() < info.arity) {
+        fail(EvalError::InvalidExpression, static_cast<uint32_t>(source.size() - 1));
+        return false;
+    }
+
+    double args[2];
+    for (size_t i = info.arity; i > 0; --i) {
+        args[i - 1] = popValue();
+    }
+    popOp();
+
+    double result;
+    EvalError error = info.apply(args, result);
+    if (error != EvalError::None) {
+        fail(error, static_cast<uint32_t>(source.size() - 1));
+        return false;
+    }
+    pushValue(result);
+    return true;
+}
+
+void IncrementalParser::fail(EvalError error, uint32_t position) {
+    state.error         = error;
+    state.errorPosition = position;
+}
+
+void IncrementalParser::refreshPreview() {
+    if (state.error != EvalError::None) {
+        preview = EvalResult::failure(state.error, state.errorPosition);
+        return;
+    }
+    if (source.empty()) {
+        preview = EvalResult::failure(EvalError::EmptyExpression, 0);
+        return;
+    }
+
+    previewValues.assign(values.begin(), values.end());
+
+    // Complete whatever is still being typed
+    if (state.lexeme == Lexeme::Number) {
+        double value;
+        if (!parseLiteral(source, state.tokenStart, source.size(), value)) {
+            preview = EvalResult::failure(EvalError::InvalidNumber, state.tokenStart);
+            return;
+        }
+        previewValues.push_back(value);
+    } else if (state.lexeme == Lexeme::Identifier) {
+        const OperatorInfo* info = findOperator(source.c_str() + state.tokenStart, source.size() - state.tokenStart);
+        preview = EvalResult::failure(info != nullptr && info->arity == 1 ? EvalError::InvalidFunctionCall : EvalError::UnboundVariable,
+                                      state.tokenStart);
+        return;
+    } else if (state.expectOperand) {
+        preview = EvalResult::failure(EvalError::InvalidExpression, static_cast<uint32_t>(source.size()));
+        return;
+    }
+
+    // Apply the pending operators as if every open parenthesis were closed
+    for (size_t i = ops.size(); i > 0; --i) {
+        const StackOp& op = ops[i - 1];
+        if (op.kind == Pending::LeftParen) continue;
+
+        const OperatorInfo& info = operatorInfo(op.op);
+        if (previewValues.size() < info.arity) {
+            preview = EvalResult::failure(EvalError::InvalidExpression, static_cast<uint32_t>(source.size()));
+            return;
+        }
+        double* args = &previewValues[previewValues.size() - info.arity];
+        double result;
+        EvalError error = info.apply(args, result);
+        if (error != EvalError::None) {
+            preview = EvalResult::failure(error, static_cast<uint32_t>(source.size()));
+            return;
+        }
+        previewValues.resize(previewValues.size() - info.arity);
+        previewValues.push_back(result);
+    }
+
+    preview = previewValues.empty() ? EvalResult::failure(EvalError::EmptyExpression, 0) : EvalResult::success(previewValues.back());
+}
+
+void IncrementalParser::pushValue(double value) {
+    values.push_back(value);
+    journal.push_back(Change{Change::PushValue, 0.0, StackOp()});
+}
+
+double IncrementalParser::popValue() {
+    double value = values.back();
+    values.pop_back();
+    journal.push_back(Change{Change::PopValue, value, StackOp()});
+    return value;
+}
+
+void IncrementalParser::pushOp(StackOp op) {
+    ops.push_back(op);
+    journal.push_back(Change{Change::PushOp, 0.0, StackOp()});
+}
+
+IncrementalParser::StackOp IncrementalParser::popOp() {
+    StackOp op = ops.back();
+    ops.pop_back();
+    journal.push_back(Change{Change::PopOp, 0.0, op});
+    return op;
+}
@@ -1,23 +1,35 @@
+#include <chrono>
 #include <string>
 #include <vector>
 
 #include "../includes/button.h"
 #include "../includes/calculator.h"
+#include "../includes/coverage_shader.h"
 #include "../includes/display.h"
 #include "../includes/embedded_resources.h"
 #ifndef RELEASE_BUILD
+#include "../includes/font_cache.h"
 #include "../includes/metrics.h"
 #endif
+#include "../includes/process_stats.h"
 #include "../includes/theme.h"
 #include "../raylib/src/raylib.h"
+#ifndef RELEASE_BUILD
+// raylib's event wait has no timeout, which the debug overlay refresh needs
+#define GLFW_INCLUDE_NONE
+#include "../raylib/src/external/glfw/include/GLFW/glfw3.h"
+#endif
 
 // Forward declarations
 std::vector<Button> CreateButtons(int btnW, int btnH, int margin, int topOffset, int leftOffset, const Font& font);
 
 int main() {
+    const auto launchTime = std::chrono::steady_clock::now();
+    const int targetFps   = 60;
+
     // Initialize performance metrics (debug builds only)
 #ifndef RELEASE_BUILD
-    PerformanceMetrics metrics;
+    PerformanceMetrics metrics(targetFps);
 #endif
 
     // UI layout parameters
@@ -37,19 +49,38 @@ int main() {
     const int screenHeight = calculatorHeight + 2 * buttonSpacing;
     InitWindow(screenWidth, screenHeight, "Scientific Calculator");
 
+    // Draws the embedded single-channel font atlas; without it the atlas is
+    // expanded to gray+alpha at load time
+    CoverageShader coverage;
+    coverage.load();
+
 // Load embedded resources instead of from files
 #ifdef RELEASE_BUILD
     // Use embedded resources in release mode
+    GlyphTable glyphs;
     Image icon = LoadEmbeddedIcon();
-    Font font  = LoadEmbeddedFont();
+    Font font  = LoadEmbeddedFont(&glyphs, coverage.loaded());
 #else
-    // Use file resources in debug mode
-    Image icon = LoadImage("resource/calc.png");
-    Font font  = LoadFontEx("resource/Ubuntu-Regular.ttf", 64, 0, 0);
+    // Use file resources in debug mode; the rasterized atlas is cached next
+    // to the font, so only the first launch pays for stb_truetype
+    Image icon        = LoadImage("resource/calc.png");
+    Font font         = LoadFontCached("resource/Ubuntu-Regular.ttf", 64);
+    GlyphTable glyphs = GlyphTable::build(font);
 #endif
 
     SetWindowIcon(icon);
-    SetTargetFPS(60);
+    SetTargetFPS(targetFps);
+
+#ifdef RELEASE_BUILD
+    // Sleep in EndDrawing/PollInputEvents until input arrives instead of
+    // spinning at the target FPS; the frame cap still applies while busy
+    EnableEventWaiting();
+#else
+    // The debug overlay shows live timings, so the idle wait below also
+    // wakes once per refresh interval to redraw it
+    const double overlayRefresh = 1.0;
+    double overlayDrawnAt       = 0.0;
+#endif
     SetTextureFilter(font.texture, TEXTURE_FILTER_BILINEAR);
 
     // Calculate offsets
@@ -62,6 +93,9 @@ int main() {
     // Calculator state and button setup
     CalculatorState calc;
     std::vector<Button> buttons = CreateButtons(btnW, buttonHeight, buttonSpacing, topOffset, leftOffset, font);
+    bool buttonsDark            = calc.isDarkMode;
+    ApplyButtonTheme(buttons, buttonsDark);
+    const ButtonHitIndex hitIndex(buttons);
 
     // Initialize theme
     Theme theme;
@@ -73,35 +107,63 @@ int main() {
     const Rectangle displayBox = {static_cast<float>(displayBoxX), static_cast<float>(displayBoxY), static_cast<float>(displayBoxWidth),
                                   static_cast<float>(displayBoxHeight)};
 
-    // Initialize display
-    Display display(displayBox, font);
+    // Initialize display and the cached button grid
+    Display display(displayBox, font, glyphs, &coverage);
+    ButtonLayer buttonLayer;
+    const TextLayout buttonText(font, glyphs, &coverage);
 
-    while (!WindowShouldClose()) {
-        // Start frame timing for performance metrics (debug builds only)
-#ifndef RELEASE_BUILD
-        metrics.startFrame();
-#endif
+    // What the last drawn frame showed; the first frame is always drawn
+    bool hasDrawn            = false;
+    uint64_t drawnGeneration = 0;
+    int drawnHover           = -1;
+    bool drawnFocus          = false;
+    bool startupReported     = false;
 
-        Vector2 mouse = GetMousePosition();
-        int clicked   = -1;
+    while (!WindowShouldClose()) {
+        // Resolve the button under the mouse once; clicks and hover share it
+        const int hovered = hitIndex.find(GetMousePosition());
 
-        // Only check for button clicks if mouse button is pressed
-        // (optimization)
         if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-            // Detect button click - only check buttons that could be under the
-            // mouse
-            for (const Button& btn : buttons) {
-                if (CheckCollisionPointRec(mouse, btn.rect)) {
-                    clicked = btn.id;
-                    break;
+            // Handle button press logic
+            if (hovered != -1) {
+                HandleButtonPress(calc, buttons[static_cast<size_t>(hovered)].id);
+
+                // Re-resolve button colors only when the theme was toggled
+                if (calc.isDarkMode != buttonsDark) {
+                    ApplyButtonTheme(buttons, calc.isDarkMode);
+                    buttonsDark = calc.isDarkMode;
                 }
             }
+        }
 
-            // Handle button press logic
-            if (clicked != -1) {
-                HandleButtonPress(calc, clicked);
-            }
+        // Redraw only when the state, the hovered button or the window changed;
+        // otherwise just wait for the next event
+        const bool focused = IsWindowFocused();
+        bool unchanged     = hasDrawn && calc.generation == drawnGeneration && hovered == drawnHover && focused == drawnFocus && !IsWindowResized();
+#ifndef RELEASE_BUILD
+        const double now = GetTime();
+        unchanged        = unchanged && now - overlayDrawnAt < overlayRefresh;
+#endif
+        if (unchanged) {
+#ifndef RELEASE_BUILD
+            metrics.skipFrame();
+            glfwWaitEventsTimeout(overlayDrawnAt + overlayRefresh - now);
+#endif
+            PollInputEvents();
+            continue;
         }
+#ifndef RELEASE_BUILD
+        overlayDrawnAt = now;
+#endif
+        hasDrawn        = true;
+        drawnGeneration = calc.generation;
+        drawnHover      = hovered;
+        drawnFocus      = focused;
+
+        // Start frame timing for performance metrics (debug builds only)
+#ifndef RELEASE_BUILD
+        metrics.startFrame();
+#endif
 
         // Get background color for clearing the screen
         Color bgColor = theme.getBackgroundColor(calc.isDarkMode);
@@ -111,13 +173,13 @@ int main() {
 
         // Draw the calculator display
 #ifndef RELEASE_BUILD
-        display.draw(calc, theme, metrics.getPerformanceInfo());
+        display.draw(calc, theme, metrics.getPerformanceInfo(), metrics.getRedrawInfo());
 #else
-        display.draw(calc, theme, "");
+        display.draw(calc, theme, "", "");
 #endif
 
         // Draw calculator buttons
-        DrawButtons(buttons, font, mouse, calc.isDarkMode);
+        buttonLayer.draw(buttons, buttonText, hovered, calc.isDarkMode, bgColor);
 
         // End frame timing and update metrics (debug builds only)
 #ifndef RELEASE_BUILD
@@ -125,10 +187,26 @@ int main() {
 #endif
 
         EndDrawing();
+
+        // Startup cost as seen by the user: launch to first presented frame
+        if (!startupReported) {
+            const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - launchTime).count();
+            TraceLog(LOG_INFO, "STARTUP: First frame after %.1f ms, peak RSS %.1f MiB", ms, PeakRssBytes() / (1024.0 * 1024.0));
+            startupReported = true;
+        }
     }
     // Unload resources
+    buttonLayer.unload();
+    display.unload();
+    coverage.unload();
+#ifdef RELEASE_BUILD
+    // The icon pixels and glyph tables are linked-in data; only the atlas
+    // texture was allocated, unless loading fell back to the default font
+    if (font.texture.id != GetFontDefault().texture.id) UnloadTexture(font.texture);
+#else
     UnloadImage(icon);
     UnloadFont(font);
+#endif
     CloseWindow();
     return 0;
 }
\ No newline at end of file
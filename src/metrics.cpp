@@ -2,6 +2,11 @@
 
 #include <cstdio>
 
+#include "../includes/process_stats.h"
+
+PerformanceMetrics::PerformanceMetrics(int targetFps)
+    : targetFps(targetFps), startTime(std::chrono::high_resolution_clock::now()), startCpu(ProcessCpuSeconds()) {}
+
 void PerformanceMetrics::startFrame() { frameStart = std::chrono::high_resolution_clock::now(); }
 
 void PerformanceMetrics::endFrame() {
@@ -13,14 +18,35 @@ void PerformanceMetrics::endFrame() {
     avgFrameTime = avgFrameTime + (frameTime - avgFrameTime) / frameCount;
 }
 
+void PerformanceMetrics::skipFrame() { framesSkipped++; }
+
 int PerformanceMetrics::getFPS() const { return GetFPS(); }
 
 double PerformanceMetrics::getFrameTime() const { return frameTime; }
 
 double PerformanceMetrics::getAvgFrameTime() const { return avgFrameTime; }
 
+long long PerformanceMetrics::getFramesSkipped() const { return framesSkipped; }
+
+double PerformanceMetrics::getCpuTimeUsed() const { return (ProcessCpuSeconds() - startCpu) * 1000.0; }
+
+double PerformanceMetrics::getCpuTimeSaved() const {
+    if (frameCount == 0) return 0.0;
+    double elapsed   = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+    double scheduled = elapsed * targetFps;
+    double used      = getCpuTimeUsed();
+    double baseline  = used / frameCount * scheduled;
+    return baseline > used ? baseline - used : 0.0;
+}
+
 std::string PerformanceMetrics::getPerformanceInfo() const {
-    char buffer[128];
+    char buffer[96];
     snprintf(buffer, sizeof(buffer), "FPS: %d | Frame: %.2f ms | Avg: %.2f ms", getFPS(), frameTime, avgFrameTime);
     return buffer;
+}
+
+std::string PerformanceMetrics::getRedrawInfo() const {
+    char buffer[96];
+    snprintf(buffer, sizeof(buffer), "Skipped: %lld | CPU: %.0f ms | Saved: %.0f ms", getFramesSkipped(), getCpuTimeUsed(), getCpuTimeSaved());
+    return buffer;
 }
\ No newline at end of file
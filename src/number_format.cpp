@@ -0,0 +1,344 @@
+#include "../includes/number_format.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+// Grisu2 after Loitsch, "Printing Floating-Point Numbers Quickly and
+// Accurately with Integers" (PLDI 2010): scale the value's rounding interval
+// by a cached power of ten so that digit generation works on 64-bit integers,
+// then emit digits until the remainder falls inside the interval
+
+namespace {
+
+// Unnormalized floating point value f * 2^e
+struct DiyFp {
+    uint64_t f;
+    int e;
+};
+
+DiyFp subtract(DiyFp x, DiyFp y) { return DiyFp{x.f - y.f, x.e}; }
+
+// Upper 64 bits of the 128-bit product, rounded
+DiyFp multiply(DiyFp x, DiyFp y) {
+    const uint64_t mask = 0xFFFFFFFFu;
+    const uint64_t xLo = x.f & mask, xHi = x.f >> 32;
+    const uint64_t yLo = y.f & mask, yHi = y.f >> 32;
+
+    const uint64_t p0 = xLo * yLo;
+    const uint64_t p1 = xLo * yHi;
+    const uint64_t p2 = xHi * yLo;
+    const uint64_t p3 = xHi * yHi;
+
+    uint64_t middle = (p0 >> 32) + (p1 & mask) + (p2 & mask);
+    middle += uint64_t{1} << 31;
+    return DiyFp{p3 + (p1 >> 32) + (p2 >> 32) + (middle >> 32), x.e + y.e + 64};
+}
+
+DiyFp normalize(DiyFp x) {
+    while ((x.f >> 63) == 0) {
+        x.f <<= 1;
+        x.e--;
+    }
+    return x;
+}
+
+DiyFp normalizeTo(DiyFp x, int e) { return DiyFp{x.f << (x.e - e), e}; }
+
+// The value and the midpoints to its neighbours, all sharing one exponent
+struct Boundaries {
+    DiyFp w;
+    DiyFp minus;
+    DiyFp plus;
+};
+
+Boundaries computeBoundaries(double value) {
+    const int significandBits = 52;
+    const int exponentBias    = 1023 + significandBits;
+    const uint64_t hiddenBit  = uint64_t{1} << significandBits;
+
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const uint64_t fraction = bits & (hiddenBit - 1);
+    const int biased        = static_cast<int>(bits >> significandBits);
+
+    const DiyFp v = biased == 0 ? DiyFp{fraction, 1 - exponentBias} : DiyFp{fraction + hiddenBit, biased - exponentBias};
+
+    // At a power of two the gap to the next smaller double is half as wide
+    const bool lowerCloser = fraction == 0 && biased > 1;
+    const DiyFp plus       = normalize(DiyFp{2 * v.f + 1, v.e - 1});
+    const DiyFp minus      = lowerCloser ? DiyFp{4 * v.f - 1, v.e - 2} : DiyFp{2 * v.f - 1, v.e - 1};
+    return Boundaries{normalize(v), normalizeTo(minus, plus.e), plus};
+}
+
+// Scaled products land in [2^-60, 2^-32) so integral digits fit 32 bits
+const int alpha = -60;
+
+struct CachedPower {
+    uint64_t f;
+    int e;
+    int k;  // Decimal exponent: f * 2^e ~= 10^k
+};
+
+// 10^k for k = -300, -292, ..., 324, rounded to 64 significant bits
+const CachedPower cachedPowers[] = {
+    {0xAB70FE17C79AC6CA, -1060, -300},
+    {0xFF77B1FCBEBCDC4F, -1034, -292},
+    {0xBE5691EF416BD60C, -1007, -284},
+    {0x8DD01FAD907FFC3C, -980, -276},
+    {0xD3515C2831559A83, -954, -268},
+    {0x9D71AC8FADA6C9B5, -927, -260},
+    {0xEA9C227723EE8BCB, -901, -252},
+    {0xAECC49914078536D, -874, -244},
+    {0x823C12795DB6CE57, -847, -236},
+    {0xC21094364DFB5637, -821, -228},
+    {0x9096EA6F3848984F, -794, -220},
+    {0xD77485CB25823AC7, -768, -212},
+    {0xA086CFCD97BF97F4, -741, -204},
+    {0xEF340A98172AACE5, -715, -196},
+    {0xB23867FB2A35B28E, -688, -188},
+    {0x84C8D4DFD2C63F3B, -661, -180},
+    {0xC5DD44271AD3CDBA, -635, -172},
+    {0x936B9FCEBB25C996, -608, -164},
+    {0xDBAC6C247D62A584, -582, -156},
+    {0xA3AB66580D5FDAF6, -555, -148},
+    {0xF3E2F893DEC3F126, -529, -140},
+    {0xB5B5ADA8AAFF80B8, -502, -132},
+    {0x87625F056C7C4A8B, -475, -124},
+    {0xC9BCFF6034C13053, -449, -116},
+    {0x964E858C91BA2655, -422, -108},
+    {0xDFF9772470297EBD, -396, -100},
+    {0xA6DFBD9FB8E5B88F, -369, -92},
+    {0xF8A95FCF88747D94, -343, -84},
+    {0xB94470938FA89BCF, -316, -76},
+    {0x8A08F0F8BF0F156B, -289, -68},
+    {0xCDB02555653131B6, -263, -60},
+    {0x993FE2C6D07B7FAC, -236, -52},
+    {0xE45C10C42A2B3B06, -210, -44},
+    {0xAA242499697392D3, -183, -36},
+    {0xFD87B5F28300CA0E, -157, -28},
+    {0xBCE5086492111AEB, -130, -20},
+    {0x8CBCCC096F5088CC, -103, -12},
+    {0xD1B71758E219652C, -77, -4},
+    {0x9C40000000000000, -50, 4},
+    {0xE8D4A51000000000, -24, 12},
+    {0xAD78EBC5AC620000, 3, 20},
+    {0x813F3978F8940984, 30, 28},
+    {0xC097CE7BC90715B3, 56, 36},
+    {0x8F7E32CE7BEA5C70, 83, 44},
+    {0xD5D238A4ABE98068, 109, 52},
+    {0x9F4F2726179A2245, 136, 60},
+    {0xED63A231D4C4FB27, 162, 68},
+    {0xB0DE65388CC8ADA8, 189, 76},
+    {0x83C7088E1AAB65DB, 216, 84},
+    {0xC45D1DF942711D9A, 242, 92},
+    {0x924D692CA61BE758, 269, 100},
+    {0xDA01EE641A708DEA, 295, 108},
+    {0xA26DA3999AEF774A, 322, 116},
+    {0xF209787BB47D6B85, 348, 124},
+    {0xB454E4A179DD1877, 375, 132},
+    {0x865B86925B9BC5C2, 402, 140},
+    {0xC83553C5C8965D3D, 428, 148},
+    {0x952AB45CFA97A0B3, 455, 156},
+    {0xDE469FBD99A05FE3, 481, 164},
+    {0xA59BC234DB398C25, 508, 172},
+    {0xF6C69A72A3989F5C, 534, 180},
+    {0xB7DCBF5354E9BECE, 561, 188},
+    {0x88FCF317F22241E2, 588, 196},
+    {0xCC20CE9BD35C78A5, 614, 204},
+    {0x98165AF37B2153DF, 641, 212},
+    {0xE2A0B5DC971F303A, 667, 220},
+    {0xA8D9D1535CE3B396, 694, 228},
+    {0xFB9B7CD9A4A7443C, 720, 236},
+    {0xBB764C4CA7A44410, 747, 244},
+    {0x8BAB8EEFB6409C1A, 774, 252},
+    {0xD01FEF10A657842C, 800, 260},
+    {0x9B10A4E5E9913129, 827, 268},
+    {0xE7109BFBA19C0C9D, 853, 276},
+    {0xAC2820D9623BF429, 880, 284},
+    {0x80444B5E7AA7CF85, 907, 292},
+    {0xBF21E44003ACDD2D, 933, 300},
+    {0x8E679C2F5E44FF8F, 960, 308},
+    {0xD433179D9C8CB841, 986, 316},
+    {0x9E19DB92B4E31BA9, 1013, 324},
+};
+
+const int cachedPowersMinExponent = -300;
+const int cachedPowersStep        = 8;
+
+// A power c with alpha <= e + c.e <= gamma
+const CachedPower& cachedPowerFor(int e) {
+    // ceil((alpha - e - 1) * log10(2)), with 78913 / 2^18 approximating log10(2)
+    const int f     = alpha - e - 1;
+    const int k     = (f * 78913) / (1 << 18) + (f > 0 ? 1 : 0);
+    const int index = (-cachedPowersMinExponent + k + (cachedPowersStep - 1)) / cachedPowersStep;
+    return cachedPowers[index];
+}
+
+// Nudge the last digit down while that brings it closer to w and stays in range
+void roundWeed(char* digits, int length, uint64_t distance, uint64_t delta, uint64_t rest, uint64_t tenKappa) {
+    while (rest < distance && delta - rest >= tenKappa && (rest + tenKappa < distance || distance - rest > rest + tenKappa - distance)) {
+        digits[length - 1]--;
+        rest += tenKappa;
+    }
+}
+
+int generateDigits(char* digits, int& exponent, DiyFp minus, DiyFp w, DiyFp plus) {
+    uint64_t delta    = subtract(plus, minus).f;
+    uint64_t distance = subtract(plus, w).f;
+
+    // Split plus into integral and fractional parts at one = 2^-e
+    const int shift    = -plus.e;
+    const uint64_t one = uint64_t{1} << shift;
+    uint32_t integral  = static_cast<uint32_t>(plus.f >> shift);
+    uint64_t fraction  = plus.f & (one - 1);
+
+    uint32_t divisor = 1;
+    int kappa        = 1;
+    while (divisor <= integral / 10) {
+        divisor *= 10;
+        kappa++;
+    }
+
+    int length = 0;
+    while (kappa > 0) {
+        digits[length++] = static_cast<char>('0' + integral / divisor);
+        integral %= divisor;
+        kappa--;
+
+        const uint64_t rest = (static_cast<uint64_t>(integral) << shift) + fraction;
+        if (rest <= delta) {
+            exponent += kappa;
+            roundWeed(digits, length, distance, delta, rest, static_cast<uint64_t>(divisor) << shift);
+            return length;
+        }
+        divisor /= 10;
+    }
+
+    for (;;) {
+        fraction *= 10;
+        delta *= 10;
+        distance *= 10;
+        digits[length++] = static_cast<char>('0' + (fraction >> shift));
+        fraction &= one - 1;
+        kappa--;
+        if (fraction <= delta) break;
+    }
+    exponent += kappa;
+    roundWeed(digits, length, distance, delta, fraction, one);
+    return length;
+}
+
+char* writeExponent(char* out, int exponent) {
+    *out++ = 'e';
+    if (exponent < 0) {
+        *out++ = '-';
+        exponent = -exponent;
+    }
+    if (exponent >= 100) *out++ = static_cast<char>('0' + exponent / 100);
+    if (exponent >= 10) *out++ = static_cast<char>('0' + exponent / 10 % 10);
+    *out++ = static_cast<char>('0' + exponent % 10);
+    return out;
+}
+
+}  // namespace
+
+int ShortestDigits(double value, char* digits, int& exponent) {
+    const Boundaries b      = computeBoundaries(value);
+    const CachedPower& c    = cachedPowerFor(b.plus.e);
+    const DiyFp scale       = DiyFp{c.f, c.e};
+    const DiyFp w           = multiply(b.w, scale);
+    const DiyFp scaledMinus = multiply(b.minus, scale);
+    const DiyFp scaledPlus  = multiply(b.plus, scale);
+
+    // Shrink the interval by one unit on each side to absorb the rounding of multiply
+    exponent = -c.k;
+    return generateDigits(digits, exponent, DiyFp{scaledMinus.f + 1, scaledMinus.e}, w, DiyFp{scaledPlus.f - 1, scaledPlus.e});
+}
+
+size_t FormatNumberTo(double value, int precision, char* buffer) {
+    const char* special = nullptr;
+    if (std::isnan(value)) special = "Error: NaN";
+    if (std::isinf(value)) special = value > 0 ? "Infinity" : "-Infinity";
+    if (value == 0.0) special = "0";
+    if (special != nullptr) {
+        const size_t length = std::strlen(special);
+        std::memcpy(buffer, special, length + 1);
+        return length;
+    }
+    if (precision < 0) precision = 0;
+
+    char* out = buffer;
+    if (value < 0) {
+        *out++ = '-';
+        value  = -value;
+    }
+
+    char digits[18];
+    int exponent;
+    int count = ShortestDigits(value, digits, exponent);
+
+    // Position of the decimal point relative to the digits, and the power of
+    // ten of the leading digit
+    int point   = count + exponent;
+    int leading = point - 1;
+
+    const bool scientific = leading >= 16 || leading < -6;
+
+    // Round half up to the digits that will be shown. In fixed notation keep
+    // can reach zero or below, when no digit falls within the precision
+    const int keep = scientific ? 1 + precision : point + precision;
+    if (keep < count) {
+        const bool up = keep >= 0 && digits[keep] >= '5';
+        count         = keep;
+        if (up) {
+            int i = count - 1;
+            while (i >= 0 && digits[i] == '9') i--;
+            if (i < 0) {
+                // 9.99 -> 10: a single 1 one place higher
+                digits[0] = '1';
+                count     = 1;
+                point++;
+                leading++;
+            } else {
+                digits[i]++;
+                count = i + 1;
+            }
+        }
+    }
+    if (count <= 0) {
+        // Rounds to zero, printed without a sign like an exact zero
+        std::memcpy(buffer, "0", 2);
+        return 1;
+    }
+    while (count > 1 && digits[count - 1] == '0') count--;
+
+    if (scientific) {
+        *out++ = digits[0];
+        if (count > 1) {
+            *out++ = '.';
+            std::memcpy(out, digits + 1, static_cast<size_t>(count - 1));
+            out += count - 1;
+        }
+        out = writeExponent(out, leading);
+    } else if (point <= 0) {
+        *out++ = '0';
+        *out++ = '.';
+        for (int i = point; i < 0; ++i) *out++ = '0';
+        std::memcpy(out, digits, static_cast<size_t>(count));
+        out += count;
+    } else if (point >= count) {
+        std::memcpy(out, digits, static_cast<size_t>(count));
+        out += count;
+        for (int i = count; i < point; ++i) *out++ = '0';
+    } else {
+        std::memcpy(out, digits, static_cast<size_t>(point));
+        out += point;
+        *out++ = '.';
+        std::memcpy(out, digits + point, static_cast<size_t>(count - point));
+        out += count - point;
+    }
+
+    *out = '\0';
+    return static_cast<size_t>(out - buffer);
+}
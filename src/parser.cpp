@@ -1,250 +1,749 @@
 #include "../includes/parser.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <stdexcept>
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
 
-std::unique_ptr<double> MathParser::evaluate(const std::string& expression) {
-    if (expression.empty()) {
-        throw std::runtime_error("Empty expression");
+const char* errorMessage(EvalError error) {
+    switch (error) {
+        case EvalError::None:
+            return "";
+        case EvalError::EmptyExpression:
+            return "Empty expression";
+        case EvalError::UnexpectedCharacter:
+            return "Unexpected character";
+        case EvalError::InvalidNumber:
+            return "Invalid number";
+        case EvalError::MismatchedParentheses:
+            return "Mismatched parentheses";
+        case EvalError::InvalidExpression:
+            return "Invalid expression";
+        case EvalError::InvalidFunctionCall:
+            return "Invalid function call";
+        case EvalError::UnboundVariable:
+            return "Unbound variable";
+        case EvalError::DivisionByZero:
+            return "Division by zero";
+        case EvalError::ZeroToNegativePower:
+            return "Cannot raise zero to a negative power";
+        case EvalError::ImaginaryResult:
+            return "Cannot compute imaginary results (negative base with non-integer exponent)";
+        case EvalError::TangentUndefined:
+            return "Tangent is undefined at odd multiples of 90 degrees";
+        case EvalError::LogNonPositive:
+            return "Cannot compute logarithm of non-positive number";
+        case EvalError::LnNonPositive:
+            return "Cannot compute natural logarithm of non-positive number";
+        case EvalError::SqrtNegative:
+            return "Cannot compute square root of negative number";
+        case EvalError::AsinOutOfRange:
+            return "Inverse sine argument must be between -1 and 1";
+        case EvalError::AcosOutOfRange:
+            return "Inverse cosine argument must be between -1 and 1";
     }
+    return "Unknown error";
+}
 
-    try {
-        std::vector<std::string> tokens = tokenize(expression);
-        if (tokens.empty()) {
-            throw std::runtime_error("Invalid expression format");
-        }
+// Operator and function implementations, args ordered as written
+static EvalError applyAdd(const double* args, double& result) {
+    result = args[0] + args[1];
+    return EvalError::None;
+}
+
+static EvalError applySub(const double* args, double& result) {
+    result = args[0] - args[1];
+    return EvalError::None;
+}
+
+static EvalError applyMul(const double* args, double& result) {
+    result = args[0] * args[1];
+    return EvalError::None;
+}
+
+static EvalError applyDiv(const double* args, double& result) {
+    if (args[1] == 0) return EvalError::DivisionByZero;
+    result = args[0] / args[1];
+    return EvalError::None;
+}
+
+static EvalError applyPow(const double* args, double& result) {
+    double a = args[0];
+    double b = args[1];
+    // Check for invalid power operations
+    if (a == 0 && b < 0) return EvalError::ZeroToNegativePower;
+    if (a < 0 && std::floor(b) != b) return EvalError::ImaginaryResult;
+    result = std::pow(a, b);
+    return EvalError::None;
+}
+
+static EvalError applyNeg(const double* args, double& result) {
+    result = -args[0];
+    return EvalError::None;
+}
+
+// Trigonometric functions (using degrees)
+static EvalError applySin(const double* args, double& result) {
+    result = std::sin(args[0] * M_PI / 180.0);  // Convert degrees to radians
+    return EvalError::None;
+}
+
+static EvalError applyCos(const double* args, double& result) {
+    result = std::cos(args[0] * M_PI / 180.0);  // Convert degrees to radians
+    return EvalError::None;
+}
+
+static EvalError applyTan(const double* args, double& result) {
+    // Check for undefined values (90°, 270°, etc.)
+    if (std::fmod(std::abs(args[0] - 90.0), 180.0) < 1e-10) return EvalError::TangentUndefined;
+    result = std::tan(args[0] * M_PI / 180.0);  // Convert degrees to radians
+    return EvalError::None;
+}
+
+// Logarithmic functions
+static EvalError applyLog(const double* args, double& result) {
+    if (args[0] <= 0) return EvalError::LogNonPositive;
+    result = std::log10(args[0]);
+    return EvalError::None;
+}
+
+static EvalError applyLn(const double* args, double& result) {
+    if (args[0] <= 0) return EvalError::LnNonPositive;
+    result = std::log(args[0]);
+    return EvalError::None;
+}
+
+// Other functions
+static EvalError applyExp(const double* args, double& result) {
+    result = std::exp(args[0]);
+    return EvalError::None;
+}
+
+static EvalError applySqrt(const double* args, double& result) {
+    if (args[0] < 0) return EvalError::SqrtNegative;
+    result = std::sqrt(args[0]);
+    return EvalError::None;
+}
+
+// Inverse trigonometric functions
+static EvalError applyAsin(const double* args, double& result) {
+    if (args[0] < -1 || args[0] > 1) return EvalError::AsinOutOfRange;
+    result = std::asin(args[0]) * 180.0 / M_PI;  // Convert radians to degrees
+    return EvalError::None;
+}
+
+static EvalError applyAcos(const double* args, double& result) {
+    if (args[0] < -1 || args[0] > 1) return EvalError::AcosOutOfRange;
+    result = std::acos(args[0]) * 180.0 / M_PI;  // Convert radians to degrees
+    return EvalError::None;
+}
+
+static EvalError applyAtan(const double* args, double& result) {
+    result = std::atan(args[0]) * 180.0 / M_PI;  // Convert radians to degrees
+    return EvalError::None;
+}
+
+// Hyperbolic functions
+static EvalError applyHyp(const double* args, double& result) {
+    result = std::hypot(args[0], args[0]);
+    return EvalError::None;
+}
+
+// Column kernels used by batch evaluation; simple loops the compiler can vectorize
+static const double kNaN = std::numeric_limits<double>::quiet_NaN();
 
-        std::vector<std::string> rpn = toRPN(tokens);
-        return std::unique_ptr<double>(new double(computeRPN(rpn)));
-    } catch (const std::exception& e) {
-        // Re-throw with more context if needed
-        throw std::runtime_error(std::string("Calculation error: ") + e.what());
+static void columnAdd(double* lhs, const double* rhs, size_t count) {
+    for (size_t i = 0; i < count; ++i) lhs[i] += rhs[i];
+}
+
+static void columnSub(double* lhs, const double* rhs, size_t count) {
+    for (size_t i = 0; i < count; ++i) lhs[i] -= rhs[i];
+}
+
+static void columnMul(double* lhs, const double* rhs, size_t count) {
+    for (size_t i = 0; i < count; ++i) lhs[i] *= rhs[i];
+}
+
+static void columnDiv(double* lhs, const double* rhs, size_t count) {
+    for (size_t i = 0; i < count; ++i) lhs[i] = rhs[i] == 0 ? kNaN : lhs[i] / rhs[i];
+}
+
+static void columnPow(double* lhs, const double* rhs, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        double a = lhs[i];
+        double b = rhs[i];
+        lhs[i]   = (a == 0 && b < 0) || (a < 0 && std::floor(b) != b) ? kNaN : std::pow(a, b);
+    }
+}
+
+static void columnNeg(double* lhs, const double*, size_t count) {
+    for (size_t i = 0; i < count; ++i) lhs[i] = -lhs[i];
+}
+
+static void columnSin(double* lhs, const double*, size_t count) {
+    for (size_t i = 0; i < count; ++i) lhs[i] = std::sin(lhs[i] * M_PI / 180.0);
+}
+
+static void columnCos(double* lhs, const double*, size_t count) {
+    for (size_t i = 0; i < count; ++i) lhs[i] = std::cos(lhs[i] * M_PI / 180.0);
+}
+
+static void columnTan(double* lhs, const double*, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        lhs[i] = std::fmod(std::abs(lhs[i] - 90.0), 180.0) < 1e-10 ? kNaN : std::tan(lhs[i] * M_PI / 180.0);
     }
 }
 
-std::vector<std::string> MathParser::tokenize(const std::string& expr) {
-    std::vector<std::string> tokens;
-    for (size_t i = 0; i < expr.length(); ++i) {
-        char c = expr[i];
-        if (isspace(c)) continue;
+static void columnLog(double* lhs, const double*, size_t count) {
+    for (size_t i = 0; i < count; ++i) lhs[i] = lhs[i] <= 0 ? kNaN : std::log10(lhs[i]);
+}
+
+static void columnLn(double* lhs, const double*, size_t count) {
+    for (size_t i = 0; i < count; ++i) lhs[i] = lhs[i] <= 0 ? kNaN : std::log(lhs[i]);
+}
+
+static void columnExp(double* lhs, const double*, size_t count) {
+    for (size_t i = 0; i < count; ++i) lhs[i] = std::exp(lhs[i]);
+}
+
+static void columnSqrt(double* lhs, const double*, size_t count) {
+    for (size_t i = 0; i < count; ++i) lhs[i] = lhs[i] < 0 ? kNaN : std::sqrt(lhs[i]);
+}
+
+static void columnAsin(double* lhs, const double*, size_t count) {
+    for (size_t i = 0; i < count; ++i) lhs[i] = lhs[i] < -1 || lhs[i] > 1 ? kNaN : std::asin(lhs[i]) * 180.0 / M_PI;
+}
+
+static void columnAcos(double* lhs, const double*, size_t count) {
+    for (size_t i = 0; i < count; ++i) lhs[i] = lhs[i] < -1 || lhs[i] > 1 ? kNaN : std::acos(lhs[i]) * 180.0 / M_PI;
+}
+
+static void columnAtan(double* lhs, const double*, size_t count) {
+    for (size_t i = 0; i < count; ++i) lhs[i] = std::atan(lhs[i]) * 180.0 / M_PI;
+}
+
+static void columnHyp(double* lhs, const double*, size_t count) {
+    for (size_t i = 0; i < count; ++i) lhs[i] = std::hypot(lhs[i], lhs[i]);
+}
 
-        if (c == '-' && (tokens.empty() || tokens.back() == "(" || isOperator(tokens.back()))) {
-            // Unary minus
-            std::string num_str = "-";
-            i++;
-            while (i < expr.length() && (isdigit(expr[i]) || expr[i] == '.')) {
-                num_str += expr[i];
-                i++;
+// Indexed by OpCode; the PushConst and PushVar slots are placeholders
+static const OperatorInfo operatorTable[] = {
+    {"", OpCode::PushConst, 0, 0, Associativity::Left, nullptr, nullptr},
+    {"", OpCode::PushVar, 0, 0, Associativity::Left, nullptr, nullptr},
+    {"+", OpCode::Add, 2, 1, Associativity::Left, applyAdd, columnAdd},
+    {"-", OpCode::Sub, 2, 1, Associativity::Left, applySub, columnSub},
+    {"*", OpCode::Mul, 2, 2, Associativity::Left, applyMul, columnMul},
+    {"/", OpCode::Div, 2, 2, Associativity::Left, applyDiv, columnDiv},
+    {"^", OpCode::Pow, 2, 3, Associativity::Right, applyPow, columnPow},
+    {"-", OpCode::Neg, 1, 4, Associativity::Right, applyNeg, columnNeg},
+    {"sin", OpCode::Sin, 1, 0, Associativity::Left, applySin, columnSin},
+    {"cos", OpCode::Cos, 1, 0, Associativity::Left, applyCos, columnCos},
+    {"tan", OpCode::Tan, 1, 0, Associativity::Left, applyTan, columnTan},
+    {"log", OpCode::Log, 1, 0, Associativity::Left, applyLog, columnLog},
+    {"ln", OpCode::Ln, 1, 0, Associativity::Left, applyLn, columnLn},
+    {"exp", OpCode::Exp, 1, 0, Associativity::Left, applyExp, columnExp},
+    {"sqrt", OpCode::Sqrt, 1, 0, Associativity::Left, applySqrt, columnSqrt},
+    {"asin", OpCode::Asin, 1, 0, Associativity::Left, applyAsin, columnAsin},
+    {"acos", OpCode::Acos, 1, 0, Associativity::Left, applyAcos, columnAcos},
+    {"atan", OpCode::Atan, 1, 0, Associativity::Left, applyAtan, columnAtan},
+    {"hyp", OpCode::Hyp, 1, 0, Associativity::Left, applyHyp, columnHyp},
+};
+
+const OperatorInfo& operatorInfo(OpCode code) { return operatorTable[static_cast<size_t>(code)]; }
+
+const OperatorInfo* findOperator(const char* name, size_t length) {
+    // Pick the single candidate by length and leading characters, then confirm it
+    OpCode candidate = OpCode::PushConst;
+    switch (length) {
+        case 1:
+            switch (name[0]) {
+                case '+':
+                    candidate = OpCode::Add;
+                    break;
+                case '-':
+                    candidate = OpCode::Sub;
+                    break;
+                case '*':
+                    candidate = OpCode::Mul;
+                    break;
+                case '/':
+                    candidate = OpCode::Div;
+                    break;
+                case '^':
+                    candidate = OpCode::Pow;
+                    break;
             }
-            i--;  // Decrement because the outer loop increments
-            tokens.push_back(num_str);
-        } else if (isdigit(c) || c == '.') {
-            std::string num_str;
-            while (i < expr.length() && (isdigit(expr[i]) || expr[i] == '.')) {
-                num_str += expr[i];
-                i++;
+            break;
+        case 2:
+            candidate = OpCode::Ln;
+            break;
+        case 3:
+            switch (name[0]) {
+                case 's':
+                    candidate = OpCode::Sin;
+                    break;
+                case 'c':
+                    candidate = OpCode::Cos;
+                    break;
+                case 't':
+                    candidate = OpCode::Tan;
+                    break;
+                case 'l':
+                    candidate = OpCode::Log;
+                    break;
+                case 'e':
+                    candidate = OpCode::Exp;
+                    break;
+                case 'h':
+                    candidate = OpCode::Hyp;
+                    break;
             }
-            i--;
-            tokens.push_back(num_str);
-        } else if (isalpha(c)) {
-            std::string func_str;
-            while (i < expr.length() && isalpha(expr[i])) {
-                func_str += expr[i];
-                i++;
+            break;
+        case 4:
+            if (name[0] == 's') {
+                candidate = OpCode::Sqrt;
+            } else if (name[0] == 'a') {
+                switch (name[1]) {
+                    case 's':
+                        candidate = OpCode::Asin;
+                        break;
+                    case 'c':
+                        candidate = OpCode::Acos;
+                        break;
+                    case 't':
+                        candidate = OpCode::Atan;
+                        break;
+                }
+            }
+            break;
+    }
+
+    if (candidate == OpCode::PushConst) return nullptr;
+    const OperatorInfo& info = operatorInfo(candidate);
+    return std::strncmp(info.name, name, length) == 0 ? &info : nullptr;
+}
+
+EvalResult MathParser::evaluate(const std::string& expression) {
+    CompiledExpression compiled = compile(expression);
+    if (!compiled.ok()) {
+        return compiled.status;
+    }
+    return compiled.evaluate();
+}
+
+CompiledExpression MathParser::compile(const std::string& expression, bool optimize) {
+    CompiledExpression compiled;
+
+    EvalResult status = tokenize(expression);
+    if (status.ok() && tokens.empty()) {
+        status = EvalResult::failure(EvalError::EmptyExpression, 0);
+    }
+    if (status.ok()) {
+        status = toRPN();
+    }
+    if (!status.ok()) {
+        compiled.status = status;
+        return compiled;
+    }
+
+    assemble(expression, compiled);
+    if (optimize && compiled.ok()) {
+        this->optimize(compiled);
+    }
+    return compiled;
+}
+
+// Parses the number spanning [begin, end); strtod may read past the span
+// (exponents, hex prefixes), in which case only the span itself is parsed
+static bool parseNumber(const char* begin, const char* end, double& value) {
+    char* parsed;
+    value = std::strtod(begin, &parsed);
+    if (parsed == end) {
+        return true;
+    }
+
+    std::string literal(begin, end);
+    value = std::strtod(literal.c_str(), &parsed);
+    return parsed == literal.c_str() + literal.size();
+}
+
+static bool isNumberChar(char c) { return isdigit(static_cast<unsigned char>(c)) || c == '.'; }
+
+// Length of the exponent suffix ("e7", "E-12", "e+3") starting at text[i], or
+// 0 if there is none; a bare 'e' is left to be read as a name
+static size_t exponentLength(const char* text, size_t i, size_t length) {
+    if (i >= length || (text[i] != 'e' && text[i] != 'E')) return 0;
+    size_t end = i + 1;
+    if (end < length && (text[end] == '+' || text[end] == '-')) end++;
+    if (end >= length || !isdigit(static_cast<unsigned char>(text[end]))) return 0;
+    while (end < length && isdigit(static_cast<unsigned char>(text[end]))) end++;
+    return end - i;
+}
+
+EvalResult MathParser::tokenize(const std::string& expr) {
+    tokens.clear();
+    const char* text    = expr.c_str();
+    const size_t length = expr.length();
+
+    for (size_t i = 0; i < length; ++i) {
+        char c = text[i];
+        if (isspace(static_cast<unsigned char>(c))) continue;
+
+        uint32_t start = static_cast<uint32_t>(i);
+        bool unary     = c == '-' && (tokens.empty() || tokens.back().kind == TokenKind::LeftParen || tokens.back().kind == TokenKind::Operator);
+
+        if ((unary && i + 1 < length && isNumberChar(text[i + 1])) || isNumberChar(c)) {
+            // Unary minus directly before a literal is folded into it
+            if (unary) i++;
+            while (i < length && isNumberChar(text[i])) i++;
+            i += exponentLength(text, i, length);
+            double value;
+            if (!parseNumber(text + start, text + i, value)) {
+                return EvalResult::failure(EvalError::InvalidNumber, start);
+            }
+            tokens.push_back(Token{TokenKind::Number, OpCode::PushConst, start, static_cast<uint32_t>(i - start), value});
+            i--;  // Decrement because the outer loop increments
+        } else if (isalpha(static_cast<unsigned char>(c))) {
+            // Known function names are functions; any other name is a variable
+            while (i < length && isalpha(static_cast<unsigned char>(text[i]))) i++;
+            const OperatorInfo* info = findOperator(text + start, i - start);
+            if (info != nullptr && info->arity == 1) {
+                tokens.push_back(Token{TokenKind::Function, info->code, start, static_cast<uint32_t>(i - start), 0.0});
+            } else {
+                tokens.push_back(Token{TokenKind::Variable, OpCode::PushVar, start, static_cast<uint32_t>(i - start), 0.0});
             }
             i--;
-            tokens.push_back(func_str);
+        } else if (c == '(') {
+            tokens.push_back(Token{TokenKind::LeftParen, OpCode::PushConst, start, 1, 0.0});
+        } else if (c == ')') {
+            tokens.push_back(Token{TokenKind::RightParen, OpCode::PushConst, start, 1, 0.0});
+        } else if (const OperatorInfo* info = findOperator(text + i, 1)) {
+            tokens.push_back(Token{TokenKind::Operator, unary ? OpCode::Neg : info->code, start, 1, 0.0});
         } else {
-            tokens.push_back(std::string(1, c));
+            return EvalResult::failure(EvalError::UnexpectedCharacter, start);
         }
     }
-    return tokens;
+    return EvalResult::success(0.0);
 }
 
-std::vector<std::string> MathParser::toRPN(const std::vector<std::string>& tokens) {
-    std::vector<std::string> output;
-    std::stack<std::string> opStack;
+EvalResult MathParser::toRPN() {
+    rpn.clear();
+    opStack.clear();
 
-    for (const std::string& token : tokens) {
-        if (isNumber(token)) {
-            output.push_back(token);
-        } else if (isFunction(token)) {
-            opStack.push(token);
-        } else if (isOperator(token)) {
-            while (!opStack.empty() && isOperator(opStack.top()) && precedence(opStack.top()) >= precedence(token)) {
-                output.push_back(opStack.top());
-                opStack.pop();
-            }
-            opStack.push(token);
-        } else if (token == "(") {
-            opStack.push(token);
-        } else if (token == ")") {
-            while (!opStack.empty() && opStack.top() != "(") {
-                output.push_back(opStack.top());
-                opStack.pop();
-            }
-            opStack.pop();
-            if (!opStack.empty() && isFunction(opStack.top())) {
-                output.push_back(opStack.top());
-                opStack.pop();
+    // Two operands in a row ("1 2", "x y", "2 (3)") are rejected where the
+    // second one starts, as IncrementalParser does
+    bool afterOperand = false;
+    for (const Token& token : tokens) {
+        const bool startsOperand = token.kind == TokenKind::Number || token.kind == TokenKind::Variable || token.kind == TokenKind::Function ||
+                                   token.kind == TokenKind::LeftParen;
+        if (afterOperand && startsOperand) {
+            return EvalResult::failure(EvalError::InvalidExpression, token.offset);
+        }
+        afterOperand = token.kind == TokenKind::Number || token.kind == TokenKind::Variable || token.kind == TokenKind::RightParen;
+
+        switch (token.kind) {
+            case TokenKind::Number:
+            case TokenKind::Variable:
+                rpn.push_back(token);
+                break;
+            case TokenKind::Function:
+                opStack.push_back(token);
+                break;
+            case TokenKind::Operator: {
+                // Prefix operators bind to what follows, so they never pop the stack
+                const OperatorInfo& info = operatorInfo(token.op);
+                while (info.arity == 2 && !opStack.empty() && opStack.back().kind == TokenKind::Operator) {
+                    const OperatorInfo& top = operatorInfo(opStack.back().op);
+                    if (top.precedence < info.precedence || (top.precedence == info.precedence && info.associativity == Associativity::Right)) {
+                        break;
+                    }
+                    rpn.push_back(opStack.back());
+                    opStack.pop_back();
+                }
+                opStack.push_back(token);
+                break;
             }
+            case TokenKind::LeftParen:
+                opStack.push_back(token);
+                break;
+            case TokenKind::RightParen:
+                while (!opStack.empty() && opStack.back().kind != TokenKind::LeftParen) {
+                    rpn.push_back(opStack.back());
+                    opStack.pop_back();
+                }
+                if (opStack.empty()) {
+                    return EvalResult::failure(EvalError::MismatchedParentheses, token.offset);
+                }
+                opStack.pop_back();
+                if (!opStack.empty() && opStack.back().kind == TokenKind::Function) {
+                    rpn.push_back(opStack.back());
+                    opStack.pop_back();
+                }
+                break;
         }
     }
 
+    // Unclosed parentheses are tolerated and simply dropped
     while (!opStack.empty()) {
-        output.push_back(opStack.top());
-        opStack.pop();
+        if (opStack.back().kind != TokenKind::LeftParen) {
+            rpn.push_back(opStack.back());
+        }
+        opStack.pop_back();
     }
-
-    return output;
+    return EvalResult::success(0.0);
 }
 
-double MathParser::computeRPN(const std::vector<std::string>& rpn) {
-    std::stack<double> stack;
+void MathParser::assemble(const std::string& expr, CompiledExpression& compiled) {
+    compiled.code.reserve(rpn.size());
+    compiled.positions.reserve(rpn.size());
 
-    for (const std::string& token : rpn) {
-        if (isNumber(token)) {
-            stack.push(std::stod(token));
-        } else if (isOperator(token)) {
-            if (stack.size() < 2) {
-                throw std::runtime_error("Invalid expression");
+    // Track the operand stack depth so evaluation never has to check it
+    size_t depth = 0;
+    for (const Token& token : rpn) {
+        if (token.kind == TokenKind::Number) {
+            compiled.code.push_back(Instruction{OpCode::PushConst, 0, token.value});
+            depth++;
+        } else if (token.kind == TokenKind::Variable) {
+            // Assign slots in order of first appearance
+            std::string name = expr.substr(token.offset, token.length);
+            size_t slot      = 0;
+            while (slot < compiled.variables.size() && compiled.variables[slot] != name) slot++;
+            if (slot == compiled.variables.size()) {
+                compiled.variables.push_back(name);
             }
-            double b = stack.top();
-            stack.pop();
-            double a = stack.top();
-            stack.pop();
-            stack.push(applyOperator(a, b, token));
-        } else if (isFunction(token)) {
-            if (stack.empty()) {
-                throw std::runtime_error("Invalid function call");
+            compiled.code.push_back(Instruction{OpCode::PushVar, static_cast<uint32_t>(slot), 0.0});
+            depth++;
+        } else {
+            const OperatorInfo& info = operatorInfo(token.op);
+            if (depth < info.arity) {
+                compiled.code.clear();
+                compiled.status =
+                    EvalResult::failure(token.kind == TokenKind::Function ? EvalError::InvalidFunctionCall : EvalError::InvalidExpression, token.offset);
+                return;
             }
-            double a = stack.top();
-            stack.pop();
-            stack.push(applyFunction(a, token));
+            compiled.code.push_back(Instruction{token.op, 0, 0.0});
+            depth -= info.arity - 1;
+        }
+        compiled.positions.push_back(token.offset);
+        if (depth > compiled.maxStackDepth) {
+            compiled.maxStackDepth = depth;
         }
     }
 
-    if (stack.empty()) {
-        throw std::runtime_error("Empty expression");
-    }
-    return stack.top();
+    compiled.status = depth == 0 ? EvalResult::failure(EvalError::EmptyExpression, 0) : EvalResult::success(0.0);
 }
 
-bool MathParser::isNumber(const std::string& token) {
-    if (token.empty()) {
-        return false;
-    }
-    char* p;
-    strtod(token.c_str(), &p);
-    return *p == 0;
-}
+void MathParser::optimize(CompiledExpression& compiled) {
+    // Rebuild the program while tracking, for every operand on the stack, where
+    // its code starts and whether it is a known constant
+    struct Operand {
+        size_t start;
+        bool constant;
+        double value;
+    };
 
-bool MathParser::isOperator(const std::string& token) { return token == "+" || token == "-" || token == "*" || token == "/" || token == "^"; }
+    std::vector<Instruction> code;
+    std::vector<uint32_t> positions;
+    std::vector<Operand> operands;
+    code.reserve(compiled.code.size());
+    positions.reserve(compiled.code.size());
 
-bool MathParser::isFunction(const std::string& token) {
-    return token == "sin" || token == "cos" || token == "tan" || token == "log" || token == "ln" || token == "exp" || token == "sqrt" ||
-           token == "asin" || token == "acos" || token == "atan" || token == "hyp";
-}
+    // Drops the instructions in [first, first + count) of the rebuilt program
+    auto erase = [&](size_t first, size_t count) {
+        code.erase(code.begin() + first, code.begin() + first + count);
+        positions.erase(positions.begin() + first, positions.begin() + first + count);
+    };
+    auto isConstant = [](const Operand& operand, double value) { return operand.constant && operand.value == value; };
+    // Zero compares equal to -0, but they differ as addends
+    auto isZero = [](const Operand& operand, bool negative) {
+        return operand.constant && operand.value == 0.0 && std::signbit(operand.value) == negative;
+    };
 
-int MathParser::precedence(const std::string& op) {
-    if (op == "+" || op == "-") return 1;
-    if (op == "*" || op == "/") return 2;
-    if (op == "^") return 3;
-    return 0;
-}
+    for (size_t pc = 0; pc < compiled.code.size(); ++pc) {
+        const Instruction& ins = compiled.code[pc];
+        if (ins.op == OpCode::PushConst || ins.op == OpCode::PushVar) {
+            operands.push_back(Operand{code.size(), ins.op == OpCode::PushConst, ins.value});
+            code.push_back(ins);
+            positions.push_back(compiled.positions[pc]);
+            continue;
+        }
+
+        const OperatorInfo& info = operatorTable[static_cast<size_t>(ins.op)];
+        const size_t first       = operands.size() - info.arity;
 
-double MathParser::applyOperator(double a, double b, const std::string& op) {
-    if (op == "+") return a + b;
-    if (op == "-") return a - b;
-    if (op == "*") return a * b;
-    if (op == "/") {
-        if (b == 0) {
-            throw std::runtime_error("Division by zero");
+        // Fold when every argument is constant and the result is well defined;
+        // failing folds stay in the program so the error surfaces at runtime
+        bool allConstant = true;
+        double args[2];
+        for (size_t i = 0; i < info.arity; ++i) {
+            allConstant = allConstant && operands[first + i].constant;
+            args[i]     = operands[first + i].value;
         }
-        return a / b;
-    }
-    if (op == "^") {
-        // Check for invalid power operations
-        if (a == 0 && b < 0) {
-            throw std::runtime_error("Cannot raise zero to a negative power");
+        double folded;
+        if (allConstant && info.apply(args, folded) == EvalError::None) {
+            size_t start = operands[first].start;
+            erase(start, code.size() - start);
+            operands.resize(first);
+            operands.push_back(Operand{code.size(), true, folded});
+            code.push_back(Instruction{OpCode::PushConst, 0, folded});
+            positions.push_back(compiled.positions[pc]);
+            continue;
         }
-        if (a < 0 && std::floor(b) != b) {
-            throw std::runtime_error(
-                "Cannot compute imaginary results (negative base with "
-                "non-integer exponent)");
+
+        if (info.arity == 2) {
+            const Operand& lhs = operands[first];
+            const Operand& rhs = operands[first + 1];
+            bool keepLhs       = false;  // x op c -> x
+            bool keepRhs       = false;  // c op x -> x
+            switch (ins.op) {
+                // Only the rewrites exact for every x, signed zeros included:
+                // x + -0 and x - 0 are x, but -0 + 0 is +0, not -0
+                case OpCode::Add:
+                    keepLhs = isZero(rhs, true);
+                    keepRhs = isZero(lhs, true);
+                    break;
+                case OpCode::Sub:
+                    keepLhs = isZero(rhs, false);
+                    break;
+                case OpCode::Mul:
+                    keepLhs = isConstant(rhs, 1.0);
+                    keepRhs = isConstant(lhs, 1.0);
+                    break;
+                case OpCode::Div:
+                case OpCode::Pow:
+                    keepLhs = isConstant(rhs, 1.0);
+                    break;
+                default:
+                    break;
+            }
+            if (keepLhs) {
+                erase(rhs.start, 1);
+                operands.pop_back();
+                continue;
+            }
+            if (keepRhs) {
+                Operand result{lhs.start, rhs.constant, rhs.value};
+                erase(lhs.start, 1);
+                operands.pop_back();
+                operands.back() = result;
+                continue;
+            }
+        } else if (ins.op == OpCode::Neg && code.back().op == OpCode::Neg) {
+            // -(-x) -> x
+            erase(code.size() - 1, 1);
+            operands.back().constant = false;
+            continue;
         }
-        return std::pow(a, b);
-    }
-    throw std::runtime_error("Unknown operator: " + op);
-}
 
-double MathParser::applyFunction(double a, const std::string& func) {
-    // Trigonometric functions (using degrees)
-    if (func == "sin") {
-        return std::sin(a * M_PI / 180.0);  // Convert degrees to radians
+        size_t start = operands[first].start;
+        operands.resize(first);
+        operands.push_back(Operand{start, false, 0.0});
+        code.push_back(ins);
+        positions.push_back(compiled.positions[pc]);
     }
-    if (func == "cos") {
-        return std::cos(a * M_PI / 180.0);  // Convert degrees to radians
-    }
-    if (func == "tan") {
-        // Check for undefined values (90°, 270°, etc.)
-        if (std::fmod(std::abs(a - 90.0), 180.0) < 1e-10) {
-            throw std::runtime_error("Tangent is undefined at " + std::to_string(static_cast<int>(a)) + " degrees");
+
+    compiled.eliminated = compiled.code.size() - code.size();
+    compiled.code.swap(code);
+    compiled.positions.swap(positions);
+
+    // Folding can only shrink the stack; recompute its high-water mark
+    size_t depth           = 0;
+    compiled.maxStackDepth = 0;
+    for (const Instruction& ins : compiled.code) {
+        if (ins.op == OpCode::PushConst || ins.op == OpCode::PushVar) {
+            depth++;
+        } else {
+            depth -= operatorTable[static_cast<size_t>(ins.op)].arity - 1;
         }
-        return std::tan(a * M_PI / 180.0);  // Convert degrees to radians
+        compiled.maxStackDepth = std::max(compiled.maxStackDepth, depth);
     }
+}
 
-    // Logarithmic functions
-    if (func == "log") {
-        if (a <= 0) {
-            throw std::runtime_error("Cannot compute logarithm of non-positive number");
-        }
-        return std::log10(a);
+EvalResult CompiledExpression::evaluate(const double* variables) const {
+    if (!status.ok()) {
+        return status;
     }
-    if (func == "ln") {
-        if (a <= 0) {
-            throw std::runtime_error("Cannot compute natural logarithm of non-positive number");
-        }
-        return std::log(a);
+    if (variables == nullptr && !this->variables.empty()) {
+        size_t pc = 0;
+        while (code[pc].op != OpCode::PushVar) pc++;
+        return EvalResult::failure(EvalError::UnboundVariable, positions[pc]);
     }
 
-    // Other functions
-    if (func == "exp") {
-        return std::exp(a);
+    // Small programs run entirely on a local stack; deeper ones spill to the heap
+    double localStack[32];
+    std::vector<double> heapStack;
+    double* stack = localStack;
+    if (maxStackDepth > sizeof(localStack) / sizeof(localStack[0])) {
+        heapStack.resize(maxStackDepth);
+        stack = heapStack.data();
     }
-    if (func == "sqrt") {
-        if (a < 0) {
-            throw std::runtime_error("Cannot compute square root of negative number");
+
+    size_t top = 0;
+    for (size_t pc = 0; pc < code.size(); ++pc) {
+        const Instruction& ins = code[pc];
+        if (ins.op == OpCode::PushConst) {
+            stack[top++] = ins.value;
+        } else if (ins.op == OpCode::PushVar) {
+            stack[top++] = variables[ins.slot];
+        } else {
+            const OperatorInfo& info = operatorTable[static_cast<size_t>(ins.op)];
+            top -= info.arity;
+            EvalError error = info.apply(stack + top, stack[top]);
+            if (error != EvalError::None) {
+                return EvalResult::failure(error, positions[pc]);
+            }
+            top++;
         }
-        return std::sqrt(a);
     }
+    return EvalResult::success(stack[top - 1]);
+}
 
-    // Inverse trigonometric functions
-    if (func == "asin") {
-        if (a < -1 || a > 1) {
-            throw std::runtime_error("Inverse sine argument must be between -1 and 1");
-        }
-        return std::asin(a) * 180.0 / M_PI;  // Convert radians to degrees
+EvalError CompiledExpression::evaluateBatch(const double* const* columns, size_t count, double* out) const {
+    std::vector<double> scratch;
+    return evaluateBatch(columns, count, out, scratch);
+}
+
+EvalError CompiledExpression::evaluateBatch(const double* const* columns, size_t count, double* out, std::vector<double>& scratch) const {
+    if (!status.ok()) {
+        return status.error;
     }
-    if (func == "acos") {
-        if (a < -1 || a > 1) {
-            throw std::runtime_error("Inverse cosine argument must be between -1 and 1");
-        }
-        return std::acos(a) * 180.0 / M_PI;  // Convert radians to degrees
+    if (columns == nullptr && !variables.empty()) {
+        return EvalError::UnboundVariable;
     }
-    if (func == "atan") {
-        return std::atan(a) * 180.0 / M_PI;  // Convert radians to degrees
+    // Points per chunk: each stack slot is a column of this many values,
+    // small enough that the whole operand stack stays in L1/L2
+    const size_t chunkSize = 256;
+    if (scratch.size() < maxStackDepth * chunkSize) {
+        scratch.resize(maxStackDepth * chunkSize);
     }
 
-    // Hyperbolic functions
-    if (func == "hyp") {
-        return std::hypot(a, a);
-    }
+    for (size_t base = 0; base < count; base += chunkSize) {
+        const size_t n = std::min(chunkSize, count - base);
+
+        size_t top = 0;
+        for (const Instruction& ins : code) {
+            if (ins.op == OpCode::PushConst) {
+                double* column = &scratch[top++ * chunkSize];
+                std::fill(column, column + n, ins.value);
+            } else if (ins.op == OpCode::PushVar) {
+                const double* input = columns[ins.slot] + base;
+                std::copy(input, input + n, &scratch[top++ * chunkSize]);
+            } else {
+                const OperatorInfo& info = operatorTable[static_cast<size_t>(ins.op)];
+                top -= info.arity;
+                info.applyColumn(&scratch[top * chunkSize], info.arity > 1 ? &scratch[(top + 1) * chunkSize] : nullptr, n);
+                top++;
+            }
+        }
 
-    throw std::runtime_error("Unknown function: " + func);
-}
\ No newline at end of file
+        const double* result = &scratch[(top - 1) * chunkSize];
+        std::copy(result, result + n, out + base);
+    }
+    return EvalError::None;
+}
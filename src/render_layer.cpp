@@ -0,0 +1,37 @@
+#include "../includes/render_layer.h"
+
+#include "../raylib/src/rlgl.h"
+
+void RenderLayer::begin(int width, int height, Color background) {
+    if (target.texture.width != width || target.texture.height != height) {
+        unload();
+        target = LoadRenderTexture(width, height);
+    }
+
+    BeginTextureMode(target);
+    ClearBackground(background);
+
+    // Blend colors as usual but accumulate alpha, so translucent strokes and
+    // anti-aliased glyph edges keep the layer opaque instead of punching holes
+    // that would let the screen behind show through when composited
+    rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA, RL_FUNC_ADD, RL_FUNC_ADD);
+    BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+}
+
+void RenderLayer::end() {
+    EndBlendMode();
+    EndTextureMode();
+}
+
+void RenderLayer::draw(Vector2 position) const {
+    // Render textures are stored bottom-up, so flip the source rectangle
+    Rectangle source = {0.0f, 0.0f, static_cast<float>(target.texture.width), -static_cast<float>(target.texture.height)};
+    DrawTextureRec(target.texture, source, position, WHITE);
+}
+
+void RenderLayer::unload() {
+    if (loaded()) {
+        UnloadRenderTexture(target);
+        target = RenderTexture2D{};
+    }
+}
@@ -1,42 +1,312 @@
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <memory>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
+#include "../includes/content_hash.h"
+#include "../includes/thread_pool.h"
 #include "../raylib/src/raylib.h"
 
-int main() {
-    // Initialize window (required for raylib functions)
-    InitWindow(100, 100, "Resource Exporter");
+// Runs without a window or GPU context: fonts are rasterized and images
+// decoded on the CPU, so the export works on headless build machines.
+// Every asset becomes a raw .bin blob, linked into the executable as is (see
+// cmake/resources.cmake), plus a small header with its sizes and layout
 
-    try {
-        // Export font as code
-        Font font = LoadFontEx("resource/Ubuntu-Regular.ttf", 64, 0, 0);
-        // NOTE: We are saving the font data as a C header file
-        // This will generate a font_ubuntu.h file with the font data embedded
-        // as a byte array and a function to load it. We will replace the
-        // C-style initialization with C++-style to avoid warnings.
-        if (ExportFontAsCode(font, "includes/font_ubuntu.h") == false) {
-            throw std::runtime_error("Failed to export font");
+// Bump when the generated headers change shape, so existing ones are rebuilt
+static const int exporterVersion = 3;
+
+// Same glyph set and padding LoadFontEx uses: ASCII 32..126, and raylib's
+// FONT_TTF_DEFAULT_CHARS_PADDING
+static const int fontSize     = 64;
+static const int glyphCount   = 95;
+static const int glyphPadding = 4;
+
+typedef std::unique_ptr<unsigned char, void (*)(unsigned char*)> FileData;
+
+static FileData ReadInput(const char* fileName, int* dataSize) {
+    FileData data(LoadFileData(fileName, dataSize), UnloadFileData);
+    if (data == nullptr) {
+        throw std::runtime_error(std::string("Failed to read ") + fileName);
+    }
+    return data;
+}
+
+// Hash of everything a generated header depends on: the input file, the
+// export settings, the exporter's output format and the raylib version that
+// rasterizes and encodes
+static uint64_t SourceHash(const unsigned char* data, int dataSize, const std::vector<int>& settings) {
+    uint64_t hash = Fnv1a(data, static_cast<size_t>(dataSize));
+    hash          = Fnv1a(settings.data(), settings.size() * sizeof(int), hash);
+    hash          = Fnv1a(&exporterVersion, sizeof(exporterVersion), hash);
+    return Fnv1a(RAYLIB_VERSION, sizeof(RAYLIB_VERSION) - 1, hash);
+}
+
+static std::string SourceHashLine(uint64_t sourceHash) {
+    char line[64];
+    std::snprintf(line, sizeof(line), "// Source hash: %016" PRIx64, sourceHash);
+    return line;
+}
+
+// Whether fileName and its blob were generated from inputs with this hash;
+// the stamp sits in the first few lines of every generated header, which is
+// written after its blob
+static bool IsUpToDate(const std::string& fileName, const std::string& blobName, uint64_t sourceHash) {
+    if (!std::ifstream(blobName).good()) return false;
+
+    const std::string stamp = SourceHashLine(sourceHash);
+    std::ifstream file(fileName);
+    std::string line;
+    for (int i = 0; i < 4 && std::getline(file, line); ++i) {
+        if (line == stamp) return true;
+    }
+    return false;
+}
+
+// Move a fully written temporary over fileName, so an interrupted export never
+// leaves a stamped but truncated header behind
+static void ReplaceFile(const std::string& temporary, const std::string& fileName) {
+    std::remove(fileName.c_str());  // rename does not replace an existing file on Windows
+    if (std::rename(temporary.c_str(), fileName.c_str()) != 0) {
+        throw std::runtime_error("Failed to replace " + fileName);
+    }
+}
+
+static void WriteBlob(const std::string& fileName, const unsigned char* data, size_t size) {
+    const std::string temporary = fileName + ".tmp";
+    FILE* file                  = std::fopen(temporary.c_str(), "wb");
+    if (file == nullptr) {
+        throw std::runtime_error("Failed to open " + temporary);
+    }
+    const bool written = std::fwrite(data, 1, size, file) == size;
+    if (std::fclose(file) != 0 || !written) {
+        throw std::runtime_error("Failed to write " + temporary);
+    }
+    ReplaceFile(temporary, fileName);
+}
+
+// LoadFontData for codepoints 32..glyphCount+31, rasterizing ranges of glyphs
+// on the pool. stb_truetype keeps no state between calls, so the glyphs are
+// the same as from a single call
+static GlyphInfo* RasterizeGlyphs(ThreadPool& pool, const unsigned char* fileData, int dataSize) {
+    std::vector<int> codepoints(glyphCount);
+    for (int i = 0; i < glyphCount; ++i) codepoints[static_cast<size_t>(i)] = 32 + i;
+
+    GlyphInfo* glyphs = static_cast<GlyphInfo*>(RL_CALLOC(glyphCount, sizeof(GlyphInfo)));
+    std::atomic<bool> failed{false};
+    pool.parallelFor(static_cast<size_t>(glyphCount), 4, [&](size_t begin, size_t end, size_t) {
+        const int count = static_cast<int>(end - begin);
+        GlyphInfo* part = LoadFontData(fileData, dataSize, fontSize, &codepoints[begin], count, FONT_DEFAULT);
+        if (part == nullptr) {
+            failed = true;
+            return;
         }
-        UnloadFont(font);
-
-        // Export icon as code
-        Image icon = LoadImage("resource/calc.png");
-        // NOTE: We are saving the icon data as a C header file
-        // This will generate a icon_calc.h file with the icon data embedded as
-        // a byte array and a function to load it. We will replace the C-style
-        // initialization with C++-style to avoid warnings.
-        if (ExportImageAsCode(icon, "includes/icon_calc.h") == false) {
-            throw std::runtime_error("Failed to export image");
+        std::memcpy(glyphs + begin, part, static_cast<size_t>(count) * sizeof(GlyphInfo));  // Takes over the glyph images
+        RL_FREE(part);
+    });
+
+    if (failed) {
+        UnloadFontData(glyphs, glyphCount);
+        throw std::runtime_error("Failed to rasterize font");
+    }
+    return glyphs;
+}
+
+// Writes font's atlas to blobName and a C header with its layout and glyphs
+// to fileName. The atlas keeps only glyph coverage, one byte per pixel,
+// instead of raylib's gray+alpha pair whose gray half is always 255. Halves
+// the embedded data, the inflate work and the texture upload. The header
+// records the atlas layout so loaders can allocate it exactly.
+// atlas is the font's gray+alpha atlas image
+static void ExportFontAtlas(const Font& font, const Image& atlas, const std::string& name, const std::string& fileName, const std::string& blobName,
+                            uint64_t sourceHash) {
+    if (atlas.format != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) {
+        throw std::runtime_error("Font atlas is not GRAY+ALPHA");
+    }
+
+    // Coverage is the alpha channel; the gray channel must be plain white
+    // for a single channel to render the same
+    const int pixelCount        = atlas.width * atlas.height;
+    const unsigned char* texels = static_cast<const unsigned char*>(atlas.data);
+    std::vector<unsigned char> coverage(static_cast<size_t>(pixelCount));
+    for (int i = 0; i < pixelCount; ++i) {
+        if (texels[2 * i] != 255) {
+            throw std::runtime_error("Font atlas has non-white glyph pixels");
         }
+        coverage[static_cast<size_t>(i)] = texels[2 * i + 1];
+    }
+
+    int compressedSize        = 0;
+    unsigned char* compressed = CompressData(coverage.data(), pixelCount, &compressedSize);
+    if (compressed == nullptr) {
+        throw std::runtime_error("Failed to compress font atlas");
+    }
+    std::unique_ptr<unsigned char, void (*)(void*)> compressedOwner(compressed, MemFree);
+    WriteBlob(blobName, compressed, static_cast<size_t>(compressedSize));
+
+    std::string upper = name;
+    for (char& c : upper) c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+
+    const std::string temporary = fileName + ".tmp";
+    FILE* file                  = std::fopen(temporary.c_str(), "w");
+    if (file == nullptr) {
+        throw std::runtime_error("Failed to open " + temporary);
+    }
+
+    std::fprintf(file, "#pragma once\n");
+    std::fprintf(file, "%s\n", SourceHashLine(sourceHash).c_str());
+    std::fprintf(file, "// Generated by resource_exporter; do not edit.\n");
+    std::fprintf(file, "// Glyph atlas stored as coverage only, one byte per pixel, DEFLATE-compressed.\n");
+    std::fprintf(file, "// Draw it through CoverageShader or expand it to gray+alpha, see LoadEmbeddedFont.\n");
+    std::fprintf(file, "// Needs raylib's Rectangle and GlyphInfo declared before it is included.\n");
+    std::fprintf(file, "// The atlas is linked from %s; its glyph tables are defined here.\n\n", GetFileName(blobName.c_str()));
+
+    std::fprintf(file, "#define BASE_SIZE_FONT_%s %d\n", upper.c_str(), font.baseSize);
+    std::fprintf(file, "#define GLYPH_COUNT_FONT_%s %d\n", upper.c_str(), font.glyphCount);
+    std::fprintf(file, "#define GLYPH_PADDING_FONT_%s %d\n\n", upper.c_str(), font.glyphPadding);
+
+    std::fprintf(file, "#define ATLAS_WIDTH_FONT_%s %d\n", upper.c_str(), atlas.width);
+    std::fprintf(file, "#define ATLAS_HEIGHT_FONT_%s %d\n", upper.c_str(), atlas.height);
+    std::fprintf(file, "#define ATLAS_FORMAT_FONT_%s %d  // PIXELFORMAT_UNCOMPRESSED_GRAYSCALE\n", upper.c_str(),
+                 static_cast<int>(PIXELFORMAT_UNCOMPRESSED_GRAYSCALE));
+    std::fprintf(file, "#define DECOMPRESSED_DATA_SIZE_FONT_%s %d\n", upper.c_str(), pixelCount);
+    std::fprintf(file, "#define COMPRESSED_DATA_SIZE_FONT_%s %d\n", upper.c_str(), compressedSize);
+    std::fprintf(file, "#define COMPRESSED_DATA_HASH_FONT_%s 0x%016" PRIx64 "ULL  // FNV-1a of the blob\n\n", upper.c_str(),
+                 Fnv1a(compressed, static_cast<size_t>(compressedSize)));
+
+    std::fprintf(file, "// Atlas coverage, DEFLATE-compressed\n");
+    std::fprintf(file, "extern \"C\" const unsigned char fontData_%s[COMPRESSED_DATA_SIZE_FONT_%s];\n\n", name.c_str(), upper.c_str());
+
+    std::fprintf(file, "// Glyph rectangles in the atlas\n");
+    std::fprintf(file, "static Rectangle fontRecs_%s[GLYPH_COUNT_FONT_%s] = {\n", name.c_str(), upper.c_str());
+    for (int i = 0; i < font.glyphCount; ++i) {
+        const Rectangle& r = font.recs[i];
+        std::fprintf(file, "    {%.0f, %.0f, %.0f, %.0f},\n", r.x, r.y, r.width, r.height);
+    }
+    std::fprintf(file, "};\n\n");
+
+    std::fprintf(file, "// Glyph metrics; glyph images are not embedded\n");
+    std::fprintf(file, "static GlyphInfo fontGlyphs_%s[GLYPH_COUNT_FONT_%s] = {\n", name.c_str(), upper.c_str());
+    for (int i = 0; i < font.glyphCount; ++i) {
+        const GlyphInfo& g = font.glyphs[i];
+        std::fprintf(file, "    {%d, %d, %d, %d, {}},\n", g.value, g.offsetX, g.offsetY, g.advanceX);
+    }
+    std::fprintf(file, "};\n");
+
+    if (std::fclose(file) != 0) {
+        throw std::runtime_error("Failed to write " + temporary);
+    }
+    ReplaceFile(temporary, fileName);
+}
+
+// Free the glyphs and recs of a font built without a window. UnloadFont would
+// skip it: the font has no texture, and texture id 0 is also the id of the
+// default font when there is no GL context
+static void UnloadGlyphsAndRecs(Font& font) {
+    UnloadFontData(font.glyphs, font.glyphCount);
+    RL_FREE(font.recs);
+}
+
+// Rasterize the font on the CPU and export its atlas, unless the header and
+// blob were already generated from the same font file
+static void ExportFont(ThreadPool& pool, const char* fontFile, const std::string& name, const std::string& fileName, const std::string& blobName) {
+    int dataSize        = 0;
+    const FileData data = ReadInput(fontFile, &dataSize);
+    const uint64_t hash = SourceHash(data.get(), dataSize, {fontSize, glyphCount, glyphPadding});
+    if (IsUpToDate(fileName, blobName, hash)) {
+        TraceLog(LOG_INFO, "EXPORT: [%s] Up to date, skipped", fileName.c_str());
+        return;
+    }
+
+    Font font         = {};
+    font.baseSize     = fontSize;
+    font.glyphCount   = glyphCount;
+    font.glyphPadding = glyphPadding;
+    font.glyphs       = RasterizeGlyphs(pool, data.get(), dataSize);
+    Image atlas       = GenImageFontAtlas(font.glyphs, &font.recs, glyphCount, fontSize, glyphPadding, 0);
+
+    try {
+        ExportFontAtlas(font, atlas, name, fileName, blobName, hash);
+    } catch (...) {
+        UnloadImage(atlas);
+        UnloadGlyphsAndRecs(font);
+        throw;
+    }
+    UnloadImage(atlas);
+    UnloadGlyphsAndRecs(font);
+    TraceLog(LOG_INFO, "EXPORT: [%s] Font exported", fileName.c_str());
+}
+
+// Decode the icon on the CPU and export its pixels uncompressed, unless the
+// header and blob were already generated from the same image file. prefix
+// names the header's macros and the pixel array
+static void ExportIcon(const char* imageFile, const std::string& prefix, const std::string& fileName, const std::string& blobName) {
+    int dataSize        = 0;
+    const FileData data = ReadInput(imageFile, &dataSize);
+    const uint64_t hash = SourceHash(data.get(), dataSize, {});
+    if (IsUpToDate(fileName, blobName, hash)) {
+        TraceLog(LOG_INFO, "EXPORT: [%s] Up to date, skipped", fileName.c_str());
+        return;
+    }
+
+    Image icon = LoadImageFromMemory(GetFileExtension(imageFile), data.get(), dataSize);
+    if (icon.data == nullptr) {
+        throw std::runtime_error(std::string("Failed to decode ") + imageFile);
+    }
+    const int pixelBytes = GetPixelDataSize(icon.width, icon.height, icon.format);
+    try {
+        WriteBlob(blobName, static_cast<const unsigned char*>(icon.data), static_cast<size_t>(pixelBytes));
+    } catch (...) {
+        UnloadImage(icon);
+        throw;
+    }
+
+    const std::string temporary = fileName + ".tmp";
+    FILE* file                  = std::fopen(temporary.c_str(), "w");
+    if (file == nullptr) {
         UnloadImage(icon);
+        throw std::runtime_error("Failed to open " + temporary);
+    }
+
+    std::fprintf(file, "#pragma once\n");
+    std::fprintf(file, "%s\n", SourceHashLine(hash).c_str());
+    std::fprintf(file, "// Generated by resource_exporter; do not edit.\n");
+    std::fprintf(file, "// Image pixels, uncompressed, linked from %s.\n\n", GetFileName(blobName.c_str()));
 
+    std::fprintf(file, "#define %s_WIDTH %d\n", prefix.c_str(), icon.width);
+    std::fprintf(file, "#define %s_HEIGHT %d\n", prefix.c_str(), icon.height);
+    std::fprintf(file, "#define %s_FORMAT %d  // raylib PixelFormat\n", prefix.c_str(), icon.format);
+    std::fprintf(file, "#define %s_DATA_SIZE %d\n\n", prefix.c_str(), pixelBytes);
+
+    std::fprintf(file, "extern \"C\" const unsigned char %s_DATA[%s_DATA_SIZE];\n", prefix.c_str(), prefix.c_str());
+    UnloadImage(icon);
+
+    if (std::fclose(file) != 0) {
+        throw std::runtime_error("Failed to write " + temporary);
+    }
+    ReplaceFile(temporary, fileName);
+    TraceLog(LOG_INFO, "EXPORT: [%s] Image exported", fileName.c_str());
+}
+
+int main() {
+    const auto start = std::chrono::steady_clock::now();
+
+    try {
+        ThreadPool pool;
+        ExportFont(pool, "resource/Ubuntu-Regular.ttf", "FontUbuntu", "includes/font_ubuntu.h", "includes/font_ubuntu.bin");
+        ExportIcon("resource/calc.png", "ICON_CALC", "includes/icon_calc.h", "includes/icon_calc.bin");
     } catch (const std::exception& e) {
-        CloseWindow();
+        TraceLog(LOG_ERROR, "EXPORT: %s", e.what());
         return 1;
     }
 
-    // Close window
-    CloseWindow();
-
+    const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    TraceLog(LOG_INFO, "EXPORT: Resources ready in %.1f ms", ms);
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,186 @@
+#include "../includes/stream_evaluator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "../includes/expression_cache.h"
+#include "../includes/number_format.h"
+
+void AppendResultLine(std::string& out, const EvalResult& result, int precision) {
+    if (result.ok()) {
+        char buffer[numberBufferSize];
+        out.append(buffer, FormatNumberTo(result.value, precision, buffer));
+    } else {
+        out += "error: ";
+        out += result.message();
+        out += " at ";
+        out += std::to_string(result.position);
+    }
+    out += '\n';
+}
+
+StreamEvaluator::StreamEvaluator(size_t threadCount, int precision, size_t chunkBytes, size_t cacheCapacity)
+    : workerCount(threadCount == 0 ? std::max<size_t>(1, std::thread::hardware_concurrency()) : threadCount),
+      precision(precision),
+      chunkBytes(std::max<size_t>(1, chunkBytes)),
+      cacheCapacity(cacheCapacity),
+      maxInFlight(2 * workerCount + 2) {}
+
+bool StreamEvaluator::run(FILE* input, FILE* output, StreamStats& stats) {
+    const auto start = std::chrono::steady_clock::now();
+    stats            = StreamStats();
+    queued.clear();
+    finished.clear();
+    inFlight    = 0;
+    chunksRead  = 0;
+    readingDone = false;
+    writeFailed = false;
+    cacheHits   = 0;
+    cacheMisses = 0;
+
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < workerCount; ++i) {
+        workers.emplace_back(&StreamEvaluator::workerLoop, this);
+    }
+    std::thread writer(&StreamEvaluator::writerLoop, this, output, std::ref(stats));
+
+    // Read on this thread; whatever follows the last newline of a chunk is
+    // carried into the next one so chunks always hold whole lines
+    bool readFailed = false;
+    std::string carry;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            spaceAvailable.wait(lock, [this]() { return inFlight < maxInFlight || writeFailed; });
+            if (writeFailed) break;
+        }
+
+        std::unique_ptr<Chunk> chunk(new Chunk());
+        chunk->text.swap(carry);
+        const size_t kept = chunk->text.size();
+        chunk->text.resize(kept + chunkBytes);
+        const size_t got = std::fread(&chunk->text[kept], 1, chunkBytes, input);
+        chunk->text.resize(kept + got);
+        stats.bytesRead += got;
+
+        const bool atEnd = got < chunkBytes;
+        if (atEnd && std::ferror(input)) readFailed = true;
+        if (!atEnd) {
+            const size_t lastNewline = chunk->text.rfind('\n');
+            if (lastNewline == std::string::npos) {
+                carry.swap(chunk->text);  // No line ended yet; keep reading into it
+                continue;
+            }
+            carry.assign(chunk->text, lastNewline + 1, std::string::npos);
+            chunk->text.resize(lastNewline + 1);
+        }
+
+        if (!chunk->text.empty()) {
+            std::lock_guard<std::mutex> lock(mutex);
+            chunk->sequence = chunksRead++;
+            inFlight++;
+            queued.push_back(std::move(chunk));
+            chunkReady.notify_one();
+        }
+        if (atEnd) break;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        readingDone = true;
+    }
+    chunkReady.notify_all();
+    chunkDone.notify_all();
+
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    writer.join();
+
+    stats.cacheHits   = cacheHits;
+    stats.cacheMisses = cacheMisses;
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return !readFailed && !writeFailed;
+}
+
+void StreamEvaluator::workerLoop() {
+    ExpressionCache cache(cacheCapacity);  // Per worker, so lookups need no locking
+    std::string line;
+
+    for (;;) {
+        std::unique_ptr<Chunk> chunk;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            chunkReady.wait(lock, [this]() { return !queued.empty() || readingDone; });
+            if (queued.empty()) {
+                cacheHits += cache.hits();
+                cacheMisses += cache.misses();
+                return;
+            }
+            chunk = std::move(queued.front());
+            queued.pop_front();
+        }
+
+        chunk->lines       = 0;
+        chunk->expressions = 0;
+        chunk->failures    = 0;
+        chunk->result.reserve(chunk->text.size());
+
+        size_t begin = 0;
+        while (begin < chunk->text.size()) {
+            size_t end = chunk->text.find('\n', begin);
+            if (end == std::string::npos) end = chunk->text.size();
+            line.assign(chunk->text, begin, end - begin);
+            begin = end + 1;
+
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            chunk->lines++;
+
+            if (line.find_first_not_of(" \t") == std::string::npos) {
+                chunk->result += '\n';  // Blank lines stay blank so output lines up with input
+                continue;
+            }
+
+            EvalResult result = cache.evaluate(line);
+            chunk->expressions++;
+            if (!result.ok()) chunk->failures++;
+            AppendResultLine(chunk->result, result, precision);
+        }
+
+        // The input is no longer needed; release it before the chunk waits to be written
+        std::string().swap(chunk->text);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        finished[chunk->sequence] = std::move(chunk);
+        chunkDone.notify_all();
+    }
+}
+
+void StreamEvaluator::writerLoop(FILE* output, StreamStats& stats) {
+    for (size_t next = 0;; ++next) {
+        std::unique_ptr<Chunk> chunk;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            chunkDone.wait(lock, [&]() { return finished.count(next) != 0 || (readingDone && next == chunksRead); });
+            auto it = finished.find(next);
+            if (it == finished.end()) return;
+            chunk = std::move(it->second);
+            finished.erase(it);
+        }
+
+        stats.lines += chunk->lines;
+        stats.expressions += chunk->expressions;
+        stats.failures += chunk->failures;
+
+        // After a failed write keep draining so workers and the reader can finish
+        bool failed = std::fwrite(chunk->result.data(), 1, chunk->result.size(), output) != chunk->result.size();
+        chunk.reset();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        writeFailed = writeFailed || failed;
+        inFlight--;
+        spaceAvailable.notify_one();
+    }
+}
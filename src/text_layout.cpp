@@ -0,0 +1,111 @@
+#include "../includes/text_layout.h"
+
+TextLayout::TextLayout(const Font& font, const GlyphTable& glyphs, const CoverageShader* coverage)
+    : font(font), glyphs(glyphs), coverage(coverage), cache() {
+    for (int c = 0; c < 128; ++c) {
+        int index   = glyphs.index[c];
+        advances[c] = font.glyphs[index].advanceX > 0 ? static_cast<float>(font.glyphs[index].advanceX)
+                                                      : font.recs[index].width + static_cast<float>(font.glyphs[index].offsetX);
+    }
+}
+
+bool TextLayout::isAscii(const std::string& text) {
+    for (char c : text) {
+        if (static_cast<unsigned char>(c) >= 128 || c == '\n') return false;
+    }
+    return true;
+}
+
+Vector2 TextLayout::measure(const std::string& text, float fontSize, float spacing) const {
+    if (text.empty()) return Vector2{0.0f, 0.0f};
+    if (!isAscii(text)) return MeasureTextEx(font, text.c_str(), fontSize, spacing);
+
+    float width = 0.0f;
+    for (char c : text) {
+        width += advances[static_cast<unsigned char>(c)];
+    }
+    return Vector2{width * fontSize / static_cast<float>(font.baseSize) + static_cast<float>(text.size() - 1) * spacing, fontSize};
+}
+
+void TextLayout::draw(const std::string& text, Vector2 position, float fontSize, float spacing, Color tint) const {
+    const bool bracket = coverage != nullptr && !inRun;
+    if (bracket) coverage->begin(font);
+    drawGlyphs(text, position, fontSize, spacing, tint);
+    if (bracket) coverage->end(font);
+}
+
+void TextLayout::begin() {
+    if (coverage != nullptr && !inRun) coverage->begin(font);
+    inRun = true;
+}
+
+void TextLayout::end() {
+    if (coverage != nullptr && inRun) coverage->end(font);
+    inRun = false;
+}
+
+void TextLayout::drawGlyphs(const std::string& text, Vector2 position, float fontSize, float spacing, Color tint) const {
+    if (font.texture.id == 0 || !isAscii(text)) {
+        DrawTextEx(font, text.c_str(), position, fontSize, spacing, tint);
+        return;
+    }
+
+    // DrawTextEx and DrawTextCodepoint with the glyph lookups resolved from the table
+    const float scale   = fontSize / static_cast<float>(font.baseSize);
+    const float padding = static_cast<float>(font.glyphPadding);
+    float offsetX       = 0.0f;
+    for (char c : text) {
+        const int index        = glyphs.index[static_cast<unsigned char>(c)];
+        const GlyphInfo& glyph = font.glyphs[index];
+        const Rectangle& rec   = font.recs[index];
+
+        if (c != ' ' && c != '\t') {
+            Rectangle source = {rec.x - padding, rec.y - padding, rec.width + 2.0f * padding, rec.height + 2.0f * padding};
+            Rectangle dest   = {position.x + offsetX + glyph.offsetX * scale - padding * scale, position.y + glyph.offsetY * scale - padding * scale,
+                                source.width * scale, source.height * scale};
+            DrawTexturePro(font.texture, source, dest, Vector2{0.0f, 0.0f}, 0.0f, tint);
+        }
+
+        offsetX += (glyph.advanceX == 0 ? rec.width : static_cast<float>(glyph.advanceX)) * scale + spacing;
+    }
+}
+
+const std::string& TextLayout::truncateToFit(const std::string& text, float fontSize, float maxWidth) {
+    useClock++;
+    Truncation* victim = &cache[0];
+    for (Truncation& candidate : cache) {
+        if (candidate.lastUse != 0 && candidate.fontSize == fontSize && candidate.maxWidth == maxWidth && candidate.text == text) {
+            candidate.lastUse = useClock;
+            return candidate.result;
+        }
+        if (candidate.lastUse < victim->lastUse) victim = &candidate;
+    }
+
+    Truncation& entry = *victim;
+    entry.lastUse     = useClock;
+    entry.text        = text;
+    entry.fontSize    = fontSize;
+    entry.maxWidth    = maxWidth;
+
+    // Find the longest suffix that fits by summing advances from the back
+    size_t start = 0;
+    if (text.size() > 1 && isAscii(text)) {
+        const float scale = fontSize / static_cast<float>(font.baseSize);
+        start             = text.size() - 1;  // At least one character is always kept
+        float width       = advances[static_cast<unsigned char>(text[start])];
+        while (start > 0 && (width + advances[static_cast<unsigned char>(text[start - 1])]) * scale <= maxWidth) {
+            width += advances[static_cast<unsigned char>(text[--start])];
+        }
+    } else if (!isAscii(text)) {
+        // Multi-byte text is rare; measure each candidate the slow way
+        while (text.size() - start > 1 && MeasureTextEx(font, text.c_str() + start, fontSize, 0).x > maxWidth) {
+            start++;
+        }
+    }
+
+    entry.result.assign(text, start, std::string::npos);
+    if (start > 0 && entry.result.length() > 1) {
+        entry.result[0] = '.';
+    }
+    return entry.result;
+}
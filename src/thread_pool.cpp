@@ -0,0 +1,96 @@
+#include "../includes/thread_pool.h"
+
+#include <algorithm>
+
+ThreadPool::ThreadPool(size_t threadCount) {
+    if (threadCount == 0) {
+        threadCount = std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+
+    queues.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i) {
+        queues.emplace_back(new WorkQueue());
+    }
+
+    workers.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i) {
+        workers.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        stopping = true;
+    }
+    workAvailable.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::parallelFor(size_t count, size_t grain, const RangeFn& body) {
+    if (count == 0) return;
+    grain = std::max<size_t>(1, grain);
+
+    std::lock_guard<std::mutex> jobLock(jobMutex);
+    pendingRanges = (count + grain - 1) / grain;
+
+    // Deal contiguous ranges round-robin so every worker starts with local work
+    size_t rangeIndex = 0;
+    for (size_t begin = 0; begin < count; begin += grain, ++rangeIndex) {
+        WorkQueue& queue = *queues[rangeIndex % queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.ranges.push_back(Range{begin, std::min(count, begin + grain), &body});
+    }
+
+    std::unique_lock<std::mutex> lock(stateMutex);
+    jobGeneration++;
+    workAvailable.notify_all();
+    jobFinished.wait(lock, [this]() { return pendingRanges == 0; });
+}
+
+void ThreadPool::workerLoop(size_t index) {
+    size_t seenGeneration = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(stateMutex);
+            workAvailable.wait(lock, [&]() { return stopping || jobGeneration != seenGeneration; });
+            if (stopping) return;
+            seenGeneration = jobGeneration;
+        }
+
+        Range range;
+        while (popOrSteal(index, range)) {
+            (*range.body)(range.begin, range.end, index);
+            if (--pendingRanges == 0) {
+                std::lock_guard<std::mutex> lock(stateMutex);
+                jobFinished.notify_all();
+            }
+        }
+    }
+}
+
+bool ThreadPool::popOrSteal(size_t index, Range& range) {
+    // Newest local range first: it was dealt last and is most likely untouched by thieves
+    {
+        WorkQueue& own = *queues[index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.ranges.empty()) {
+            range = own.ranges.back();
+            own.ranges.pop_back();
+            return true;
+        }
+    }
+
+    for (size_t offset = 1; offset < queues.size(); ++offset) {
+        WorkQueue& victim = *queues[(index + offset) % queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.ranges.empty()) {
+            range = victim.ranges.front();
+            victim.ranges.pop_front();
+            return true;
+        }
+    }
+    return false;
+}